@@ -0,0 +1,89 @@
+//
+//  CoreBenchmarks.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+// Microbenchmarks of the hot paths: an inbox diff per snapshot, a deduplication per push delivery and a token per
+// rate limited call. Prints one line per benchmark, the median of 'kRuns' runs, for CI to compare against earlier builds.
+
+#include "apx/InboxDiff.h"
+#include "apx/NumericValue.h"
+#include "apx/RecentKeys.h"
+#include "apx/TokenBucket.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int kRuns = 15;
+
+volatile std::size_t sink = 0; // keeps the optimizer from dropping the measured work
+
+template <typename Work>
+void benchmark(const char *name, std::size_t iterations, Work work)
+{
+    std::vector<double> nanosecondsPerIteration;
+
+    for (int run = 0; run < kRuns; run++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < iterations; i++) work(i);
+
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        nanosecondsPerIteration.push_back(elapsed.count() / iterations);
+    }
+
+    std::sort(nanosecondsPerIteration.begin(), nanosecondsPerIteration.end());
+    std::printf("%-28s %12.1f ns\n", name, nanosecondsPerIteration[kRuns / 2]);
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 random(42);
+
+    // A 500 message inbox where a sync inserts 5 messages at the top, deletes 5 and moves 5.
+    std::vector<std::int64_t> oldIDs;
+
+    for (std::int64_t id = 0; id < 500; id++) oldIDs.push_back(id);
+
+    std::vector<std::int64_t> newIDs(oldIDs.begin() + 5, oldIDs.end());
+
+    for (std::int64_t id = 500; id < 505; id++) newIDs.insert(newIDs.begin(), id);
+    for (int move = 0; move < 5; move++) std::swap(newIDs[random() % newIDs.size()], newIDs[random() % newIDs.size()]);
+
+    benchmark("inbox_diff_500", 200, [&](std::size_t) {
+        sink += apx::diffInbox(oldIDs, newIDs, [](std::size_t, std::size_t) { return true; }).moves.size();
+    });
+
+    std::vector<std::string> keys;
+
+    for (int key = 0; key < 4096; key++) keys.push_back(std::to_string(100000 + key) + "|open");
+
+    apx::RecentKeys recentKeys(256);
+
+    benchmark("recent_keys_insert_256", 100000, [&](std::size_t i) {
+        sink += recentKeys.insert(keys[i % keys.size()]) ? 1 : 0;
+    });
+
+    apx::TokenBucket bucket(30, 60.0, 0);
+
+    benchmark("token_bucket_consume", 1000000, [&](std::size_t i) {
+        sink += bucket.consume(i * 1000) ? 1 : 0;
+    });
+
+    benchmark("numeric_value_add", 1000000, [&](std::size_t i) {
+        sink += static_cast<std::size_t>((apx::NumericValue::integer(static_cast<std::int64_t>(i)) + apx::NumericValue::integer(1)).integerValue());
+    });
+
+    return 0;
+}
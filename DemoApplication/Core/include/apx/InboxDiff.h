@@ -0,0 +1,43 @@
+//
+//  InboxDiff.h
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#ifndef APX_INBOX_DIFF_H
+#define APX_INBOX_DIFF_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace apx {
+
+// The changes between two inbox snapshots, keyed by message uniqueID. Deleted, updated and move 'from' indexes refer to the
+// previous snapshot, inserted and move 'to' indexes refer to the new one, which is what UITableView expects in one batch.
+struct InboxChanges {
+    std::vector<std::size_t> deleted; // ascending
+    std::vector<std::size_t> inserted; // ascending
+    std::vector<std::size_t> updated; // ascending
+    std::vector<std::pair<std::size_t, std::size_t> > moves; // from -> to, in the order of the new snapshot
+
+    bool empty() const;
+};
+
+// Whether the message at oldIndex of the previous snapshot looks the same as the one at newIndex of the new snapshot.
+typedef std::function<bool(std::size_t oldIndex, std::size_t newIndex)> VisiblyEqual;
+
+// Rows are matched by uniqueID, the first occurrence of a duplicate wins. Matched rows that keep their relative order (the longest
+// increasing subsequence of their old indexes) stay in place and are updated if visiblyEqual says so, every other one is a move.
+InboxChanges diffInbox(const std::vector<std::int64_t> &oldIDs, const std::vector<std::int64_t> &newIDs, const VisiblyEqual &visiblyEqual);
+
+// Marks the positions of one longest strictly increasing subsequence of values in O(n log n).
+std::vector<bool> longestIncreasingSubsequence(const std::vector<std::size_t> &values);
+
+} // namespace apx
+
+#endif
@@ -0,0 +1,41 @@
+//
+//  NumericValue.h
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#ifndef APX_NUMERIC_VALUE_H
+#define APX_NUMERIC_VALUE_H
+
+#include <cstdint>
+
+namespace apx {
+
+// A custom field number, which remembers whether it is integral, so counters don't turn into doubles on the way through
+// the app and lose precision past 2^53.
+class NumericValue {
+public:
+    static NumericValue integer(std::int64_t value);
+    static NumericValue real(double value);
+
+    bool isIntegral() const { return integral_; }
+    std::int64_t integerValue() const;
+    double doubleValue() const;
+
+    // The sum stays integral if both operands are and it fits, otherwise it is a double.
+    NumericValue operator+(const NumericValue &other) const;
+    bool operator==(const NumericValue &other) const;
+
+private:
+    NumericValue(bool integral, std::int64_t integer, double real);
+
+    bool integral_;
+    std::int64_t integer_;
+    double real_;
+};
+
+} // namespace apx
+
+#endif
@@ -0,0 +1,30 @@
+//
+//  RateLimits.h
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#ifndef APX_RATE_LIMITS_H
+#define APX_RATE_LIMITS_H
+
+#include <string>
+#include <vector>
+
+namespace apx {
+
+struct RateLimit {
+    std::string name; // i.e. "tags"
+    unsigned limit; // calls per interval, 0 lifts the limit
+    double interval; // seconds
+};
+
+// Parses the X-Appoxee-Rate-Limit format, i.e. "tags=10/60, custom_fields=30/60" for 10 calls per 60 seconds.
+// The whole value is parsed before anything is returned, false leaves limits untouched if any entry is malformed.
+// Names aren't checked, so Appoxee can send limits of classes a newer app version knows about.
+bool parseRateLimits(const std::string &value, std::vector<RateLimit> &limits);
+
+} // namespace apx
+
+#endif
@@ -0,0 +1,45 @@
+//
+//  RecentKeys.h
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#ifndef APX_RECENT_KEYS_H
+#define APX_RECENT_KEYS_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace apx {
+
+// A bounded set of the most recent keys with constant time lookup. Once 'capacity' keys are held, inserting one evicts the oldest.
+// Not thread safe, callers serialize access.
+class RecentKeys {
+public:
+    explicit RecentKeys(std::size_t capacity);
+
+    std::size_t capacity() const { return capacity_; }
+    std::size_t size() const { return ring_.size(); }
+
+    // true if key wasn't held yet, and is now.
+    bool insert(const std::string &key);
+    bool contains(const std::string &key) const;
+    void clear();
+
+    // The held keys, oldest first. Inserting them in this order into an empty set restores the eviction order.
+    std::vector<std::string> keysOldestFirst() const;
+
+private:
+    std::size_t capacity_;
+    std::unordered_set<std::string> keys_; // for the lookup
+    std::vector<std::string> ring_; // for the eviction order, a circular buffer once full
+    std::size_t nextSlot_;
+};
+
+} // namespace apx
+
+#endif
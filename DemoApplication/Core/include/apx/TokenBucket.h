@@ -0,0 +1,47 @@
+//
+//  TokenBucket.h
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#ifndef APX_TOKEN_BUCKET_H
+#define APX_TOKEN_BUCKET_H
+
+#include <cstdint>
+
+namespace apx {
+
+// Holds up to 'limit' tokens and gets them back at limit / interval tokens per second, so a burst up to the limit goes out
+// right away while a steady stream of calls is held to the rate. A limit of 0 lifts it. Times are monotonic nanoseconds,
+// passed in by the caller. Not thread safe, callers serialize access.
+class TokenBucket {
+public:
+    // A full bucket.
+    TokenBucket(unsigned limit, double interval, std::uint64_t now);
+
+    unsigned limit() const { return limit_; }
+    double interval() const { return interval_; }
+
+    // A lower limit applies right away, a higher one as the bucket refills.
+    void setLimit(unsigned limit, double interval, std::uint64_t now);
+
+    // Takes a token. false if the bucket is empty, the call should be deferred.
+    bool consume(std::uint64_t now);
+
+    // Seconds until the bucket has a token again, 0 if it has one now.
+    double delayUntilToken(std::uint64_t now);
+
+private:
+    void refill(std::uint64_t now);
+
+    unsigned limit_;
+    double interval_;
+    double tokens_;
+    std::uint64_t refilledAt_;
+};
+
+} // namespace apx
+
+#endif
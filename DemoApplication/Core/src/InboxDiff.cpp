@@ -0,0 +1,126 @@
+//
+//  InboxDiff.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/InboxDiff.h"
+
+#include <unordered_map>
+
+namespace apx {
+
+namespace {
+
+typedef std::unordered_map<std::int64_t, std::size_t> IndexByID;
+
+IndexByID indexByID(const std::vector<std::int64_t> &ids)
+{
+    IndexByID indexes;
+    indexes.reserve(ids.size());
+
+    for (std::size_t idx = 0; idx < ids.size(); idx++) {
+        // emplace keeps the first occurrence, later duplicates are treated as plain inserts / deletes.
+        indexes.emplace(ids[idx], idx);
+    }
+
+    return indexes;
+}
+
+bool isFirstOccurrence(const IndexByID &indexes, std::int64_t id, std::size_t idx)
+{
+    IndexByID::const_iterator found = indexes.find(id);
+
+    return found != indexes.end() && found->second == idx;
+}
+
+} // namespace
+
+bool InboxChanges::empty() const
+{
+    return deleted.empty() && inserted.empty() && updated.empty() && moves.empty();
+}
+
+InboxChanges diffInbox(const std::vector<std::int64_t> &oldIDs, const std::vector<std::int64_t> &newIDs, const VisiblyEqual &visiblyEqual)
+{
+    InboxChanges changes;
+    IndexByID oldIndexes = indexByID(oldIDs);
+    IndexByID newIndexes = indexByID(newIDs);
+
+    for (std::size_t idx = 0; idx < oldIDs.size(); idx++) {
+        if (!isFirstOccurrence(oldIndexes, oldIDs[idx], idx) || !newIndexes.count(oldIDs[idx])) {
+            changes.deleted.push_back(idx);
+        }
+    }
+
+    // Matched rows, in the order of the new snapshot.
+    std::vector<std::size_t> matchedOld;
+    std::vector<std::size_t> matchedNew;
+    matchedOld.reserve(newIDs.size());
+    matchedNew.reserve(newIDs.size());
+
+    for (std::size_t idx = 0; idx < newIDs.size(); idx++) {
+        IndexByID::const_iterator oldIndex = oldIndexes.find(newIDs[idx]);
+
+        if (!isFirstOccurrence(newIndexes, newIDs[idx], idx) || oldIndex == oldIndexes.end()) {
+            changes.inserted.push_back(idx);
+        } else {
+            matchedOld.push_back(oldIndex->second);
+            matchedNew.push_back(idx);
+        }
+    }
+
+    std::vector<bool> stays = longestIncreasingSubsequence(matchedOld);
+
+    for (std::size_t i = 0; i < matchedOld.size(); i++) {
+        if (!stays[i]) {
+            changes.moves.push_back(std::make_pair(matchedOld[i], matchedNew[i]));
+        } else if (visiblyEqual && !visiblyEqual(matchedOld[i], matchedNew[i])) {
+            changes.updated.push_back(matchedOld[i]);
+        }
+    }
+
+    // Rows which stay keep their relative order, so their old indexes already ascend.
+    return changes;
+}
+
+std::vector<bool> longestIncreasingSubsequence(const std::vector<std::size_t> &values)
+{
+    // Patience sorting, 'tails[k]' holds the position of the smallest tail of an increasing run of length k + 1.
+    std::vector<bool> result(values.size(), false);
+
+    if (values.empty()) return result;
+
+    std::vector<std::size_t> tails(values.size());
+    std::vector<std::ptrdiff_t> previous(values.size());
+    std::size_t length = 0;
+
+    for (std::size_t i = 0; i < values.size(); i++) {
+        std::size_t low = 0, high = length;
+
+        while (low < high) {
+            std::size_t mid = (low + high) / 2;
+
+            if (values[tails[mid]] < values[i]) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        previous[i] = low > 0 ? static_cast<std::ptrdiff_t>(tails[low - 1]) : -1;
+        tails[low] = i;
+
+        if (low == length) length++;
+    }
+
+    for (std::ptrdiff_t i = static_cast<std::ptrdiff_t>(tails[length - 1]); i >= 0; i = previous[i]) {
+        result[i] = true;
+    }
+
+    return result;
+}
+
+} // namespace apx
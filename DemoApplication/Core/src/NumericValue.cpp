@@ -0,0 +1,59 @@
+//
+//  NumericValue.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/NumericValue.h"
+
+#include <limits>
+
+namespace apx {
+
+NumericValue::NumericValue(bool integral, std::int64_t integer, double real)
+    : integral_(integral), integer_(integer), real_(real)
+{
+}
+
+NumericValue NumericValue::integer(std::int64_t value)
+{
+    return NumericValue(true, value, 0.0);
+}
+
+NumericValue NumericValue::real(double value)
+{
+    return NumericValue(false, 0, value);
+}
+
+std::int64_t NumericValue::integerValue() const
+{
+    return integral_ ? integer_ : static_cast<std::int64_t>(real_);
+}
+
+double NumericValue::doubleValue() const
+{
+    return integral_ ? static_cast<double>(integer_) : real_;
+}
+
+NumericValue NumericValue::operator+(const NumericValue &other) const
+{
+    if (integral_ && other.integral_) {
+        bool overflows = other.integer_ > 0 ? integer_ > std::numeric_limits<std::int64_t>::max() - other.integer_
+                                            : integer_ < std::numeric_limits<std::int64_t>::min() - other.integer_;
+
+        if (!overflows) return integer(integer_ + other.integer_);
+    }
+
+    return real(doubleValue() + other.doubleValue());
+}
+
+bool NumericValue::operator==(const NumericValue &other) const
+{
+    if (integral_ && other.integral_) return integer_ == other.integer_;
+
+    return doubleValue() == other.doubleValue();
+}
+
+} // namespace apx
@@ -0,0 +1,95 @@
+//
+//  RateLimits.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/RateLimits.h"
+
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+
+namespace apx {
+
+namespace {
+
+std::string trimmed(const std::string &value)
+{
+    static const char *const whitespace = " \t";
+    std::string::size_type begin = value.find_first_not_of(whitespace);
+
+    if (begin == std::string::npos) return std::string();
+
+    return value.substr(begin, value.find_last_not_of(whitespace) - begin + 1);
+}
+
+bool parseLimit(const std::string &text, unsigned &limit)
+{
+    if (text.empty() || text[0] == '-' || text[0] == '+') return false;
+
+    char *end = NULL;
+    errno = 0;
+    unsigned long parsed = std::strtoul(text.c_str(), &end, 10);
+
+    if (errno || *end != '\0' || parsed > UINT_MAX) return false;
+
+    limit = static_cast<unsigned>(parsed);
+
+    return true;
+}
+
+bool parseInterval(const std::string &text, double &interval)
+{
+    if (text.empty()) return false;
+
+    char *end = NULL;
+    errno = 0;
+    double parsed = std::strtod(text.c_str(), &end);
+
+    if (errno || *end != '\0' || !std::isfinite(parsed) || parsed <= 0.0) return false;
+
+    interval = parsed;
+
+    return true;
+}
+
+} // namespace
+
+bool parseRateLimits(const std::string &value, std::vector<RateLimit> &limits)
+{
+    std::vector<RateLimit> parsed;
+    std::string::size_type start = 0;
+
+    while (start <= value.size()) {
+        std::string::size_type comma = value.find(',', start);
+        std::string entry = trimmed(value.substr(start, comma == std::string::npos ? std::string::npos : comma - start));
+
+        start = comma == std::string::npos ? value.size() + 1 : comma + 1;
+
+        if (entry.empty()) continue;
+
+        std::string::size_type equals = entry.find('=');
+        std::string::size_type slash = entry.find('/', equals == std::string::npos ? 0 : equals);
+
+        if (equals == std::string::npos || entry.find('=', equals + 1) != std::string::npos) return false;
+        if (slash == std::string::npos || entry.find('/', slash + 1) != std::string::npos) return false;
+
+        RateLimit limit;
+        limit.name = trimmed(entry.substr(0, equals));
+
+        if (!parseLimit(trimmed(entry.substr(equals + 1, slash - equals - 1)), limit.limit)) return false;
+        if (!parseInterval(trimmed(entry.substr(slash + 1)), limit.interval)) return false;
+
+        parsed.push_back(limit);
+    }
+
+    limits.swap(parsed);
+
+    return true;
+}
+
+} // namespace apx
@@ -0,0 +1,62 @@
+//
+//  RecentKeys.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/RecentKeys.h"
+
+namespace apx {
+
+RecentKeys::RecentKeys(std::size_t capacity)
+    : capacity_(capacity ? capacity : 1), nextSlot_(0)
+{
+    keys_.reserve(capacity_);
+    ring_.reserve(capacity_);
+}
+
+bool RecentKeys::insert(const std::string &key)
+{
+    if (keys_.count(key)) return false;
+
+    // Once the ring is full, the slot we write into holds the oldest key.
+    if (ring_.size() < capacity_) {
+        ring_.push_back(key);
+    } else {
+        keys_.erase(ring_[nextSlot_]);
+        ring_[nextSlot_] = key;
+    }
+
+    keys_.insert(key);
+    nextSlot_ = (nextSlot_ + 1) % capacity_;
+
+    return true;
+}
+
+bool RecentKeys::contains(const std::string &key) const
+{
+    return keys_.count(key) != 0;
+}
+
+void RecentKeys::clear()
+{
+    keys_.clear();
+    ring_.clear();
+    nextSlot_ = 0;
+}
+
+std::vector<std::string> RecentKeys::keysOldestFirst() const
+{
+    std::vector<std::string> keys;
+    keys.reserve(ring_.size());
+
+    for (std::size_t i = 0; i < ring_.size(); i++) {
+        keys.push_back(ring_[ring_.size() < capacity_ ? i : (nextSlot_ + i) % capacity_]);
+    }
+
+    return keys;
+}
+
+} // namespace apx
@@ -0,0 +1,72 @@
+//
+//  TokenBucket.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/TokenBucket.h"
+
+#include <algorithm>
+
+namespace apx {
+
+namespace {
+
+const double kMinimumInterval = 0.001;
+const double kNanosecondsPerSecond = 1e9;
+
+} // namespace
+
+TokenBucket::TokenBucket(unsigned limit, double interval, std::uint64_t now)
+    : limit_(limit), interval_(std::max(interval, kMinimumInterval)), tokens_(limit), refilledAt_(now)
+{
+}
+
+void TokenBucket::setLimit(unsigned limit, double interval, std::uint64_t now)
+{
+    refill(now);
+
+    limit_ = limit;
+    interval_ = std::max(interval, kMinimumInterval);
+    tokens_ = std::min(tokens_, static_cast<double>(limit));
+}
+
+bool TokenBucket::consume(std::uint64_t now)
+{
+    if (limit_ == 0) return true;
+
+    refill(now);
+
+    if (tokens_ < 1.0) return false;
+
+    tokens_ -= 1.0;
+
+    return true;
+}
+
+double TokenBucket::delayUntilToken(std::uint64_t now)
+{
+    if (limit_ == 0) return 0.0;
+
+    refill(now);
+
+    if (tokens_ >= 1.0) return 0.0;
+
+    return (1.0 - tokens_) * interval_ / limit_;
+}
+
+void TokenBucket::refill(std::uint64_t now)
+{
+    // Refilled lazily, by the time passed since the last refill, rather than by a timer. A clock going backwards adds nothing.
+    double elapsed = now > refilledAt_ ? static_cast<double>(now - refilledAt_) / kNanosecondsPerSecond : 0.0;
+
+    refilledAt_ = std::max(now, refilledAt_);
+
+    if (limit_ == 0) return;
+
+    tokens_ = std::min(tokens_ + elapsed * limit_ / interval_, static_cast<double>(limit_));
+}
+
+} // namespace apx
@@ -0,0 +1,82 @@
+//
+//  InboxDiffTests.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/InboxDiff.h"
+#include "TestHarness.h"
+
+using apx::InboxChanges;
+using apx::diffInbox;
+
+namespace {
+
+typedef std::vector<std::int64_t> IDs;
+typedef std::vector<std::size_t> Indexes;
+
+bool alwaysEqual(std::size_t, std::size_t)
+{
+    return true;
+}
+
+} // namespace
+
+APX_TEST(testIdenticalSnapshotsHaveNoChanges)
+{
+    IDs ids = { 1, 2, 3 };
+
+    APX_CHECK(diffInbox(ids, ids, alwaysEqual).empty());
+}
+
+APX_TEST(testInsertsAndDeletes)
+{
+    InboxChanges changes = diffInbox(IDs{ 1, 2, 3 }, IDs{ 4, 1, 3 }, alwaysEqual);
+
+    APX_CHECK(changes.deleted == Indexes{ 1 });
+    APX_CHECK(changes.inserted == Indexes{ 0 });
+    APX_CHECK(changes.moves.empty());
+    APX_CHECK(changes.updated.empty());
+}
+
+APX_TEST(testMovedRowIsTheOneOutOfOrder)
+{
+    InboxChanges changes = diffInbox(IDs{ 1, 2, 3, 4 }, IDs{ 4, 1, 2, 3 }, alwaysEqual);
+
+    APX_CHECK(changes.moves.size() == 1);
+    APX_CHECK(changes.moves[0] == std::make_pair(std::size_t(3), std::size_t(0)));
+    APX_CHECK(changes.deleted.empty() && changes.inserted.empty());
+}
+
+APX_TEST(testChangedRowsWhichStayAreUpdatedByOldIndex)
+{
+    InboxChanges changes = diffInbox(IDs{ 1, 2, 3 }, IDs{ 2, 3 }, [](std::size_t oldIndex, std::size_t) {
+        return oldIndex != 2;
+    });
+
+    APX_CHECK(changes.deleted == Indexes{ 0 });
+    APX_CHECK(changes.updated == Indexes{ 2 });
+}
+
+APX_TEST(testDuplicatesAreInsertedAndDeleted)
+{
+    InboxChanges changes = diffInbox(IDs{ 1, 1 }, IDs{ 1, 1, 1 }, alwaysEqual);
+
+    APX_CHECK(changes.deleted == Indexes{ 1 });
+    APX_CHECK(changes.inserted == (Indexes{ 1, 2 }));
+}
+
+APX_TEST(testLongestIncreasingSubsequence)
+{
+    std::vector<bool> marks = apx::longestIncreasingSubsequence(Indexes{ 3, 0, 1, 4, 2 });
+
+    APX_CHECK(marks == (std::vector<bool>{ false, true, true, false, true }));
+    APX_CHECK(apx::longestIncreasingSubsequence(Indexes()).empty());
+}
+
+int main()
+{
+    return APX_RUN_TESTS();
+}
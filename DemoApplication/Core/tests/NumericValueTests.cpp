@@ -0,0 +1,50 @@
+//
+//  NumericValueTests.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/NumericValue.h"
+#include "TestHarness.h"
+
+#include <limits>
+
+using apx::NumericValue;
+
+APX_TEST(testIntegersStayIntegral)
+{
+    NumericValue sum = NumericValue::integer(9007199254740993LL) + NumericValue::integer(1);
+
+    APX_CHECK(sum.isIntegral());
+    APX_CHECK(sum.integerValue() == 9007199254740994LL);
+}
+
+APX_TEST(testRealOperandMakesARealSum)
+{
+    NumericValue sum = NumericValue::integer(1) + NumericValue::real(0.5);
+
+    APX_CHECK(!sum.isIntegral());
+    APX_CHECK(sum.doubleValue() == 1.5);
+}
+
+APX_TEST(testOverflowFallsBackToReal)
+{
+    NumericValue sum = NumericValue::integer(std::numeric_limits<std::int64_t>::max()) + NumericValue::integer(1);
+    NumericValue difference = NumericValue::integer(std::numeric_limits<std::int64_t>::min()) + NumericValue::integer(-1);
+
+    APX_CHECK(!sum.isIntegral() && sum.doubleValue() > 0.0);
+    APX_CHECK(!difference.isIntegral() && difference.doubleValue() < 0.0);
+}
+
+APX_TEST(testEquality)
+{
+    APX_CHECK(NumericValue::integer(2) == NumericValue::real(2.0));
+    APX_CHECK(!(NumericValue::integer(2) == NumericValue::integer(3)));
+}
+
+int main()
+{
+    return APX_RUN_TESTS();
+}
@@ -0,0 +1,49 @@
+//
+//  RateLimitsTests.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/RateLimits.h"
+#include "TestHarness.h"
+
+using apx::RateLimit;
+using apx::parseRateLimits;
+
+APX_TEST(testParsesEveryEntry)
+{
+    std::vector<RateLimit> limits;
+
+    APX_CHECK(parseRateLimits(" tags=10/60, custom_fields = 30 / 0.5 ,", limits));
+    APX_CHECK(limits.size() == 2);
+    APX_CHECK(limits[0].name == "tags" && limits[0].limit == 10 && limits[0].interval == 60.0);
+    APX_CHECK(limits[1].name == "custom_fields" && limits[1].limit == 30 && limits[1].interval == 0.5);
+}
+
+APX_TEST(testEmptyValueHasNoLimits)
+{
+    std::vector<RateLimit> limits;
+
+    APX_CHECK(parseRateLimits("", limits));
+    APX_CHECK(limits.empty());
+}
+
+APX_TEST(testMalformedValueLeavesLimitsUntouched)
+{
+    std::vector<RateLimit> limits;
+    parseRateLimits("tags=1/1", limits);
+
+    const char *malformed[] = { "tags=10/60, alias", "tags=-1/60", "tags=1/0", "tags=1/60/2", "tags=a/60", "tags=1/nan", "a=b=1/60" };
+
+    for (const char *value : malformed) {
+        APX_CHECK(!parseRateLimits(value, limits));
+        APX_CHECK(limits.size() == 1 && limits[0].name == "tags");
+    }
+}
+
+int main()
+{
+    return APX_RUN_TESTS();
+}
@@ -0,0 +1,78 @@
+//
+//  RecentKeysTests.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/RecentKeys.h"
+#include "TestHarness.h"
+
+using apx::RecentKeys;
+
+APX_TEST(testDuplicateIsRejected)
+{
+    RecentKeys keys(4);
+
+    APX_CHECK(keys.insert("1"));
+    APX_CHECK(!keys.insert("1"));
+    APX_CHECK(keys.contains("1"));
+}
+
+APX_TEST(testOldestKeyIsEvicted)
+{
+    RecentKeys keys(2);
+
+    keys.insert("1");
+    keys.insert("2");
+    keys.insert("3");
+
+    APX_CHECK(!keys.contains("1"));
+    APX_CHECK(keys.contains("2") && keys.contains("3"));
+    APX_CHECK(keys.size() == 2);
+}
+
+APX_TEST(testOldestFirstOrderRestoresEviction)
+{
+    RecentKeys keys(3);
+
+    for (const char *key : { "1", "2", "3", "4" }) keys.insert(key);
+
+    APX_CHECK(keys.keysOldestFirst() == (std::vector<std::string>{ "2", "3", "4" }));
+
+    RecentKeys restored(3);
+
+    for (const std::string &key : keys.keysOldestFirst()) restored.insert(key);
+
+    restored.insert("5");
+
+    APX_CHECK(!restored.contains("2"));
+    APX_CHECK(restored.contains("3"));
+}
+
+APX_TEST(testZeroCapacityHoldsOneKey)
+{
+    RecentKeys keys(0);
+
+    APX_CHECK(keys.capacity() == 1);
+    APX_CHECK(keys.insert("1"));
+    APX_CHECK(keys.insert("2"));
+    APX_CHECK(!keys.contains("1"));
+}
+
+APX_TEST(testClear)
+{
+    RecentKeys keys(2);
+
+    keys.insert("1");
+    keys.clear();
+
+    APX_CHECK(!keys.contains("1"));
+    APX_CHECK(keys.keysOldestFirst().empty());
+}
+
+int main()
+{
+    return APX_RUN_TESTS();
+}
@@ -0,0 +1,84 @@
+//
+//  TestHarness.h
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#ifndef APX_TEST_HARNESS_H
+#define APX_TEST_HARNESS_H
+
+// Just enough of a test framework for ctest, so the core builds without dependencies. Every test executable defines its
+// cases with APX_TEST and returns APX_RUN_TESTS() from main, a failing APX_CHECK fails the case and the executable.
+
+#include <cstdio>
+#include <vector>
+
+namespace apx {
+namespace test {
+
+typedef void (*TestFunction)();
+
+struct TestCase {
+    const char *name;
+    TestFunction function;
+};
+
+inline std::vector<TestCase> &testCases()
+{
+    static std::vector<TestCase> cases;
+    return cases;
+}
+
+inline int &failureCount()
+{
+    static int failures = 0;
+    return failures;
+}
+
+struct Registration {
+    Registration(const char *name, TestFunction function)
+    {
+        TestCase testCase = { name, function };
+        testCases().push_back(testCase);
+    }
+};
+
+inline int runTests()
+{
+    int failedCases = 0;
+
+    for (std::size_t i = 0; i < testCases().size(); i++) {
+        int failuresBefore = failureCount();
+        testCases()[i].function();
+
+        bool failed = failureCount() != failuresBefore;
+        failedCases += failed ? 1 : 0;
+        std::printf("%s %s\n", failed ? "FAIL" : "ok  ", testCases()[i].name);
+    }
+
+    std::printf("%d of %lu failed\n", failedCases, static_cast<unsigned long>(testCases().size()));
+
+    return failedCases ? 1 : 0;
+}
+
+} // namespace test
+} // namespace apx
+
+#define APX_TEST(name) \
+    static void name(); \
+    static apx::test::Registration name##Registration(#name, name); \
+    static void name()
+
+#define APX_CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            apx::test::failureCount()++; \
+        } \
+    } while (0)
+
+#define APX_RUN_TESTS() apx::test::runTests()
+
+#endif
@@ -0,0 +1,76 @@
+//
+//  TokenBucketTests.cpp
+//  APXCore
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#include "apx/TokenBucket.h"
+#include "TestHarness.h"
+
+#include <cmath>
+
+using apx::TokenBucket;
+
+namespace {
+
+const std::uint64_t kSecond = 1000000000ULL;
+
+} // namespace
+
+APX_TEST(testBurstUpToTheLimit)
+{
+    TokenBucket bucket(3, 60.0, 0);
+
+    APX_CHECK(bucket.consume(0));
+    APX_CHECK(bucket.consume(0));
+    APX_CHECK(bucket.consume(0));
+    APX_CHECK(!bucket.consume(0));
+}
+
+APX_TEST(testRefillsAtTheRate)
+{
+    TokenBucket bucket(2, 10.0, 0);
+
+    bucket.consume(0);
+    bucket.consume(0);
+
+    APX_CHECK(std::fabs(bucket.delayUntilToken(0) - 5.0) < 1e-9);
+    APX_CHECK(!bucket.consume(4 * kSecond));
+    APX_CHECK(bucket.consume(5 * kSecond));
+}
+
+APX_TEST(testLowerLimitAppliesRightAway)
+{
+    TokenBucket bucket(10, 60.0, 0);
+
+    bucket.setLimit(1, 60.0, 0);
+
+    APX_CHECK(bucket.consume(0));
+    APX_CHECK(!bucket.consume(0));
+}
+
+APX_TEST(testZeroLimitLiftsIt)
+{
+    TokenBucket bucket(0, 60.0, 0);
+
+    for (int i = 0; i < 100; i++) APX_CHECK(bucket.consume(0));
+
+    APX_CHECK(bucket.delayUntilToken(0) == 0.0);
+}
+
+APX_TEST(testClockGoingBackwardsAddsNothing)
+{
+    TokenBucket bucket(1, 1.0, 10 * kSecond);
+
+    bucket.consume(10 * kSecond);
+
+    APX_CHECK(!bucket.consume(0));
+    APX_CHECK(!bucket.consume(10 * kSecond));
+}
+
+int main()
+{
+    return APX_RUN_TESTS();
+}
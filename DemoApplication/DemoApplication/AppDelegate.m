@@ -9,8 +9,28 @@
 #import "AppDelegate.h"
 #import <AppoxeeSDK/AppoxeeSDK.h>
 #import "APXRichContentViewController.h"
+#import "APXSchemeViewController.h"
+#import "APXInboxStore.h"
+#import "APXPushDeduplicator.h"
+#import "APXPushEventQueue.h"
+#import "APXRefreshCoalescer.h"
+#import "APXDeviceRegistrationFilter.h"
+#import "APXTransferScheduler.h"
+#import "APXContentPrefetcher.h"
+#import "APXPushActionExecutor.h"
+#import "APXDeepLinkRouter.h"
+#import "APXSharedStore.h"
+#import "APXWebViewPool.h"
+#import "APXLogger.h"
+#import "APXMetrics.h"
 
-@interface AppDelegate () <AppoxeeDelegate>
+static NSTimeInterval const kAPXExpiredMessagesCollectionBudget = 5.0;
+
+@interface AppDelegate () <AppoxeeNotificationDelegate>
+
+@property (nonatomic, strong) APXHistogram *pushParseTime;
+@property (nonatomic, strong) APXHistogram *pushDelegateTime;
+@property (nonatomic, strong) APXCounter *pushDuplicates;
 
 @end
 
@@ -18,11 +38,181 @@
 
 - (BOOL)application:(UIApplication *)application didFinishLaunchingWithOptions:(NSDictionary *)launchOptions
 {
+    self.pushParseTime = [[APXMetrics sharedMetrics] histogramNamed:APXMetricPushParseTime];
+    self.pushDelegateTime = [[APXMetrics sharedMetrics] histogramNamed:APXMetricPushDelegateTime];
+    self.pushDuplicates = [[APXMetrics sharedMetrics] counterNamed:APXMetricPushDuplicates];
+    
+    [self registerDeepLinks];
+    
+    // A link which launches the app is matched, and its screen created, while the app is still launching.
+    [[APXDeepLinkRouter sharedRouter] prepareURL:launchOptions[UIApplicationLaunchOptionsURLKey]];
+    
     [[Appoxee shared] engageAndAutoIntegrateWithLaunchOptions:launchOptions andDelegate:self];
     
+    [self exportConfig];
+    
+    // Web views are expensive to create, the pool creates the ones rich messages are shown in once the first frame is on screen.
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        [[APXWebViewPool sharedPool] prewarm];
+    });
+    
     return YES;
 }
 
+- (void)exportConfig
+{
+    // Extensions don't carry AppoxeeConfig.plist, they read the SDK configuration the app last launched with. Unchanged, it isn't written again.
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        
+        NSDictionary *config = [NSDictionary dictionaryWithContentsOfFile:[[NSBundle mainBundle] pathForResource:@"AppoxeeConfig" ofType:@"plist"]];
+        
+        if ([config[@"sdk"] isKindOfClass:[NSDictionary class]]) {
+            
+            [[APXSharedStore sharedStore] setObject:config[@"sdk"] forKey:APXSharedStoreConfigKey error:NULL];
+        }
+    });
+}
+
+- (void)applicationDidBecomeActive:(UIApplication *)application
+{
+    // The app is about to talk to the network anyway, a good time to send pending push events.
+    [[APXPushEventQueue sharedQueue] noteOutboundRequest];
+    [[APXPushActionExecutor sharedExecutor] resumePendingOperations];
+}
+
+- (void)applicationDidEnterBackground:(UIApplication *)application
+{
+    // Buffered log records would be lost if the app is terminated while suspended.
+    [[APXLogger sharedLogger] flush];
+}
+
+#pragma mark - Registration
+
+- (void)application:(UIApplication *)application didRegisterForRemoteNotificationsWithDeviceToken:(NSData *)deviceToken
+{
+    // APNS hands out the same token on every launch, only a changed device state is sent to Appoxee.
+    [[APXDeviceRegistrationFilter sharedFilter] didRegisterForRemoteNotificationsWithDeviceToken:deviceToken];
+}
+
+- (void)application:(UIApplication *)application didRegisterUserNotificationSettings:(UIUserNotificationSettings *)notificationSettings
+{
+    [[APXDeviceRegistrationFilter sharedFilter] didRegisterUserNotificationSettings:notificationSettings];
+}
+
+#pragma mark - Silent Push
+
+- (void)application:(UIApplication *)application didReceiveRemoteNotification:(NSDictionary *)userInfo fetchCompletionHandler:(void (^)(UIBackgroundFetchResult))completionHandler
+{
+    uint64_t start = APXMetricsNow();
+    APXPushNotification *pushNotification = [APXPushNotification notificationWithKeyedValues:userInfo];
+    [self.pushParseTime recordDurationSince:start];
+    
+    // The push is reported or synced for right away, deferred transfers can go along.
+    [[APXTransferScheduler sharedScheduler] noteNetworkActivity];
+    
+    if (pushNotification.isSilent && pushNotification.isTriggerUpdate) {
+        
+        // Handed to the SDK, every trigger would sync on its own. Campaigns sent back to back share a single sync instead,
+        // and completionHandler is called as soon as the sync it joined finished.
+        [[APXPushEventQueue sharedQueue] recordEventOfType:APXPushEventTypeReceived forNotification:pushNotification withIdentifier:nil];
+        [[APXRefreshCoalescer sharedCoalescer] requestRefreshWithFetchCompletionHandler:completionHandler];
+        return;
+    }
+    
+    [[Appoxee shared] didReceiveRemoteNotification:userInfo fetchCompletionHandler:completionHandler andNotifyCompletionWithBlock:^(NSError *appoxeeError, id data) {
+        
+        if (appoxeeError) {
+            
+            // The silent push did not originate from Appoxee, so calling the completionHandler is up to us.
+            completionHandler(UIBackgroundFetchResultNoData);
+        }
+    }];
+}
+
+#pragma mark - Push Actions
+
+- (void)application:(UIApplication *)application handleActionWithIdentifier:(NSString *)identifier forRemoteNotification:(NSDictionary *)userInfo completionHandler:(void (^)())completionHandler
+{
+    APXPushNotification *pushNotification = [APXPushNotification notificationWithKeyedValues:userInfo];
+    APXPushNotificationActionButton *button = [APXPushActionExecutor actionButtonWithIdentifier:identifier ofNotification:pushNotification];
+    
+    if (button) {
+        
+        [[APXTransferScheduler sharedScheduler] noteNetworkActivity];
+        [[APXPushEventQueue sharedQueue] recordEventOfType:APXPushEventTypeOpened forNotification:pushNotification withIdentifier:identifier];
+    }
+    
+    // Appoxee runs the button it handles as a whole, its foreground action and its background actions, the executor mustn't run them again.
+    // The fields it changed are read from Appoxee again once it's done.
+    void (^actionCompletionHandler)(void) = ^{
+        
+        [[APXPushActionExecutor sharedExecutor] invalidateFieldsOfActions:button.backgroundActions];
+        completionHandler();
+    };
+    
+    if ([[Appoxee shared] handleActionWithIdentifier:identifier forRemoteNotification:userInfo completionHandler:actionCompletionHandler]) return;
+    
+    // Otherwise tag and custom field actions run as one batch which reports back well within the time iOS grants, what isn't confirmed by then is journaled.
+    if (![[APXPushActionExecutor sharedExecutor] executeActions:button.backgroundActions completionHandler:completionHandler]) {
+        
+        completionHandler();
+    }
+}
+
+#pragma mark - Background Fetch
+
+- (void)application:(UIApplication *)application performFetchWithCompletionHandler:(void (^)(UIBackgroundFetchResult))completionHandler
+{
+    [[APXTransferScheduler sharedScheduler] noteNetworkActivity];
+    
+    // A fetch shortly after a trigger update shares its sync.
+    [[APXRefreshCoalescer sharedCoalescer] requestRefreshWithFetchCompletionHandler:^(UIBackgroundFetchResult result) {
+        
+        // We were woken up with network access, send the journaled push events and push actions before going back to sleep.
+        [[APXPushActionExecutor sharedExecutor] resumePendingOperations];
+        [[APXPushEventQueue sharedQueue] flushWithCompletionHandler:^(NSUInteger sentCount, NSError *error) {
+            
+            [self collectExpiredMessagesWithCompletionHandler:^{
+                
+                completionHandler(result);
+            }];
+        }];
+    }];
+}
+
+- (void)collectExpiredMessagesWithCompletionHandler:(void (^)(void))completionHandler
+{
+    // Nothing expires unless the Info.plist sets APXInboxRetention limits.
+    if (![APXInboxStore sharedStore].retentionPolicy) {
+        
+        completionHandler();
+        return;
+    }
+    
+    // Expired Inbox messages are deleted a few at a time, within a slice of the ~30 seconds iOS grants a fetch. The rest wait for the next one.
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        [[APXInboxStore sharedStore] reloadFromCacheWithCompletionHandler:^(NSError *appoxeeError, id data) {
+            
+            [[APXInboxStore sharedStore] collectExpiredMessagesWithTimeBudget:kAPXExpiredMessagesCollectionBudget completionHandler:^(NSUInteger collectedCount, BOOL finished) {
+                
+                completionHandler();
+            }];
+        }];
+    });
+}
+
+#pragma mark - Background Transfers
+
+- (void)application:(UIApplication *)application handleEventsForBackgroundURLSession:(NSString *)identifier completionHandler:(void (^)(void))completionHandler
+{
+    // Prefetched Inbox pages finished while the app was suspended or terminated, the prefetcher stores them and calls completionHandler once it's done.
+    if ([[APXContentPrefetcher sharedPrefetcher] handleEventsForBackgroundURLSession:identifier completionHandler:completionHandler]) return;
+    
+    completionHandler();
+}
+
 #pragma mark - Schemes
 
 - (BOOL)application:(UIApplication *)application openURL:(NSURL *)url sourceApplication:(NSString *)sourceApplication annotation:(id)annotation
@@ -39,22 +229,96 @@
     return YES;
 }
 
+- (void)registerDeepLinks
+{
+    // OpenViewController values and apx:// links name a screen by its storyboard identifier, i.e. @"APXTagsViewController" or @"apx://APXTagsViewController".
+    // Each is registered for apx:// too, for its literal to win over the apx:// fallback below.
+    NSArray *identifiers = @[@"APXTagsViewController", @"APXCustomFieldsViewController", @"APXAliasViewController", @"APXLogViewController"];
+    
+    for (NSString *identifier in identifiers) {
+        
+        for (NSString *pattern in @[identifier, [@"apx://" stringByAppendingString:identifier]]) {
+            
+            [[APXDeepLinkRouter sharedRouter] registerPattern:pattern viewControllerFactory:^UIViewController *(APXDeepLinkMatch *match) {
+                
+                return [[UIStoryboard storyboardWithName:@"Main" bundle:nil] instantiateViewControllerWithIdentifier:identifier];
+                
+            } handler:^(APXDeepLinkMatch *match) {
+                
+                [self showViewController:match.viewController];
+            }];
+        }
+    }
+    
+    // Any other apx:// link, apx://scheme/... included, is shown by the URL Scheme screen.
+    [[APXDeepLinkRouter sharedRouter] registerPattern:@"apx://*" viewControllerFactory:^UIViewController *(APXDeepLinkMatch *match) {
+        
+        UIStoryboard *storyboard = [UIStoryboard storyboardWithName:@"Main" bundle:nil];
+        
+        APXSchemeViewController *schemeController = [storyboard instantiateViewControllerWithIdentifier:@"APXSchemeViewController"];
+        schemeController.urlScheme = [match.URL absoluteString];
+        
+        return schemeController;
+        
+    } handler:^(APXDeepLinkMatch *match) {
+        
+        [self showViewController:match.viewController];
+    }];
+}
+
+- (void)showViewController:(UIViewController *)viewController
+{
+    UINavigationController *navigationController = (UINavigationController *)self.window.rootViewController;
+    
+    if (![navigationController isKindOfClass:[UINavigationController class]]) {
+        
+        return;
+    }
+    
+    [navigationController popToRootViewControllerAnimated:NO];
+    [navigationController pushViewController:viewController animated:YES];
+}
+
 - (void)handleScheme:(NSURL *)scheme
 {
-    [[NSUserDefaults standardUserDefaults] setObject:[scheme description] forKey:@"urlScheme"];
-    [[NSUserDefaults standardUserDefaults] synchronize];
-    [[NSNotificationCenter defaultCenter] postNotificationName:@"urlScheme" object:nil];
+    // The link is handed to its screen in memory, nothing is written on the way.
+    [[APXDeepLinkRouter sharedRouter] routeURL:scheme];
 }
 
-#pragma mark - AppoxeeDelegate
+#pragma mark - AppoxeeNotificationDelegate
 
-- (void)appoxeeManager:(AppoxeeManager *)manager handledRemoteNotification:(APXPushNotification *)pushNotification andIdentifer:(NSString *)actionIdentifier
+- (void)appoxee:(Appoxee *)appoxee handledRemoteNotification:(APXPushNotification *)pushNotification andIdentifer:(NSString *)actionIdentifier
 {
+    // The same push can reach us through more than one delivery path, we only act on it once.
+    uint64_t start = APXMetricsNow();
+    
+    if (![[APXPushDeduplicator sharedDeduplicator] shouldHandleNotification:pushNotification withIdentifier:actionIdentifier]) {
+        
+        [self.pushDuplicates increment];
+        APXLogDebug(APXLogSubsystemPush, @"Dropped duplicate delivery of push %ld", (long)pushNotification.uniqueID);
+        return;
+    }
+    
     // a push notification was recieved.
+    APXPushEventType eventType = (pushNotification.didLaunchApp || [actionIdentifier length]) ? APXPushEventTypeOpened : APXPushEventTypeReceived;
+    [[APXPushEventQueue sharedQueue] recordEventOfType:eventType forNotification:pushNotification withIdentifier:actionIdentifier];
+    
+    // The SDK opens OpenURLScheme links through application:openURL:, OpenViewController values are ours to route.
+    APXPushNotificationActionButtonAction *action = [APXPushActionExecutor actionButtonWithIdentifier:actionIdentifier ofNotification:pushNotification].foregroundActionButtonAction;
+    
+    if (action.todo == kAPXPushNotificationActionButtonActionTodoOpenViewController) {
+        
+        [[APXDeepLinkRouter sharedRouter] routeValue:action.value];
+    }
+    
+    [self.pushDelegateTime recordDurationSince:start];
 }
 
-- (void)appoxeeManager:(AppoxeeManager *)manager handledRichContent:(APXRichMessage *)richMessage didLaunchApp:(BOOL)didLaunch
+- (void)appoxee:(Appoxee *)appoxee handledRichContent:(APXRichMessage *)richMessage didLaunchApp:(BOOL)didLaunch
 {
+    // The SDK already stored the Rich Message, re-reading its cache is enough. Observers of the Inbox Store will receive only the new row.
+    [[APXInboxStore sharedStore] reloadFromCacheWithCompletionHandler:nil];
+    
     if (didLaunch) {
         
         // If a Rich Message launched the app, we will display its content.
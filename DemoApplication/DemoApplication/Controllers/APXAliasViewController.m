@@ -8,12 +8,14 @@
 
 #import "APXAliasViewController.h"
 #import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXAliasStore.h"
 
 @interface APXAliasViewController () <UITextFieldDelegate>
 
 @property (weak, nonatomic) IBOutlet UILabel *aliasTitleLable;
 @property (weak, nonatomic) IBOutlet UITextField *aliasTextField;
 @property (weak, nonatomic) IBOutlet UIActivityIndicatorView *activityIndicator;
+@property (nonatomic, strong) APXRequestHandle *aliasRequest;
 
 @end
 
@@ -37,12 +39,21 @@
     [self getAliasAndUpdateUI];
 }
 
+- (void)viewWillDisappear:(BOOL)animated
+{
+    [super viewWillDisappear:animated];
+    
+    // Nobody is left to see the alias.
+    [self.aliasRequest cancel];
+    [self.activityIndicator stopAnimating];
+}
+
 #pragma mark - UI
 
 - (void)updateUIWithAlias:(NSString *)alias
 {
     self.aliasTextField.text = @"";
-    self.aliasTitleLable.text = [NSString stringWithFormat:@"Alias: %@", alias];
+    self.aliasTitleLable.text = [NSString stringWithFormat:@"Alias: %@", alias ?: @""];
 }
 
 #pragma mark - IBAction
@@ -53,19 +64,21 @@
     
     [self.activityIndicator startAnimating];
     
-    [[Appoxee shared] setDeviceAlias:self.aliasTextField.text withCompletionHandler:^(NSError *appoxeeError, id data) {
+    [[APXAliasStore sharedStore] setDeviceAlias:self.aliasTextField.text withCompletionHandler:^(NSError *appoxeeError, id data) {
         
         [self.activityIndicator stopAnimating];
         
-        if (!appoxeeError) {
+        if (appoxeeError) {
             
-            [self updateUIWithAlias:self.aliasTextField.text];
-        
-        } else {
+            // The store rolled the alias back.
+            [self updateUIWithAlias:[APXAliasStore sharedStore].alias];
             
             [[[UIAlertView alloc] initWithTitle:@"Error" message:[appoxeeError description] delegate:nil cancelButtonTitle:@"OK" otherButtonTitles:nil] show];
         }
     }];
+    
+    // The write is applied locally right away, no need to wait for Appoxee or to read the alias back.
+    [self updateUIWithAlias:[APXAliasStore sharedStore].alias];
 }
 
 - (IBAction)removeAliasButtonPressed:(id)sender
@@ -74,19 +87,19 @@
     
     [self.activityIndicator startAnimating];
     
-    [[Appoxee shared] removeDeviceAliasWithCompletionHandler:^(NSError *appoxeeError, id data) {
+    [[APXAliasStore sharedStore] removeDeviceAliasWithCompletionHandler:^(NSError *appoxeeError, id data) {
        
         [self.activityIndicator stopAnimating];
         
-        if (!appoxeeError) {
+        if (appoxeeError) {
             
-            [self getAliasAndUpdateUI];
-        
-        } else {
+            [self updateUIWithAlias:[APXAliasStore sharedStore].alias];
             
             [[[UIAlertView alloc] initWithTitle:@"Error" message:[appoxeeError description] delegate:nil cancelButtonTitle:@"OK" otherButtonTitles:nil] show];
         }
     }];
+    
+    [self updateUIWithAlias:nil];
 }
 
 - (IBAction)clearAliasCache:(id)sender
@@ -95,7 +108,7 @@
     
     [self.activityIndicator startAnimating];
     
-    [[Appoxee shared] clearAliasCacheWithCompletionHandler:^(NSError *appoxeeError, id data) {
+    [[APXAliasStore sharedStore] clearAliasCacheWithCompletionHandler:^(NSError *appoxeeError, id data) {
         
         [self.activityIndicator stopAnimating];
         
@@ -114,16 +127,16 @@
 {
     [self.activityIndicator startAnimating];
     
-    [[Appoxee shared] getDeviceAliasWithCompletionHandler:^(NSError *appoxeeError, id data) {
+    [self.aliasRequest cancel];
+    
+    // Answered right away when the alias is known locally, only an unknown alias costs a request.
+    self.aliasRequest = [[APXAliasStore sharedStore] getDeviceAliasWithCompletionHandler:^(NSError *appoxeeError, id data) {
         
         [self.activityIndicator stopAnimating];
         
         if (!appoxeeError) {
             
-            if ([data isKindOfClass:[NSString class]]) {
-                
-                [self updateUIWithAlias:data];
-            }
+            [self updateUIWithAlias:data];
         
         } else {
             
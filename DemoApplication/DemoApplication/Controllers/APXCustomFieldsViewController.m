@@ -8,6 +8,7 @@
 
 #import "APXCustomFieldsViewController.h"
 #import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXCustomFieldsStore.h"
 
 @interface APXCustomFieldsViewController () <UITextFieldDelegate>
 
@@ -48,7 +49,7 @@
 {
     [self.activityIndicator startAnimating];
     
-    [[Appoxee shared] setStringValue:string forKey:key withCompletionHandler:^(NSError * _Nullable appoxeeError, id  _Nullable data) {
+    [[APXCustomFieldsStore sharedStore] setCustomFields:@{key : string ?: @""} completionHandler:^(NSError *appoxeeError, id data) {
         
         [self.activityIndicator stopAnimating];
         
@@ -71,7 +72,7 @@
 {
     [self.activityIndicator startAnimating];
     
-    [[Appoxee shared] setDateValue:date forKey:key withCompletionHandler:^(NSError * _Nullable appoxeeError, id  _Nullable data) {
+    [[APXCustomFieldsStore sharedStore] setCustomFields:@{key : date} completionHandler:^(NSError *appoxeeError, id data) {
         
         [self.activityIndicator stopAnimating];
         
@@ -100,7 +101,7 @@
         
         [self.activityIndicator startAnimating];
         
-        [[Appoxee shared] setNumberValue:possibleNumber forKey:key withCompletionHandler:^(NSError * _Nullable appoxeeError, id  _Nullable data) {
+        [[APXCustomFieldsStore sharedStore] setCustomFields:@{key : possibleNumber} completionHandler:^(NSError *appoxeeError, id data) {
             
             [self.activityIndicator stopAnimating];
             
@@ -198,7 +199,7 @@
         
         [self.activityIndicator startAnimating];
         
-        [[Appoxee shared] incrementNumericKey:self.keyTextField.text byNumericValue:possibleNumber withCompletionHandler:^(NSError * _Nullable appoxeeError, id  _Nullable data) {
+        [[APXCustomFieldsStore sharedStore] incrementCustomFieldForKey:self.keyTextField.text byValue:possibleNumber completionHandler:^(NSError *appoxeeError, id data) {
             
             [self.activityIndicator stopAnimating];
             
@@ -229,7 +230,17 @@
         
         [self.activityIndicator startAnimating];
         
-        [[Appoxee shared] fetchCustomFieldByKey:self.keyTextField.text withCompletionHandler:^(NSError *appoxeeError, id data) {
+        // Several keys can be read at once, separated by commas.
+        NSMutableArray *keys = [[NSMutableArray alloc] init];
+        
+        for (NSString *component in [self.keyTextField.text componentsSeparatedByString:@","]) {
+            
+            NSString *key = [component stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+            
+            if ([key length]) [keys addObject:key];
+        }
+        
+        [[APXCustomFieldsStore sharedStore] fetchCustomFieldsForKeys:keys completionHandler:^(NSError *appoxeeError, id data) {
             
             [self.activityIndicator stopAnimating];
             
@@ -237,10 +248,21 @@
                 
                 NSDictionary *dictionary = (NSDictionary *)data;
                 
-                NSString *key = [[dictionary allKeys] firstObject];
-                id value = dictionary[key];
-                
-                self.valueTextField.text = [value description];
+                if ([keys count] == 1) {
+                    
+                    self.valueTextField.text = [dictionary[[keys firstObject]] description];
+                    
+                } else {
+                    
+                    NSMutableArray *pairs = [[NSMutableArray alloc] initWithCapacity:[keys count]];
+                    
+                    for (NSString *key in keys) {
+                        
+                        if (dictionary[key]) [pairs addObject:[NSString stringWithFormat:@"%@: %@", key, dictionary[key]]];
+                    }
+                    
+                    self.valueTextField.text = [pairs componentsJoinedByString:@", "];
+                }
                 
             } else {
                 
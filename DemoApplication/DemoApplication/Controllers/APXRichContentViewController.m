@@ -7,10 +7,12 @@
 //
 
 #import "APXRichContentViewController.h"
+#import "APXWebViewPool.h"
 
 @interface APXRichContentViewController () <UIWebViewDelegate>
 
-@property (weak, nonatomic) IBOutlet UIWebView *webView;
+@property (weak, nonatomic) IBOutlet UIWebView *webView; // only marks where the pooled web view goes
+@property (nonatomic, strong) UIWebView *contentWebView;
 @property (weak, nonatomic) IBOutlet UIActivityIndicatorView *activityIndicator;
 
 @end
@@ -19,11 +21,9 @@
 
 #pragma mark - View Life Cycle
 
-- (void)viewDidLoad:(BOOL)animated
+- (void)dealloc
 {
-    [super viewDidLoad];
-    
-    self.webView.delegate = self;
+    [[APXWebViewPool sharedPool] recycleWebView:self.contentWebView];
 }
 
 - (void)viewWillAppear:(BOOL)animated
@@ -37,9 +37,15 @@
 
 - (void)updateUI
 {
-    NSURLRequest *request = [[NSURLRequest alloc] initWithURL:[NSURL URLWithString:self.html]];
+    if (self.contentWebView) return;
+    
+    __weak typeof(self) weakSelf = self;
+    self.contentWebView = [[APXWebViewPool sharedPool] webViewForURL:[NSURL URLWithString:self.html] delegate:self completionHandler:^(UIWebView *webView, NSError *error) {
+        
+        [weakSelf.activityIndicator stopAnimating];
+    }];
     
-    [self.webView loadRequest:request];
+    [APXWebViewPool installWebView:self.contentWebView inPlaceOfView:self.webView];
 }
 
 #pragma mark - IBActions
@@ -9,12 +9,15 @@
 #import "APXTagsViewController.h"
 #import "APXTagTableViewCell.h"
 #import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXRequestScheduler.h"
+#import "APXRateLimitedClient.h"
 
 @interface APXTagsViewController () <UITableViewDataSource, UITableViewDelegate, APXTagTableViewCellDelegate>
 
 @property (weak, nonatomic) IBOutlet UITableView *tableView;
 @property (nonatomic, strong) NSArray *applicationTags;
 @property (nonatomic, strong) NSArray *deviceTags;
+@property (nonatomic, strong) APXRequestHandle *tagsRequest;
 
 @end
 
@@ -36,17 +39,34 @@
     [self updateUI];
 }
 
+- (void)viewWillDisappear:(BOOL)animated
+{
+    [super viewWillDisappear:animated];
+    
+    [self.tagsRequest cancel];
+}
+
 #pragma mark - UI
 
 - (void)updateUI
 {
-    [[Appoxee shared] fetchApplicationTags:^(NSError *appoxeeError, id data) {
+    [self.tagsRequest cancel];
+    
+    self.tagsRequest = [[APXRequestScheduler sharedScheduler] scheduleRequest:^(AppoxeeCompletionHandler done) {
+        
+        [[Appoxee shared] fetchApplicationTags:done];
+        
+    } inLane:APXRequestLaneUserInteractive completion:^(NSError *appoxeeError, id data) {
         
         if (!appoxeeError && [data isKindOfClass:[NSArray class]]) {
             
             self.applicationTags = (NSArray *)data;
             
-            [[Appoxee shared] fetchDeviceTags:^(NSError *appoxeeError, id data) {
+            self.tagsRequest = [[APXRequestScheduler sharedScheduler] scheduleRequest:^(AppoxeeCompletionHandler done) {
+                
+                [[Appoxee shared] fetchDeviceTags:done];
+                
+            } inLane:APXRequestLaneUserInteractive completion:^(NSError *appoxeeError, id data) {
                 
                 if (!appoxeeError && [data isKindOfClass:[NSArray class]]) {
                     
@@ -116,26 +136,34 @@
     
     if (switcher.isOn) {
         
-        [[Appoxee shared] addTagsToDevice:tags withCompletionHandler:^(NSError *appoxeeError, id data) {
+        [[APXRateLimitedClient sharedClient] addTagsToDevice:tags andRemove:nil withCompletionHandler:^(NSError *appoxeeError, id data) {
             
-            if (appoxeeError) {
+            // Deferred changes may be answered off the main queue.
+            dispatch_async(dispatch_get_main_queue(), ^{
                 
-                [[[UIAlertView alloc] initWithTitle:@"Error" message:[appoxeeError description] delegate:nil cancelButtonTitle:@"OK" otherButtonTitles:nil] show];
-            }
-            
-            [self updateUI];
+                if (appoxeeError) {
+                    
+                    [[[UIAlertView alloc] initWithTitle:@"Error" message:[appoxeeError description] delegate:nil cancelButtonTitle:@"OK" otherButtonTitles:nil] show];
+                }
+                
+                [self updateUI];
+            });
         }];
         
     } else {
      
-        [[Appoxee shared] removeTagsFromDevice:tags withCompletionHandler:^(NSError *appoxeeError, id data) {
+        [[APXRateLimitedClient sharedClient] addTagsToDevice:nil andRemove:tags withCompletionHandler:^(NSError *appoxeeError, id data) {
             
-            if (appoxeeError) {
+            // Deferred changes may be answered off the main queue.
+            dispatch_async(dispatch_get_main_queue(), ^{
                 
-                [[[UIAlertView alloc] initWithTitle:@"Error" message:[appoxeeError description] delegate:nil cancelButtonTitle:@"OK" otherButtonTitles:nil] show];
-            }
-            
-            [self updateUI];
+                if (appoxeeError) {
+                    
+                    [[[UIAlertView alloc] initWithTitle:@"Error" message:[appoxeeError description] delegate:nil cancelButtonTitle:@"OK" otherButtonTitles:nil] show];
+                }
+                
+                [self updateUI];
+            });
         }];
     }
 }
@@ -7,10 +7,12 @@
 //
 
 #import "APXWebViewViewController.h"
+#import "APXWebViewPool.h"
 
 @interface APXWebViewViewController () <UIWebViewDelegate>
 
-@property (weak, nonatomic) IBOutlet UIWebView *webView;
+@property (weak, nonatomic) IBOutlet UIWebView *webView; // only marks where the pooled web view goes
+@property (nonatomic, strong) UIWebView *contentWebView;
 @property (weak, nonatomic) IBOutlet UIActivityIndicatorView *activityIndicator;
 
 @end
@@ -19,11 +21,9 @@
 
 #pragma mark - View Life Cycle
 
-- (void)viewDidLoad:(BOOL)animated
+- (void)dealloc
 {
-    [super viewDidLoad];
-    
-    self.webView.delegate = self;
+    [[APXWebViewPool sharedPool] recycleWebView:self.contentWebView];
 }
 
 - (void)viewWillAppear:(BOOL)animated
@@ -38,8 +38,16 @@
 #pragma mark - UI
 
 - (void)updateUI
-{    
-    [self.webView loadHTMLString:self.html baseURL:nil];
+{
+    if (self.contentWebView) return;
+    
+    __weak typeof(self) weakSelf = self;
+    self.contentWebView = [[APXWebViewPool sharedPool] webViewForHTML:self.html delegate:self completionHandler:^(UIWebView *webView, NSError *error) {
+        
+        [weakSelf.activityIndicator stopAnimating];
+    }];
+    
+    [APXWebViewPool installWebView:self.contentWebView inPlaceOfView:self.webView];
 }
 
 #pragma mark - UIWebViewDelegate
@@ -8,12 +8,16 @@
 
 #import "APXMessagDetailViewController.h"
 #import "APXMessagesMasterTableViewController.h"
+#import "APXWebViewPool.h"
 
 @interface APXMessagDetailViewController () <UIWebViewDelegate, UIGestureRecognizerDelegate>
 
 @property (nonatomic, readonly) BOOL isIpad;
-@property (weak, nonatomic) IBOutlet UIWebView *webView;
+@property (weak, nonatomic) IBOutlet UIWebView *webView; // only marks where the pooled web views go
 @property (weak, nonatomic) IBOutlet UIActivityIndicatorView *activityIndicator;
+@property (nonatomic, strong) UIWebView *messageWebView;
+@property (nonatomic, strong) UITapGestureRecognizer *tapGesture;
+@property (nonatomic) NSInteger displayedMessageID;
 @property (nonatomic) BOOL flag;
 
 @end
@@ -50,36 +54,59 @@
     [self updateUI];
 }
 
+- (void)dealloc
+{
+    [[APXWebViewPool sharedPool] recycleWebView:self.messageWebView];
+}
+
 #pragma mark - Initialization
 
 - (void)setup
 {
     self.title = @"";
     self.automaticallyAdjustsScrollViewInsets = NO; // to cause the WebView to be under the navigation bar.
-    self.webView.delegate = self;
     
-    UITapGestureRecognizer *tapGesture = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(webViewWasTaped:)];
-    tapGesture.delegate = self;
-    [self.webView addGestureRecognizer:tapGesture];
+    self.tapGesture = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(webViewWasTaped:)];
+    self.tapGesture.delegate = self;
 }
 
 #pragma mark - UI
 
 - (void)updateUI
+/*
+  We will display the Appoxee Message in a web view of the pool, one which the Master already prepared with the message if we are moving up or down.
+  A prepared web view has finished loading, so it's swapped in right away.
+*/
 {
-    // We will extract the Link / URL from the Appoxee Message and display it in a UIWebview.
+    if (!self.isViewLoaded || !self.message) return;
+    if (self.messageWebView && self.displayedMessageID == self.message.uniqueID) return;
     
-    NSString *string = self.message.messageLink;
-    NSURLRequest *request = [[NSURLRequest alloc] initWithURL:[NSURL URLWithString:string]];
-    [self.webView loadRequest:request];
+    self.displayedMessageID = self.message.uniqueID;
     
-    // we will auto hide the navigation bar on an iPhone
-    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(2.0f * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
-        if (!self.isIpad && !self.navigationController.isNavigationBarHidden) {
-            
-                [self webViewWasTaped:nil];
-        }
-    });
+    UIWebView *previousWebView = self.messageWebView;
+    
+    __weak typeof(self) weakSelf = self;
+    self.messageWebView = [[APXWebViewPool sharedPool] webViewForMessage:self.message delegate:self completionHandler:^(UIWebView *webView, NSError *error) {
+        
+        [weakSelf messageDidLoad];
+    }];
+    
+    [APXWebViewPool installWebView:self.messageWebView inPlaceOfView:self.webView];
+    [self.messageWebView addGestureRecognizer:self.tapGesture];
+    
+    [[APXWebViewPool sharedPool] recycleWebView:previousWebView];
+}
+
+- (void)messageDidLoad
+{
+    [self.view setUserInteractionEnabled:YES];
+    [self.activityIndicator stopAnimating];
+    
+    // we will auto hide the navigation bar on an iPhone, once there is something to look at.
+    if (!self.isIpad && !self.navigationController.isNavigationBarHidden) {
+        
+        [self webViewWasTaped:nil];
+    }
 }
 
 #pragma mark - Actions
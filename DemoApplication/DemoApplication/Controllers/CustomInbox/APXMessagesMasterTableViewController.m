@@ -10,15 +10,18 @@
 #import "APXMessagDetailViewController.h"
 #import <AppoxeeSDK/AppoxeeSDK.h>
 #import "APXMessageTableViewCell.h"
+#import "APXInboxStore.h"
+#import "APXWebViewPool.h"
 
 @interface APXMessagesMasterTableViewController () <UISplitViewControllerDelegate>
 
-@property (nonatomic, strong) NSMutableArray *messages; // of Type APXRichMessage
+@property (nonatomic, strong) NSArray *rows; // of Type APXInboxRow
 @property (nonatomic, readonly) BOOL isIpad;
 
 @property (nonatomic, strong) UIButton *upButton;
 @property (nonatomic, strong) UIButton *downButton;
 @property (nonatomic, strong) UIRefreshControl *refreshControler;
+@property (nonatomic, strong) id inboxObserver;
 
 // Only used with iOS7
 @property (nonatomic, strong) UIButton *backButton;
@@ -57,9 +60,34 @@
     
     [self setWantedContentSize];
     [self setupDisplay];
+    [self observeInbox];
     [self reloadMessages];
 }
 
+- (void)observeInbox
+/*
+  We start from the store's current snapshot, and from then on only apply the changes the store reports.
+  The list only holds the rows the store projects, messages are looked up once they are opened.
+*/
+{
+    if (self.inboxObserver) return;
+    
+    APXInboxStore *store = [APXInboxStore sharedStore];
+    
+    self.rows = store.rows;
+    
+    __weak typeof(self) weakSelf = self;
+    self.inboxObserver = [store addObserverWithBlock:^(APXInboxChangeSet *changes) {
+        
+        [weakSelf applyInboxChanges:changes];
+    }];
+}
+
+- (void)dealloc
+{
+    [[APXInboxStore sharedStore] removeObserver:self.inboxObserver];
+}
+
 - (void)setWantedContentSize
 {
     if (self.isIpad) {
@@ -104,33 +132,75 @@
 - (void)reloadMessages
 /*
   Method will Reload Messages, while displaying our Refresh Contoller.
-  We will only add messages that are considered as 'new', in order to provide an animation effect for 'new' messages.
+  The rows themselves are updated by the Inbox Store observer, which only animates the messages that actually changed.
 */
 {
     [self.refreshControler beginRefreshing];
     
-    [[Appoxee shared] refreshInboxWithCompletionHandler:^(NSError *appoxeeError, id data) {
+    [[APXInboxStore sharedStore] refreshWithCompletionHandler:^(NSError *appoxeeError, id data) {
         
         [self.refreshControler endRefreshing];
+    }];
+}
+
+- (void)applyInboxChanges:(APXInboxChangeSet *)changes
+/*
+  Apply a change set reported by the Inbox Store as a single batch update.
+  Moved rows keep their previous cell, so we reconfigure them once the batch is done.
+*/
+{
+    self.rows = [APXInboxStore sharedStore].rows;
+    
+    NSMutableArray *movedIndexPaths = [[NSMutableArray alloc] initWithCapacity:[changes.moves count]];
+    
+    [self.tableView beginUpdates];
+    [self.tableView deleteRowsAtIndexPaths:[self indexPathsForIndexes:changes.deletedIndexes] withRowAnimation:UITableViewRowAnimationFade];
+    [self.tableView insertRowsAtIndexPaths:[self indexPathsForIndexes:changes.insertedIndexes] withRowAnimation:UITableViewRowAnimationAutomatic];
+    [self.tableView reloadRowsAtIndexPaths:[self indexPathsForIndexes:changes.updatedIndexes] withRowAnimation:UITableViewRowAnimationNone];
+    
+    for (APXInboxChangeMove *move in changes.moves) {
         
-        if (!appoxeeError) {
-            
-            self.messages = data;
-            
-            [self.tableView reloadSections:[NSIndexSet indexSetWithIndex:0] withRowAnimation:UITableViewRowAnimationAutomatic];
-            
-            if (!self.messageDetailViewController.message && [self.messages count] && self.isIpad) {
-                
-                [self.tableView selectRowAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0] animated:YES scrollPosition:UITableViewScrollPositionNone];
-                [self.messageDetailViewController setMessage:[self.messages firstObject]];
-                [self updateButtonsByIndexPath:0];
-                
-            } else if ([self.messages count] == 0) {
-                
-                [self updateButtonsByIndexPath:-1];
-            }
-        }
+        NSIndexPath *toIndexPath = [NSIndexPath indexPathForRow:move.toIndex inSection:0];
+        [self.tableView moveRowAtIndexPath:[NSIndexPath indexPathForRow:move.fromIndex inSection:0] toIndexPath:toIndexPath];
+        [movedIndexPaths addObject:toIndexPath];
+    }
+    
+    [self.tableView endUpdates];
+    
+    if ([movedIndexPaths count]) {
+        
+        [self.tableView reloadRowsAtIndexPaths:movedIndexPaths withRowAnimation:UITableViewRowAnimationNone];
+    }
+    
+    if (!self.messageDetailViewController.message && [self.rows count] && self.isIpad) {
+        
+        [self.tableView selectRowAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:0] animated:YES scrollPosition:UITableViewScrollPositionNone];
+        [self.messageDetailViewController setMessage:[self messageAtIndex:0]];
+        [self updateButtonsByIndexPath:0];
+        
+    } else if ([self.rows count] == 0) {
+        
+        [self updateButtonsByIndexPath:-1];
+    }
+}
+
+- (APXRichMessage *)messageAtIndex:(NSInteger)index
+{
+    APXInboxRow *row = self.rows[index];
+    
+    return [[APXInboxStore sharedStore] messageWithID:row.uniqueID];
+}
+
+- (NSArray *)indexPathsForIndexes:(NSIndexSet *)indexes
+{
+    NSMutableArray *indexPaths = [[NSMutableArray alloc] initWithCapacity:[indexes count]];
+    
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop) {
+        
+        [indexPaths addObject:[NSIndexPath indexPathForRow:idx inSection:0]];
     }];
+    
+    return indexPaths;
 }
 
 - (void)updateButtonsByIndexPath:(NSInteger)messageIndex
@@ -145,20 +215,20 @@
         self.upButton.selected = YES;
         self.upButton.userInteractionEnabled = NO;
         
-        if (([self.messages count] - 1) > messageIndex) {
+        if (([self.rows count] - 1) > messageIndex) {
             
             self.downButton.selected = NO;
             self.downButton.userInteractionEnabled = YES;
         }
         
-    } else if (messageIndex > 0 && messageIndex < ([self.messages count] - 1)) {
+    } else if (messageIndex > 0 && messageIndex < ([self.rows count] - 1)) {
         
         self.upButton.selected = NO;
         self.upButton.userInteractionEnabled = YES;
         self.downButton.selected = NO;
         self.downButton.userInteractionEnabled = YES;
         
-    } else if (messageIndex == ([self.messages count] - 1) && messageIndex != -1){
+    } else if (messageIndex == ([self.rows count] - 1) && messageIndex != -1){
         
         self.upButton.selected = NO;
         self.upButton.userInteractionEnabled = YES;
@@ -175,6 +245,23 @@
     
     [self.tableView reloadRowsAtIndexPaths:@[[NSIndexPath indexPathForItem:messageIndex inSection:0]] withRowAnimation:UITableViewRowAnimationAutomatic];
     [self.tableView selectRowAtIndexPath:[NSIndexPath indexPathForItem:messageIndex inSection:0] animated:YES scrollPosition:UITableViewScrollPositionNone];
+    
+    [self prepareMessagesAroundIndex:messageIndex];
+}
+
+- (void)prepareMessagesAroundIndex:(NSInteger)messageIndex
+/*
+  Load the messages the 'up / down' buttons lead to in the background, so the Detail View Controller shows them without waiting.
+*/
+{
+    if (messageIndex < 0) return;
+    
+    NSMutableArray *neighbours = [[NSMutableArray alloc] initWithCapacity:2];
+    
+    if (messageIndex + 1 < (NSInteger)[self.rows count]) [neighbours addObject:[self messageAtIndex:messageIndex + 1]];
+    if (messageIndex > 0 && messageIndex - 1 < (NSInteger)[self.rows count]) [neighbours addObject:[self messageAtIndex:messageIndex - 1]];
+    
+    [[APXWebViewPool sharedPool] prepareMessages:neighbours];
 }
 
 #pragma mark - Segue
@@ -185,7 +272,7 @@
         
         NSIndexPath *indexPath = (NSIndexPath *)sender;
         [self updateButtonsByIndexPath:indexPath.row];
-        APXRichMessage *selectedMessage = self.messages[indexPath.row];
+        APXRichMessage *selectedMessage = [self messageAtIndex:indexPath.row];
         
         APXMessagDetailViewController *messageDetailController;
         id obj = [segue destinationViewController];
@@ -235,7 +322,7 @@
 
 - (NSInteger)tableView:(UITableView *)tableView numberOfRowsInSection:(NSInteger)section
 {
-    NSInteger count = [self.messages count];
+    NSInteger count = [self.rows count];
     
     count ? [self.navigationItem.leftBarButtonItem setEnabled:YES] : [self.navigationItem.leftBarButtonItem setEnabled:NO];
     
@@ -246,12 +333,13 @@
 {
     APXMessageTableViewCell *cell = [tableView dequeueReusableCellWithIdentifier:@"cell" forIndexPath:indexPath];
     
-    APXRichMessage *message = (APXRichMessage *)self.messages[indexPath.row];
+    // Everything the cell shows was computed when the store took its snapshot, scrolling only assigns strings.
+    APXInboxRow *row = self.rows[indexPath.row];
     
-    [cell setIsRead:message.isRead];
-    cell.messageTitle.text = [message.title stringByAppendingString:@"\n"];
-    cell.messageSubtitle.text = [message.content stringByAppendingString:@"\n"];
-    cell.messageTime.text = [message.postDate description];
+    [cell setIsRead:row.isRead];
+    cell.messageTitle.text = row.title;
+    cell.messageSubtitle.text = row.snippet;
+    cell.messageTime.text = row.postDateString;
     
     return cell;
 }
@@ -272,7 +360,7 @@
 {
     if (!tableView.isEditing) {
         
-        APXRichMessage *selectedMessage = self.messages[indexPath.row];
+        APXRichMessage *selectedMessage = [self messageAtIndex:indexPath.row];
         
          if (self.isIpad) {
              
@@ -283,6 +371,7 @@
              [self performSegueWithIdentifier:@"showDetail" sender:indexPath];
          }
         
+        [[APXInboxStore sharedStore] markMessageAsRead:selectedMessage];
         [self updateButtonsByIndexPath:indexPath.row];
         
         [self toggleMaster];
@@ -319,14 +408,10 @@
 {
     if (editingStyle == UITableViewCellEditingStyleDelete) {
         
-        APXRichMessage *message = self.messages[indexPath.row];
+        APXRichMessage *message = [self messageAtIndex:indexPath.row];
         
-        [self.messages removeObject:message];
-        [[Appoxee shared] deleteRichMessage:message withHandler:nil];
-                    
-        [self.tableView beginUpdates];
-        [tableView deleteRowsAtIndexPaths:@[indexPath] withRowAnimation:UITableViewRowAnimationFade];
-        [self.tableView endUpdates];
+        // The Inbox Store observer will remove the row.
+        [[APXInboxStore sharedStore] deleteMessages:@[message]];
     }
 }
 
@@ -439,7 +524,7 @@
 
 - (void)deleteSelectedItems:(UIBarButtonItem *)sender
 /*
-  Use Appoxee's API to delete Messages.
+  Use the Inbox Store to delete Messages, the rows are removed by the Inbox Store observer.
 */
 {
     NSArray *selectedIndexes = [self.tableView indexPathsForSelectedRows];
@@ -448,20 +533,12 @@
     
     for (NSIndexPath *indexPath in selectedIndexes) {
         
-        APXRichMessage *message = self.messages[indexPath.row];
+        APXRichMessage *message = [self messageAtIndex:indexPath.row];
         [tmpMessages addObject:message];
     }
     
-    for (APXRichMessage *message in tmpMessages) {
-        
-        [[Appoxee shared] deleteRichMessage:message withHandler:nil];
-    }
+    [[APXInboxStore sharedStore] deleteMessages:tmpMessages];
     
-    [self.messages removeObjectsInArray:tmpMessages];
-
-    [self.tableView beginUpdates];
-    [self.tableView deleteRowsAtIndexPaths:selectedIndexes withRowAnimation:UITableViewRowAnimationFade];
-    [self.tableView endUpdates];
     [self.tableView setEditing:NO animated:YES];
     [self updateButtonsState:self.navigationItem.leftBarButtonItem];
 }
@@ -523,7 +600,7 @@
         
         NSIndexPath *downIndex = [NSIndexPath indexPathForRow:(indexPath.row + 1) inSection:indexPath.section];
         
-        APXRichMessage *message = self.messages[downIndex.row];
+        APXRichMessage *message = [self messageAtIndex:downIndex.row];
         
         if (self.isIpad) {
             
@@ -537,6 +614,7 @@
             [detail setMessage:message];
         }
         
+        [[APXInboxStore sharedStore] markMessageAsRead:message];
         [self updateButtonsByIndexPath:downIndex.row];
     }
 }
@@ -553,7 +631,7 @@
         
         NSIndexPath *upIndex = [NSIndexPath indexPathForRow:(indexPath.row - 1) inSection:indexPath.section];
         
-        APXRichMessage *message = self.messages[upIndex.row];
+        APXRichMessage *message = [self messageAtIndex:upIndex.row];
         
         if (self.isIpad) {
             
@@ -567,6 +645,7 @@
             [detail setMessage:message];
         }
         
+        [[APXInboxStore sharedStore] markMessageAsRead:message];
         [self updateButtonsByIndexPath:upIndex.row];
     }
 }
@@ -654,10 +733,10 @@
     return _backButton;
 }
 
-- (NSMutableArray *)messages
+- (NSArray *)rows
 {
-    if (!_messages) _messages = [[NSMutableArray alloc] init];
-    return _messages;
+    if (!_rows) _rows = @[];
+    return _rows;
 }
 
 @end
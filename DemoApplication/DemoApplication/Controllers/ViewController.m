@@ -9,7 +9,6 @@
 #import "ViewController.h"
 #import <AppoxeeSDK/AppoxeeSDK.h>
 #import "APXWebViewViewController.h"
-#import "APXSchemeViewController.h"
 
 #define IS_OS_LESS_8 ([[[UIDevice currentDevice] systemVersion] floatValue] < 8.0)
 
@@ -22,37 +21,6 @@
 
 @implementation ViewController
 
-#pragma mark - View Life Cycle
-
-- (void)viewDidLoad
-{
-    [super viewDidLoad];
-    
-    [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(checkForUrlScheme) name:@"urlScheme" object:nil];
-}
-
-- (void)viewWillAppear:(BOOL)animated
-{
-    [super viewWillAppear:animated];
-    
-    [self checkForUrlScheme];
-}
-
-- (void)checkForUrlScheme
-{
-    NSString *urlScheme = [[NSUserDefaults standardUserDefaults] objectForKey:@"urlScheme"];
-    
-    if (urlScheme) {
-        
-        [[NSUserDefaults standardUserDefaults] setObject:nil forKey:@"urlScheme"];
-        [[NSUserDefaults standardUserDefaults] synchronize];
-        
-        [self.navigationController popToRootViewControllerAnimated:NO];
-        
-        [self performSegueWithIdentifier:@"APXSchemeViewController" sender:urlScheme];
-    }
-}
-
 #pragma mark - Segue
 
 - (void)prepareForSegue:(UIStoryboardSegue *)segue sender:(id)sender
@@ -61,11 +29,6 @@
         
         APXWebViewViewController *webview = (APXWebViewViewController *)segue.destinationViewController;
         [webview setHtml:(NSString *)sender];
-        
-    } else if ([segue.identifier isEqualToString:@"APXSchemeViewController"]) {
-        
-        APXSchemeViewController *schemeController = (APXSchemeViewController *)segue.destinationViewController;
-        schemeController.urlScheme = (NSString *)sender;
     }
 }
 
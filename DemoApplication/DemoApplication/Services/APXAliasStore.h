@@ -0,0 +1,44 @@
+//
+//  APXAliasStore.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXAppoxeeClient.h"
+#import "APXRequestScheduler.h"
+
+// Read-your-writes access to the device alias.
+// Setting or removing the alias takes effect locally right away, so a following get answers without waiting for, or racing, the write.
+// Only an unknown alias, or one Appoxee confirmed longer ago than the state's maximumAge, is read from Appoxee. See APXVersionedState for how
+// server answers are reconciled with local writes.
+@interface APXAliasStore : NSObject
+
+@property (nonatomic, strong, readonly) id<APXAppoxeeClient> client;
+
+// The alias as known locally, nil if it is unknown or unset.
+@property (nonatomic, copy, readonly) NSString *alias;
+
+// A store backed by [Appoxee shared] through [APXRateLimitedClient sharedClient], which keeps the confirmed alias across launches.
++ (instancetype)sharedStore;
+
+// Keeps the alias in memory.
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client;
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client fileURL:(NSURL *)fileURL;
+
+// handler is called on the main queue once Appoxee answered. A failed write rolls the alias back, unless it was written again meanwhile.
+- (void)setDeviceAlias:(NSString *)alias withCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)removeDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+// handler is called on the main queue, with an NSString or nil if no alias is set.
+// Returns nil if the alias was known locally, otherwise the handle of the server read.
+- (APXRequestHandle *)getDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+// Drops the local alias and the SDK's cache, the next get reads the alias from Appoxee.
+- (void)clearAliasCacheWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+@end
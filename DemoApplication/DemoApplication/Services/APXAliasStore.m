@@ -0,0 +1,166 @@
+//
+//  APXAliasStore.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXAliasStore.h"
+#import "APXVersionedState.h"
+#import "APXLogger.h"
+#import "APXRateLimitedClient.h"
+
+static NSString * const kAPXAliasStateKey = @"alias";
+
+@interface APXAliasStore ()
+
+@property (nonatomic, strong, readwrite) id<APXAppoxeeClient> client;
+@property (nonatomic, strong) APXVersionedState *state;
+
+@end
+
+@implementation APXAliasStore
+
+#pragma mark - Initialization
+
++ (instancetype)sharedStore
+{
+    static APXAliasStore *sharedStore = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSURL *directory = [[[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask] firstObject];
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        sharedStore = [[self alloc] initWithClient:[APXRateLimitedClient sharedClient] fileURL:[directory URLByAppendingPathComponent:@"APXDeviceAlias.plist"]];
+    });
+    
+    return sharedStore;
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client
+{
+    return [self initWithClient:client fileURL:nil];
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client fileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _client = client;
+        _state = [[APXVersionedState alloc] initWithFileURL:fileURL];
+    }
+    
+    return self;
+}
+
+#pragma mark - Getters
+
+- (NSString *)alias
+{
+    return [self aliasFromValue:[self.state objectForKey:kAPXAliasStateKey]];
+}
+
+- (NSString *)aliasFromValue:(id)value
+{
+    return [value isKindOfClass:[NSString class]] && [(NSString *)value length] ? value : nil;
+}
+
+#pragma mark - Writes
+
+- (void)setDeviceAlias:(NSString *)alias withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self writeValue:[alias length] ? [alias copy] : [NSNull null] request:^(AppoxeeCompletionHandler done) {
+        
+        [self.client setDeviceAlias:alias withCompletionHandler:done];
+        
+    } completionHandler:handler];
+}
+
+- (void)removeDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self writeValue:[NSNull null] request:^(AppoxeeCompletionHandler done) {
+        
+        [self.client removeDeviceAliasWithCompletionHandler:done];
+        
+    } completionHandler:handler];
+}
+
+- (void)writeValue:(id)value request:(APXRequestBlock)request completionHandler:(AppoxeeCompletionHandler)handler
+{
+    uint64_t version = [self.state applyLocalValues:@{kAPXAliasStateKey : value}];
+    
+    request(^(NSError *appoxeeError, id data) {
+        
+        if (!appoxeeError) {
+            
+            [self.state confirmValue:value forKey:kAPXAliasStateKey version:version];
+            
+        } else if ([self.state rejectValueForKey:kAPXAliasStateKey version:version]) {
+            
+            APXLogWarning(APXLogSubsystemNetwork, @"Alias write failed, rolled back: %@", appoxeeError);
+        }
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            
+            if (handler) handler(appoxeeError, data);
+        });
+    });
+}
+
+#pragma mark - Reads
+
+- (APXRequestHandle *)getDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    id value = [self.state objectForKey:kAPXAliasStateKey];
+    
+    if (value) {
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            
+            if (handler) handler(nil, [self aliasFromValue:value]);
+        });
+        
+        return nil;
+    }
+    
+    NSDictionary *versions = [self.state versionsForKeys:@[kAPXAliasStateKey]];
+    
+    return [[APXRequestScheduler sharedScheduler] scheduleRequest:^(AppoxeeCompletionHandler done) {
+        
+        [self.client getDeviceAliasWithCompletionHandler:done];
+        
+    } inLane:APXRequestLaneUserInteractive completion:^(NSError *appoxeeError, id data) {
+        
+        if (appoxeeError) {
+            
+            if (handler) handler(appoxeeError, data);
+            
+            return;
+        }
+        
+        NSString *alias = [self aliasFromValue:data];
+        [self.state applyServerValues:alias ? @{kAPXAliasStateKey : alias} : @{} readVersions:versions];
+        
+        // An alias written while the read was in flight wins over the server's answer.
+        if (handler) handler(nil, [self alias]);
+    }];
+}
+
+- (void)clearAliasCacheWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.state invalidateAllValues];
+    
+    [self.client clearAliasCacheWithCompletionHandler:^(NSError *appoxeeError, id data) {
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            
+            if (handler) handler(appoxeeError, data);
+        });
+    }];
+}
+
+@end
@@ -0,0 +1,58 @@
+//
+//  APXAppoxeeClient.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+// The part of the Appoxee API the Services talk to.
+// Services take an id<APXAppoxeeClient> instead of calling [Appoxee shared] directly, so their logic can be unit tested,
+// and measured, against a stand-in which answers without a device registration or a network.
+@protocol APXAppoxeeClient <NSObject>
+
+#pragma mark - Registration
+
+- (void)didRegisterForRemoteNotificationsWithDeviceToken:(NSData *)token;
+- (void)didRegisterUserNotificationSettings:(NSObject *)notificationSettings;
+- (void)deviceInformationwithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+#pragma mark - Background Fetch
+
+- (void)performFetchWithCompletionHandler:(void (^)(UIBackgroundFetchResult))fetchHandler andNotifyCompletionWithBlock:(AppoxeeCompletionHandler)completionBlock;
+
+#pragma mark - Inbox
+
+- (void)getRichMessagesWithHandler:(AppoxeeCompletionHandler)handler;
+- (void)deleteRichMessage:(APXRichMessage *)richMessage withHandler:(AppoxeeCompletionHandler)handler;
+- (void)refreshInboxWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+#pragma mark - Alias
+
+- (void)setDeviceAlias:(NSString *)alias withCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)removeDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)getDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)clearAliasCacheWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+#pragma mark - Tags
+
+- (void)fetchDeviceTags:(AppoxeeCompletionHandler)handler;
+- (void)addTagsToDevice:(NSArray *)tagsToAdd andRemove:(NSArray *)tagsToRemove withCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+#pragma mark - Custom Fields
+
+- (void)setDateValue:(NSDate *)date forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)setNumberValue:(NSNumber *)number forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)incrementNumericKey:(NSString *)key byNumericValue:(NSNumber *)number withCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)setStringValue:(NSString *)string forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler;
+- (void)fetchCustomFieldByKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+@end
+
+// Appoxee already implements every method of the protocol.
+@interface Appoxee (APXAppoxeeClient) <APXAppoxeeClient>
+
+@end
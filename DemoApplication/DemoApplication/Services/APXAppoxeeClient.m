@@ -0,0 +1,13 @@
+//
+//  APXAppoxeeClient.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXAppoxeeClient.h"
+
+@implementation Appoxee (APXAppoxeeClient)
+
+@end
@@ -0,0 +1,43 @@
+//
+//  APXContentPrefetcher.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+// Posted on the main queue each time a page was stored, userInfo holds its URL under APXContentPrefetcherURLKey.
+extern NSString * const APXContentPrefetcherDidCacheContentNotification;
+extern NSString * const APXContentPrefetcherURLKey;
+
+// Downloads the pages rich messages link to through a background URLSession, so a prefetch started right after launch carries on while
+// the app is suspended, and even after it's terminated. Pages are stored one by one as they finish, and posted about, whether the app
+// was running or relaunched in the background for them. A failed download keeps its resume data, the next prefetch continues from there.
+@interface APXContentPrefetcher : NSObject
+
+@property (nonatomic, strong, readonly) NSURL *cacheDirectoryURL;
+
+// Downloads through the background session "com.appoxee.demo.content-prefetch", into the Caches directory.
++ (instancetype)sharedPrefetcher;
+
+// Pass a background configuration to have downloads outlive the app. Other configurations work the same while the app is running.
+- (instancetype)initWithCacheDirectoryURL:(NSURL *)cacheDirectoryURL configuration:(NSURLSessionConfiguration *)configuration;
+
+// Starts downloads of the http(s) links of read messages which are neither stored nor already downloading. Reading the link of a
+// message marks it as read, the links of unread messages aren't read: their page is loaded when they're opened, and stored by the
+// prefetch which follows. Stored pages of links which aren't listed are removed, so pass every message of the Inbox.
+- (void)prefetchContentForMessages:(NSArray *)messages;
+
+// The stored page of URL, nil until it was downloaded. Thread safe.
+- (NSURL *)cachedContentURLForURL:(NSURL *)URL;
+
+// Call it from application:handleEventsForBackgroundURLSession:completionHandler:. Returns NO, without calling completionHandler,
+// when identifier is not the prefetcher's session. completionHandler is called on the main queue once every event was delivered.
+- (BOOL)handleEventsForBackgroundURLSession:(NSString *)identifier completionHandler:(void (^)(void))completionHandler;
+
+- (void)removeAllCachedContent;
+
+@end
@@ -0,0 +1,280 @@
+//
+//  APXContentPrefetcher.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXContentPrefetcher.h"
+#import <CommonCrypto/CommonDigest.h>
+#import "APXLogger.h"
+#import "APXMetrics.h"
+
+NSString * const APXContentPrefetcherDidCacheContentNotification = @"APXContentPrefetcherDidCacheContentNotification";
+NSString * const APXContentPrefetcherURLKey = @"url";
+
+static NSString * const kAPXContentPrefetchSessionIdentifier = @"com.appoxee.demo.content-prefetch";
+static NSString * const kAPXContentExtension = @"html";
+static NSString * const kAPXContentResumeDataExtension = @"resume";
+
+@interface APXContentPrefetcher () <NSURLSessionDownloadDelegate>
+
+@property (nonatomic, strong, readwrite) NSURL *cacheDirectoryURL;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) NSURLSession *session;
+@property (nonatomic, strong) NSMutableSet *downloadingKeys; // URL keys of the tasks this instance started, only touched on 'queue'
+@property (nonatomic, copy) void (^backgroundEventsCompletionHandler)(void);
+@property (nonatomic, strong) APXCounter *resumedCounter;
+
+@end
+
+@implementation APXContentPrefetcher
+
+#pragma mark - Initialization
+
++ (instancetype)sharedPrefetcher
+{
+    static APXContentPrefetcher *sharedPrefetcher = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSURL *cachesURL = [[[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask] firstObject];
+        NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration backgroundSessionConfigurationWithIdentifier:kAPXContentPrefetchSessionIdentifier];
+        
+        // The user is waiting for the Inbox, the downloads shouldn't be left for when the device is charging.
+        configuration.discretionary = NO;
+        
+        sharedPrefetcher = [[self alloc] initWithCacheDirectoryURL:[cachesURL URLByAppendingPathComponent:@"APXContent" isDirectory:YES] configuration:configuration];
+    });
+    
+    return sharedPrefetcher;
+}
+
+- (instancetype)initWithCacheDirectoryURL:(NSURL *)cacheDirectoryURL configuration:(NSURLSessionConfiguration *)configuration
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _cacheDirectoryURL = cacheDirectoryURL;
+        _queue = dispatch_queue_create("com.appoxee.demo.content-prefetcher", DISPATCH_QUEUE_SERIAL);
+        _downloadingKeys = [[NSMutableSet alloc] init];
+        _resumedCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricContentPrefetchesResumed];
+        
+        [[NSFileManager defaultManager] createDirectoryAtURL:_cacheDirectoryURL withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        NSOperationQueue *delegateQueue = [[NSOperationQueue alloc] init];
+        delegateQueue.maxConcurrentOperationCount = 1;
+        delegateQueue.underlyingQueue = _queue;
+        
+        // A background session reconnects to the downloads an earlier launch started, their events are delivered as soon as it's created.
+        _session = [NSURLSession sessionWithConfiguration:configuration delegate:self delegateQueue:delegateQueue];
+    }
+    
+    return self;
+}
+
+#pragma mark - Prefetching
+
+- (void)prefetchContentForMessages:(NSArray *)messages
+/*
+  The SDK marks a message as read when its messageLink is read, the link of an unread message is left for when the user opens it.
+*/
+{
+    NSMutableArray *URLs = [[NSMutableArray alloc] initWithCapacity:[messages count]];
+    
+    for (APXRichMessage *message in messages) {
+        
+        if (!message.isRead) continue;
+        
+        NSURL *URL = [message.messageLink length] ? [NSURL URLWithString:message.messageLink] : nil;
+        NSString *scheme = [[URL scheme] lowercaseString];
+        
+        if ([scheme isEqualToString:@"http"] || [scheme isEqualToString:@"https"]) [URLs addObject:URL];
+    }
+    
+    // Downloads an earlier launch started are only known to the session, not to downloadingKeys.
+    [self.session getTasksWithCompletionHandler:^(NSArray *dataTasks, NSArray *uploadTasks, NSArray *downloadTasks) {
+        
+        dispatch_async(self.queue, ^{
+            
+            for (NSURLSessionTask *task in downloadTasks) {
+                
+                if (task.taskDescription && task.state != NSURLSessionTaskStateCompleted) [self.downloadingKeys addObject:task.taskDescription];
+            }
+            
+            NSMutableSet *keys = [[NSMutableSet alloc] initWithCapacity:[URLs count]];
+            
+            for (NSURL *URL in URLs) {
+                
+                NSString *key = [self keyForURL:URL];
+                [keys addObject:key];
+                
+                if ([self.downloadingKeys containsObject:key] || [[NSFileManager defaultManager] fileExistsAtPath:[[self contentURLForKey:key] path]]) continue;
+                
+                [self startDownloadOfURL:URL key:key];
+            }
+            
+            [self removeContentExceptForKeys:keys];
+        });
+    }];
+}
+
+- (void)startDownloadOfURL:(NSURL *)URL key:(NSString *)key
+/*
+  Called on 'queue'.
+*/
+{
+    NSURL *resumeDataURL = [self resumeDataURLForKey:key];
+    NSData *resumeData = [NSData dataWithContentsOfURL:resumeDataURL];
+    NSURLSessionDownloadTask *task = nil;
+    
+    if (resumeData) {
+        
+        [[NSFileManager defaultManager] removeItemAtURL:resumeDataURL error:nil];
+        task = [self.session downloadTaskWithResumeData:resumeData];
+        
+        if (task) [self.resumedCounter increment];
+    }
+    
+    // Resume data the server no longer honours gives no task, start over.
+    if (!task) task = [self.session downloadTaskWithURL:URL];
+    
+    task.taskDescription = key;
+    [self.downloadingKeys addObject:key];
+    [task resume];
+}
+
+#pragma mark - Cache
+
+- (NSURL *)cachedContentURLForURL:(NSURL *)URL
+{
+    if (!URL) return nil;
+    
+    NSURL *contentURL = [self contentURLForKey:[self keyForURL:URL]];
+    
+    return [[NSFileManager defaultManager] fileExistsAtPath:[contentURL path]] ? contentURL : nil;
+}
+
+- (void)removeContentExceptForKeys:(NSSet *)keys
+/*
+  Called on 'queue'. Messages which left the Inbox take their page and their resume data along.
+*/
+{
+    NSArray *fileURLs = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:self.cacheDirectoryURL includingPropertiesForKeys:nil options:0 error:nil];
+    
+    for (NSURL *fileURL in fileURLs) {
+        
+        if (![keys containsObject:[[fileURL lastPathComponent] stringByDeletingPathExtension]]) [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+    }
+}
+
+- (void)removeAllCachedContent
+{
+    dispatch_async(self.queue, ^{
+        
+        [self removeContentExceptForKeys:[NSSet set]];
+    });
+}
+
+- (NSString *)keyForURL:(NSURL *)URL
+{
+    NSData *data = [[URL absoluteString] dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+    
+    NSMutableString *hexString = [[NSMutableString alloc] initWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    
+    for (NSUInteger i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        
+        [hexString appendFormat:@"%02x", digest[i]];
+    }
+    
+    return hexString;
+}
+
+- (NSURL *)contentURLForKey:(NSString *)key
+{
+    return [[self.cacheDirectoryURL URLByAppendingPathComponent:key] URLByAppendingPathExtension:kAPXContentExtension];
+}
+
+- (NSURL *)resumeDataURLForKey:(NSString *)key
+{
+    return [[self.cacheDirectoryURL URLByAppendingPathComponent:key] URLByAppendingPathExtension:kAPXContentResumeDataExtension];
+}
+
+#pragma mark - Background Events
+
+- (BOOL)handleEventsForBackgroundURLSession:(NSString *)identifier completionHandler:(void (^)(void))completionHandler
+{
+    if (![identifier isEqualToString:self.session.configuration.identifier]) return NO;
+    
+    self.backgroundEventsCompletionHandler = completionHandler;
+    
+    return YES;
+}
+
+#pragma mark - NSURLSessionDownloadDelegate
+
+- (void)URLSession:(NSURLSession *)session downloadTask:(NSURLSessionDownloadTask *)downloadTask didFinishDownloadingToURL:(NSURL *)location
+/*
+  location is deleted as soon as this returns, the page has to be moved before.
+*/
+{
+    NSString *key = downloadTask.taskDescription;
+    NSHTTPURLResponse *response = (NSHTTPURLResponse *)downloadTask.response;
+    
+    if (!key || ![response isKindOfClass:[NSHTTPURLResponse class]] || response.statusCode != 200) {
+        
+        APXLogWarning(APXLogSubsystemInbox, @"Content prefetch of %@ was answered with %ld", downloadTask.originalRequest.URL, (long)[response statusCode]);
+        return;
+    }
+    
+    NSURL *contentURL = [self contentURLForKey:key];
+    NSError *error = nil;
+    
+    [[NSFileManager defaultManager] removeItemAtURL:contentURL error:nil];
+    
+    if (![[NSFileManager defaultManager] moveItemAtURL:location toURL:contentURL error:&error]) {
+        
+        APXLogWarning(APXLogSubsystemInbox, @"Could not store prefetched content: %@", error);
+        return;
+    }
+    
+    NSURL *URL = downloadTask.originalRequest.URL;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        [[NSNotificationCenter defaultCenter] postNotificationName:APXContentPrefetcherDidCacheContentNotification object:self userInfo:URL ? @{APXContentPrefetcherURLKey : URL} : nil];
+    });
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error
+{
+    NSString *key = task.taskDescription;
+    
+    if (key) [self.downloadingKeys removeObject:key];
+    
+    if (!error) return;
+    
+    NSData *resumeData = error.userInfo[NSURLSessionDownloadTaskResumeData];
+    
+    // The next prefetch of the link picks up where this one stopped, instead of downloading the whole page again.
+    if (key && resumeData) [resumeData writeToURL:[self resumeDataURLForKey:key] atomically:YES];
+    
+    APXLogDebug(APXLogSubsystemInbox, @"Content prefetch of %@ stopped%@: %@", task.originalRequest.URL, resumeData ? @", resumable" : @"", error);
+}
+
+- (void)URLSessionDidFinishEventsForBackgroundURLSession:(NSURLSession *)session
+{
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        void (^completionHandler)(void) = self.backgroundEventsCompletionHandler;
+        self.backgroundEventsCompletionHandler = nil;
+        
+        if (completionHandler) completionHandler();
+    });
+}
+
+@end
@@ -0,0 +1,60 @@
+//
+//  APXCustomFieldsStore.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXAppoxeeClient.h"
+
+extern NSString * const APXCustomFieldsErrorDomain;
+
+typedef NS_ENUM(NSInteger, APXCustomFieldsError) {
+    APXCustomFieldsErrorInvalidValue = 1, // only NSString, NSNumber and NSDate values can be set
+    APXCustomFieldsErrorPartialFailure // userInfo holds the errors by key under APXCustomFieldsErrorsKey
+};
+
+extern NSString * const APXCustomFieldsErrorsKey;
+
+// Multi key access to Appoxee custom fields.
+// A batch is scheduled as one request, its per key SDK calls run concurrently, so reading twelve fields costs
+// the slowest round trip instead of the sum of them.
+// Writes take effect locally right away and fields known locally are only read again once they expire, so the app reads its own writes
+// without waiting for, or racing, the server. See APXVersionedState for how server answers are reconciled with local writes.
+@interface APXCustomFieldsStore : NSObject
+
+@property (nonatomic, strong, readonly) id<APXAppoxeeClient> client;
+
+// The fields known locally, key -> NSString / NSNumber / NSDate. A batch write is applied in one step, never by half.
+@property (nonatomic, copy, readonly) NSDictionary *cachedFields;
+
+// A store backed by [Appoxee shared] through [APXRateLimitedClient sharedClient], which keeps the confirmed fields across launches.
++ (instancetype)sharedStore;
+
+// Keeps the fields in memory.
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client;
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client fileURL:(NSURL *)fileURL;
+
+// handler is called once on the main queue, with a dictionary of the fields found. Only the keys which aren't known locally are read from Appoxee.
+// If some keys failed, the error is APXCustomFieldsErrorPartialFailure and data holds the fields which were read.
+- (void)fetchCustomFieldsForKeys:(NSArray *)keys completionHandler:(AppoxeeCompletionHandler)handler;
+
+// fields maps keys to NSString, NSNumber or NSDate values. Invalid values fail the whole batch before anything is sent.
+// handler is called once on the main queue, with the fields which were set as data. Fields which failed are rolled back,
+// unless they were written again meanwhile.
+- (void)setCustomFields:(NSDictionary *)fields completionHandler:(AppoxeeCompletionHandler)handler;
+
+// The incremented value is applied locally if the field is known, otherwise the next fetch reads it from Appoxee.
+- (void)incrementCustomFieldForKey:(NSString *)key byValue:(NSNumber *)value completionHandler:(AppoxeeCompletionHandler)handler;
+
+// The sum keeps integers integral, so counters past 2^53 don't lose precision, and is only a double if either number is one.
++ (NSNumber *)sumOfNumber:(NSNumber *)number andNumber:(NSNumber *)otherNumber;
+
+// Forgets the local fields, the next fetch reads them from Appoxee. Use it when fields may have been changed outside of the app.
+- (void)clearCache;
+
+@end
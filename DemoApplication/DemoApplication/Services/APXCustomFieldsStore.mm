@@ -0,0 +1,319 @@
+//
+//  APXCustomFieldsStore.mm
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXCustomFieldsStore.h"
+#import "APXRequestScheduler.h"
+#import "APXVersionedState.h"
+#import "APXLogger.h"
+#import "APXRateLimitedClient.h"
+#include "apx/NumericValue.h"
+
+NSString * const APXCustomFieldsErrorDomain = @"APXCustomFieldsErrorDomain";
+NSString * const APXCustomFieldsErrorsKey = @"APXCustomFieldsErrors";
+
+typedef void(^APXCustomFieldsBatchCompletion)(NSDictionary *fields, NSDictionary *errors);
+
+@interface APXCustomFieldsStore ()
+
+@property (nonatomic, strong, readwrite) id<APXAppoxeeClient> client;
+@property (nonatomic, strong) APXVersionedState *state;
+
+@end
+
+@implementation APXCustomFieldsStore
+
+#pragma mark - Initialization
+
++ (instancetype)sharedStore
+{
+    static APXCustomFieldsStore *sharedStore = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSURL *directory = [[[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask] firstObject];
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        sharedStore = [[self alloc] initWithClient:[APXRateLimitedClient sharedClient] fileURL:[directory URLByAppendingPathComponent:@"APXCustomFields.plist"]];
+    });
+    
+    return sharedStore;
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client
+{
+    return [self initWithClient:client fileURL:nil];
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client fileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _client = client;
+        _state = [[APXVersionedState alloc] initWithFileURL:fileURL];
+    }
+    
+    return self;
+}
+
+#pragma mark - Getters
+
+- (NSDictionary *)cachedFields
+{
+    return [self.state dictionaryRepresentation];
+}
+
+- (NSDictionary *)fieldsForKeys:(NSArray *)keys
+/*
+  Fields known to be unset are left out, just like the SDK answers for a missing field.
+*/
+{
+    NSMutableDictionary *fields = [[self.state objectsForKeys:keys] mutableCopy];
+    [fields removeObjectsForKeys:[fields allKeysForObject:[NSNull null]]];
+    
+    return fields;
+}
+
+#pragma mark - Fetch
+
+- (void)fetchCustomFieldsForKeys:(NSArray *)keys completionHandler:(AppoxeeCompletionHandler)handler
+{
+    NSArray *uniqueKeys = [[NSOrderedSet orderedSetWithArray:keys ?: @[]] array];
+    NSDictionary *knownFields = [self.state objectsForKeys:uniqueKeys];
+    
+    NSIndexSet *missing = [uniqueKeys indexesOfObjectsPassingTest:^BOOL(NSString *key, NSUInteger idx, BOOL *stop) {
+        return !knownFields[key];
+    }];
+    
+    if (![missing count]) {
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            
+            [self callHandler:handler withFields:[self fieldsForKeys:uniqueKeys] errors:nil];
+        });
+        
+        return;
+    }
+    
+    NSArray *missingKeys = [uniqueKeys objectsAtIndexes:missing];
+    NSDictionary *versions = [self.state versionsForKeys:missingKeys];
+    
+    [self performBatchForKeys:missingKeys operation:^(NSString *key, AppoxeeCompletionHandler done) {
+        
+        [self.client fetchCustomFieldByKey:key withCompletionHandler:^(NSError *appoxeeError, id data) {
+            
+            // The SDK answers with a single entry dictionary, a missing field is an empty one.
+            id value = [data isKindOfClass:[NSDictionary class]] ? ((NSDictionary *)data)[key] : nil;
+            done(appoxeeError, value);
+        }];
+        
+    } completion:^(NSDictionary *fields, NSDictionary *errors) {
+        
+        NSMutableDictionary *readVersions = [versions mutableCopy];
+        [readVersions removeObjectsForKeys:[errors allKeys]];
+        [self.state applyServerValues:fields readVersions:readVersions];
+        
+        // Fields written while the batch was in flight win over the server's answer.
+        [self callHandler:handler withFields:[self fieldsForKeys:uniqueKeys] errors:errors];
+    }];
+}
+
+#pragma mark - Set
+
+- (void)setCustomFields:(NSDictionary *)fields completionHandler:(AppoxeeCompletionHandler)handler
+{
+    for (id key in fields) {
+        
+        id value = fields[key];
+        
+        if (![key isKindOfClass:[NSString class]] || !([value isKindOfClass:[NSString class]] || [value isKindOfClass:[NSNumber class]] || [value isKindOfClass:[NSDate class]])) {
+            
+            [self failWithInvalidValue:value forKey:key completionHandler:handler];
+            
+            return;
+        }
+    }
+    
+    NSDictionary *values = [fields copy];
+    uint64_t version = [self.state applyLocalValues:values];
+    
+    [self performBatchForKeys:[values allKeys] operation:^(NSString *key, AppoxeeCompletionHandler done) {
+        
+        id value = values[key];
+        AppoxeeCompletionHandler setDone = ^(NSError *appoxeeError, id data) {
+            
+            done(appoxeeError, value);
+        };
+        
+        if ([value isKindOfClass:[NSDate class]]) {
+            
+            [self.client setDateValue:value forKey:key withCompletionHandler:setDone];
+            
+        } else if ([value isKindOfClass:[NSNumber class]]) {
+            
+            [self.client setNumberValue:value forKey:key withCompletionHandler:setDone];
+            
+        } else {
+            
+            [self.client setStringValue:value forKey:key withCompletionHandler:setDone];
+        }
+        
+    } completion:^(NSDictionary *setFields, NSDictionary *errors) {
+        
+        [self reconcileFields:setFields errors:errors version:version];
+        [self callHandler:handler withFields:setFields errors:errors];
+    }];
+}
+
+- (void)incrementCustomFieldForKey:(NSString *)key byValue:(NSNumber *)value completionHandler:(AppoxeeCompletionHandler)handler
+{
+    if (![key isKindOfClass:[NSString class]] || ![value isKindOfClass:[NSNumber class]]) {
+        
+        [self failWithInvalidValue:value forKey:key completionHandler:handler];
+        
+        return;
+    }
+    
+    id current = [self.state objectForKey:key];
+    NSNumber *incremented = nil;
+    uint64_t version = 0;
+    
+    if ([current isKindOfClass:[NSNumber class]]) {
+        
+        incremented = [[self class] sumOfNumber:current andNumber:value];
+        version = [self.state applyLocalValues:@{key : incremented}];
+        
+    } else {
+        
+        [self.state invalidateValuesForKeys:@[key]];
+    }
+    
+    [self performBatchForKeys:@[key] operation:^(NSString *fieldKey, AppoxeeCompletionHandler done) {
+        
+        [self.client incrementNumericKey:fieldKey byNumericValue:value withCompletionHandler:^(NSError *appoxeeError, id data) {
+            
+            done(appoxeeError, incremented);
+        }];
+        
+    } completion:^(NSDictionary *incrementedFields, NSDictionary *errors) {
+        
+        if (incremented) [self reconcileFields:incrementedFields errors:errors version:version];
+        
+        [self callHandler:handler withFields:incrementedFields errors:errors];
+    }];
+}
+
+- (void)failWithInvalidValue:(id)value forKey:(id)key completionHandler:(AppoxeeCompletionHandler)handler
+{
+    NSError *error = [NSError errorWithDomain:APXCustomFieldsErrorDomain code:APXCustomFieldsErrorInvalidValue userInfo:@{NSLocalizedDescriptionKey : [NSString stringWithFormat:@"Invalid custom field %@ = %@", key, value]}];
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        if (handler) handler(error, nil);
+    });
+}
+
++ (NSNumber *)sumOfNumber:(NSNumber *)number andNumber:(NSNumber *)otherNumber
+{
+    apx::NumericValue sum = [self numericValueForNumber:number] + [self numericValueForNumber:otherNumber];
+    
+    return sum.isIntegral() ? @(sum.integerValue()) : @(sum.doubleValue());
+}
+
++ (apx::NumericValue)numericValueForNumber:(NSNumber *)number
+/*
+  The number's own type decides, so @(5) stays an integer and @(5.0) or a JSON "5.0" doesn't.
+*/
+{
+    if (CFNumberIsFloatType((__bridge CFNumberRef)number)) return apx::NumericValue::real([number doubleValue]);
+    
+    return apx::NumericValue::integer([number longLongValue]);
+}
+
+#pragma mark - Cache
+
+- (void)clearCache
+{
+    [self.state invalidateAllValues];
+}
+
+#pragma mark - Batching
+
+- (void)performBatchForKeys:(NSArray *)keys operation:(void (^)(NSString *key, AppoxeeCompletionHandler done))operation completion:(APXCustomFieldsBatchCompletion)completion
+/*
+  The batch is one scheduler request, so a backlog of batches is bounded by the lane and not by the number of keys.
+*/
+{
+    NSMutableDictionary *fields = [[NSMutableDictionary alloc] initWithCapacity:[keys count]];
+    NSMutableDictionary *errors = [[NSMutableDictionary alloc] init];
+    
+    [[APXRequestScheduler sharedScheduler] scheduleRequest:^(AppoxeeCompletionHandler done) {
+        
+        dispatch_group_t group = dispatch_group_create();
+        
+        for (NSString *key in keys) {
+            
+            dispatch_group_enter(group);
+            
+            operation(key, ^(NSError *appoxeeError, id value) {
+                
+                @synchronized (fields) {
+                    
+                    if (appoxeeError) {
+                        
+                        errors[key] = appoxeeError;
+                        
+                    } else if (value) {
+                        
+                        fields[key] = value;
+                    }
+                }
+                
+                dispatch_group_leave(group);
+            });
+        }
+        
+        dispatch_group_notify(group, dispatch_get_main_queue(), ^{
+            
+            done(nil, nil);
+        });
+        
+    } inLane:APXRequestLaneUserInteractive completion:^(NSError *appoxeeError, id data) {
+        
+        completion(fields, errors);
+    }];
+}
+
+- (void)reconcileFields:(NSDictionary *)fields errors:(NSDictionary *)errors version:(uint64_t)version
+{
+    [fields enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+        
+        [self.state confirmValue:value forKey:key version:version];
+    }];
+    
+    for (NSString *key in errors) {
+        
+        [self.state rejectValueForKey:key version:version];
+    }
+}
+
+- (void)callHandler:(AppoxeeCompletionHandler)handler withFields:(NSDictionary *)fields errors:(NSDictionary *)errors
+{
+    NSError *error = nil;
+    
+    if ([errors count]) {
+        
+        APXLogWarning(APXLogSubsystemNetwork, @"Custom fields batch failed for %@", [[errors allKeys] componentsJoinedByString:@", "]);
+        error = [NSError errorWithDomain:APXCustomFieldsErrorDomain code:APXCustomFieldsErrorPartialFailure userInfo:@{APXCustomFieldsErrorsKey : [errors copy]}];
+    }
+    
+    if (handler) handler(error, [fields copy]);
+}
+
+@end
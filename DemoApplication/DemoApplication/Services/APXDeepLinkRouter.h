@@ -0,0 +1,55 @@
+//
+//  APXDeepLinkRouter.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+
+// A link which matched a registered pattern.
+@interface APXDeepLinkMatch : NSObject
+
+@property (nonatomic, strong, readonly) NSURL *URL;
+@property (nonatomic, copy, readonly) NSString *pattern;
+
+// The values of the pattern's :parameters, and the URL's query items. A parameter wins over a query item of the same name.
+@property (nonatomic, copy, readonly) NSDictionary *parameters;
+
+// Created by the pattern's factory when the link is routed or prepared, nil without one.
+@property (nonatomic, strong, readonly) UIViewController *viewController;
+
+@end
+
+typedef UIViewController *(^APXDeepLinkViewControllerFactory)(APXDeepLinkMatch *match);
+typedef void(^APXDeepLinkHandler)(APXDeepLinkMatch *match);
+
+// Routes the links the app is opened with, and the values of OpenURLScheme / OpenViewController push actions, to the screen they name.
+// Patterns are registered once, i.e. at launch, and compiled into a trie of path segments, so matching a link walks its segments once
+// whatever the number of patterns. Nothing is written to disk on the way from a link to its screen.
+//
+// A pattern is "scheme://host/path" or, to match links of any scheme and scheme-less values, "host/path". A segment is either literal,
+// a ":name" parameter matching any one segment, or a trailing "*" matching whatever is left. Literal segments win over parameters, and
+// parameters over "*". Must be used from the main queue.
+@interface APXDeepLinkRouter : NSObject
+
++ (instancetype)sharedRouter;
+
+// A pattern registered again replaces the earlier one. factory may be nil, handler is called with the match to display it.
+- (void)registerPattern:(NSString *)pattern viewControllerFactory:(APXDeepLinkViewControllerFactory)factory handler:(APXDeepLinkHandler)handler;
+
+// The match of URL without creating its view controller, nil if no pattern matches.
+- (APXDeepLinkMatch *)matchURL:(NSURL *)URL;
+
+// Creates URL's view controller ahead of time, i.e. with the launch options URL while the app is still launching. The next routeURL:
+// of the same URL uses it instead of creating another one.
+- (APXDeepLinkMatch *)prepareURL:(NSURL *)URL;
+
+// Returns NO when no pattern matches.
+- (BOOL)routeURL:(NSURL *)URL;
+
+// A push action value, either a URL or a scheme-less path such as "inbox/42".
+- (BOOL)routeValue:(NSString *)value;
+
+@end
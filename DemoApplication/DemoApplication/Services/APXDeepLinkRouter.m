@@ -0,0 +1,349 @@
+//
+//  APXDeepLinkRouter.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXDeepLinkRouter.h"
+#import "APXLogger.h"
+
+static NSString * const kAPXDeepLinkRouterSchemeSeparator = @"://";
+static NSString * const kAPXDeepLinkRouterParameterPrefix = @":";
+static NSString * const kAPXDeepLinkRouterWildcard = @"*";
+
+@interface APXDeepLinkRoute : NSObject
+
+@property (nonatomic, copy) NSString *pattern;
+@property (nonatomic, copy) NSArray *parameterNames; // of Type NSString, in the order of the pattern's parameter segments
+@property (nonatomic, copy) APXDeepLinkViewControllerFactory factory;
+@property (nonatomic, copy) APXDeepLinkHandler handler;
+
+@end
+
+@implementation APXDeepLinkRoute
+
+@end
+
+@interface APXDeepLinkMatch ()
+
+@property (nonatomic, strong, readwrite) NSURL *URL;
+@property (nonatomic, copy, readwrite) NSString *pattern;
+@property (nonatomic, copy, readwrite) NSDictionary *parameters;
+@property (nonatomic, strong, readwrite) UIViewController *viewController;
+@property (nonatomic, strong) APXDeepLinkRoute *route;
+
+@end
+
+@implementation APXDeepLinkMatch
+
+@end
+
+@interface APXDeepLinkNode : NSObject
+
+@property (nonatomic, strong) NSMutableDictionary *literalChildren; // lowercased segment -> APXDeepLinkNode
+@property (nonatomic, strong) APXDeepLinkNode *parameterChild;
+@property (nonatomic, strong) APXDeepLinkRoute *route; // the pattern ending at this node
+@property (nonatomic, strong) APXDeepLinkRoute *wildcardRoute; // the pattern ending with "*" after this node
+
+@end
+
+@implementation APXDeepLinkNode
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _literalChildren = [[NSMutableDictionary alloc] init];
+    }
+    
+    return self;
+}
+
+@end
+
+@interface APXDeepLinkRouter ()
+
+@property (nonatomic, strong) NSMutableDictionary *schemeRoots; // lowercased scheme -> APXDeepLinkNode
+@property (nonatomic, strong) APXDeepLinkNode *anySchemeRoot;
+@property (nonatomic, strong) APXDeepLinkMatch *preparedMatch;
+
+@end
+
+@implementation APXDeepLinkRouter
+
+#pragma mark - Initialization
+
++ (instancetype)sharedRouter
+{
+    static APXDeepLinkRouter *sharedRouter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        sharedRouter = [[self alloc] init];
+    });
+    
+    return sharedRouter;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _schemeRoots = [[NSMutableDictionary alloc] init];
+        _anySchemeRoot = [[APXDeepLinkNode alloc] init];
+    }
+    
+    return self;
+}
+
+#pragma mark - Registration
+
+- (void)registerPattern:(NSString *)pattern viewControllerFactory:(APXDeepLinkViewControllerFactory)factory handler:(APXDeepLinkHandler)handler
+/*
+  Walks the pattern's segments once, creating the nodes it is missing. Parameter names are kept on the route rather than on the node,
+  so patterns sharing a prefix may name their parameters differently.
+*/
+{
+    NSParameterAssert([pattern length] && handler);
+    
+    APXDeepLinkNode *node = self.anySchemeRoot;
+    NSString *path = pattern;
+    NSRange separator = [pattern rangeOfString:kAPXDeepLinkRouterSchemeSeparator];
+    
+    if (separator.location != NSNotFound) {
+        
+        NSString *scheme = [[pattern substringToIndex:separator.location] lowercaseString];
+        node = self.schemeRoots[scheme];
+        
+        if (!node) {
+            
+            node = [[APXDeepLinkNode alloc] init];
+            self.schemeRoots[scheme] = node;
+        }
+        
+        path = [pattern substringFromIndex:NSMaxRange(separator)];
+    }
+    
+    APXDeepLinkRoute *route = [[APXDeepLinkRoute alloc] init];
+    route.pattern = pattern;
+    route.factory = factory;
+    route.handler = handler;
+    
+    NSMutableArray *parameterNames = [[NSMutableArray alloc] init];
+    NSArray *segments = [self segmentsOfPath:path];
+    
+    for (NSUInteger index = 0; index < [segments count]; index++) {
+        
+        NSString *segment = segments[index];
+        
+        if ([segment isEqualToString:kAPXDeepLinkRouterWildcard]) {
+            
+            NSAssert(index == [segments count] - 1, @"\"*\" must be the last segment of %@", pattern);
+            route.parameterNames = parameterNames;
+            node.wildcardRoute = route;
+            return;
+        }
+        
+        if ([segment hasPrefix:kAPXDeepLinkRouterParameterPrefix]) {
+            
+            [parameterNames addObject:[segment substringFromIndex:1]];
+            
+            if (!node.parameterChild) {
+                
+                node.parameterChild = [[APXDeepLinkNode alloc] init];
+            }
+            
+            node = node.parameterChild;
+            
+        } else {
+            
+            NSString *key = [segment lowercaseString];
+            APXDeepLinkNode *child = node.literalChildren[key];
+            
+            if (!child) {
+                
+                child = [[APXDeepLinkNode alloc] init];
+                node.literalChildren[key] = child;
+            }
+            
+            node = child;
+        }
+    }
+    
+    route.parameterNames = parameterNames;
+    node.route = route;
+}
+
+#pragma mark - Matching
+
+- (APXDeepLinkMatch *)matchURL:(NSURL *)URL
+{
+    if (!URL) {
+        
+        return nil;
+    }
+    
+    NSMutableArray *segments = [[NSMutableArray alloc] init];
+    
+    if ([URL.host length]) {
+        
+        [segments addObject:URL.host];
+    }
+    
+    [segments addObjectsFromArray:[self segmentsOfPath:URL.path]];
+    
+    NSMutableArray *values = [[NSMutableArray alloc] init];
+    APXDeepLinkRoute *route = nil;
+    APXDeepLinkNode *schemeRoot = [URL.scheme length] ? self.schemeRoots[[URL.scheme lowercaseString]] : nil;
+    
+    if (schemeRoot) {
+        
+        route = [self routeFromNode:schemeRoot segments:segments index:0 values:values];
+    }
+    
+    if (!route) {
+        
+        route = [self routeFromNode:self.anySchemeRoot segments:segments index:0 values:values];
+    }
+    
+    if (!route) {
+        
+        return nil;
+    }
+    
+    NSMutableDictionary *parameters = [[NSMutableDictionary alloc] init];
+    
+    for (NSURLQueryItem *item in [[NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO] queryItems]) {
+        
+        if (item.value) {
+            
+            parameters[item.name] = item.value;
+        }
+    }
+    
+    [route.parameterNames enumerateObjectsUsingBlock:^(NSString *name, NSUInteger index, BOOL *stop) {
+        
+        parameters[name] = values[index];
+    }];
+    
+    APXDeepLinkMatch *match = [[APXDeepLinkMatch alloc] init];
+    match.URL = URL;
+    match.pattern = route.pattern;
+    match.parameters = parameters;
+    match.route = route;
+    
+    return match;
+}
+
+- (APXDeepLinkRoute *)routeFromNode:(APXDeepLinkNode *)node segments:(NSArray *)segments index:(NSUInteger)index values:(NSMutableArray *)values
+/*
+  Literal children first, then the parameter child, then "*". A branch which doesn't end on a route gives its parameter values back,
+  so "inbox/:id/edit" doesn't shadow "inbox/*" for "inbox/42/share".
+*/
+{
+    if (index == [segments count]) {
+        
+        return node.route ?: node.wildcardRoute;
+    }
+    
+    NSString *segment = segments[index];
+    APXDeepLinkNode *child = node.literalChildren[[segment lowercaseString]];
+    APXDeepLinkRoute *route = child ? [self routeFromNode:child segments:segments index:index + 1 values:values] : nil;
+    
+    if (!route && node.parameterChild) {
+        
+        [values addObject:segment];
+        route = [self routeFromNode:node.parameterChild segments:segments index:index + 1 values:values];
+        
+        if (!route) {
+            
+            [values removeLastObject];
+        }
+    }
+    
+    return route ?: node.wildcardRoute;
+}
+
+- (NSArray *)segmentsOfPath:(NSString *)path
+{
+    NSMutableArray *segments = [[NSMutableArray alloc] init];
+    
+    for (NSString *segment in [path componentsSeparatedByString:@"/"]) {
+        
+        if ([segment length]) {
+            
+            [segments addObject:segment];
+        }
+    }
+    
+    return segments;
+}
+
+#pragma mark - Routing
+
+- (APXDeepLinkMatch *)prepareURL:(NSURL *)URL
+{
+    APXDeepLinkMatch *match = [self matchURL:URL];
+    
+    if (match) {
+        
+        match.viewController = [self viewControllerForMatch:match];
+        self.preparedMatch = match;
+    }
+    
+    return match;
+}
+
+- (BOOL)routeURL:(NSURL *)URL
+{
+    APXDeepLinkMatch *match = nil;
+    
+    if (self.preparedMatch && [self.preparedMatch.URL isEqual:URL]) {
+        
+        match = self.preparedMatch;
+        
+    } else {
+        
+        match = [self matchURL:URL];
+        match.viewController = [self viewControllerForMatch:match];
+    }
+    
+    self.preparedMatch = nil;
+    
+    if (!match) {
+        
+        APXLogInfo(APXLogSubsystemPush, @"No route for %@", URL);
+        return NO;
+    }
+    
+    APXLogDebug(APXLogSubsystemPush, @"Routing %@ to %@", URL, match.pattern);
+    match.route.handler(match);
+    
+    return YES;
+}
+
+- (BOOL)routeValue:(NSString *)value
+{
+    NSString *trimmed = [value stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    NSURL *URL = [trimmed length] ? [NSURL URLWithString:trimmed] : nil;
+    
+    if (!URL) {
+        
+        URL = [NSURL URLWithString:[trimmed stringByAddingPercentEncodingWithAllowedCharacters:[NSCharacterSet URLPathAllowedCharacterSet]]];
+    }
+    
+    return URL ? [self routeURL:URL] : NO;
+}
+
+- (UIViewController *)viewControllerForMatch:(APXDeepLinkMatch *)match
+{
+    return match.route.factory ? match.route.factory(match) : nil;
+}
+
+@end
@@ -0,0 +1,55 @@
+//
+//  APXDeviceRegistrationFilter.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "APXAppoxeeClient.h"
+#import "APXSharedStore.h"
+#import "APXTransferScheduler.h"
+
+// Device state fields tracked by the filter.
+extern NSString * const APXDeviceFieldPushToken;
+extern NSString * const APXDeviceFieldNotificationSettings;
+extern NSString * const APXDeviceFieldLocale;
+extern NSString * const APXDeviceFieldTimeZone;
+extern NSString * const APXDeviceFieldOSVersion;
+extern NSString * const APXDeviceFieldHardwareType;
+extern NSString * const APXDeviceFieldSDKVersion;
+
+// Forwarding 'didRegisterForRemoteNotificationsWithDeviceToken:' and 'didRegisterUserNotificationSettings:' to Appoxee on every launch
+// re-registers the device even though nothing changed. The filter keeps a hash per field of the last device state Appoxee acknowledged,
+// debounces the two callbacks, which usually fire back to back, and only forwards what changed since. A field is acknowledged once the
+// device information Appoxee returns shows the value which was sent, until then every callback sends it again.
+@interface APXDeviceRegistrationFilter : NSObject
+
+@property (nonatomic) NSTimeInterval debounceInterval; // default is 0.5 seconds
+@property (nonatomic, strong, readonly) id<APXAppoxeeClient> client;
+
+// When set, the device information Appoxee acknowledged is written to its Device section, for the app's extensions to read.
+@property (nonatomic, strong) APXSharedStore *sharedStore;
+
+// When set, a registration which only carries profile fields (locale, time zone, versions), nothing push delivery depends on, waits for
+// the radio to be awake, at most profileUpdateMaximumDelay seconds. A changed token or notification settings are sent right away.
+@property (nonatomic, strong) APXTransferScheduler *transferScheduler;
+@property (nonatomic) NSTimeInterval profileUpdateMaximumDelay; // default is one hour
+
+// A filter in front of [Appoxee shared], writing to [APXSharedStore sharedStore] and deferring through [APXTransferScheduler sharedScheduler].
++ (instancetype)sharedFilter;
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client;
+- (instancetype)init NS_UNAVAILABLE;
+
+- (void)didRegisterForRemoteNotificationsWithDeviceToken:(NSData *)token;
+- (void)didRegisterUserNotificationSettings:(NSObject *)notificationSettings;
+
+// The fields which differ from the last acknowledged state, i.e. the ones the next registration will send.
+- (NSSet *)changedFields;
+
+// Forget the acknowledged state, so the next callback is forwarded regardless.
+- (void)reset;
+
+@end
@@ -0,0 +1,361 @@
+//
+//  APXDeviceRegistrationFilter.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXDeviceRegistrationFilter.h"
+#import <UIKit/UIKit.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import <CommonCrypto/CommonDigest.h>
+#import <sys/sysctl.h>
+#import "APXLogger.h"
+#import "APXMetrics.h"
+
+NSString * const APXDeviceFieldPushToken = @"push_token";
+NSString * const APXDeviceFieldNotificationSettings = @"notification_settings";
+NSString * const APXDeviceFieldLocale = @"locale";
+NSString * const APXDeviceFieldTimeZone = @"time_zone";
+NSString * const APXDeviceFieldOSVersion = @"os_version";
+NSString * const APXDeviceFieldHardwareType = @"hardware_type";
+NSString * const APXDeviceFieldSDKVersion = @"sdk_version";
+
+static NSString * const kAPXAcknowledgedDeviceStateKey = @"APXAcknowledgedDeviceState";
+static NSString * const kAPXDeviceRegistrationTransferIdentifier = @"com.appoxee.demo.device-registration";
+
+@interface APXDeviceRegistrationFilter ()
+
+@property (nonatomic, strong, readwrite) id<APXAppoxeeClient> client;
+@property (nonatomic, strong) NSData *pendingToken;
+@property (nonatomic, strong) NSObject *pendingSettings;
+@property (nonatomic) NSUInteger debounceGeneration;
+
+@end
+
+@implementation APXDeviceRegistrationFilter
+
+#pragma mark - Initialization
+
++ (instancetype)sharedFilter
+{
+    static APXDeviceRegistrationFilter *sharedFilter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedFilter = [[self alloc] initWithClient:[Appoxee shared]];
+        sharedFilter.sharedStore = [APXSharedStore sharedStore];
+        sharedFilter.transferScheduler = [APXTransferScheduler sharedScheduler];
+    });
+    
+    return sharedFilter;
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _client = client;
+        _debounceInterval = 0.5;
+        _profileUpdateMaximumDelay = 60.0 * 60.0;
+    }
+    
+    return self;
+}
+
+#pragma mark - Registration
+
+- (void)didRegisterForRemoteNotificationsWithDeviceToken:(NSData *)token
+{
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        self.pendingToken = token;
+        [self scheduleRegistration];
+    });
+}
+
+- (void)didRegisterUserNotificationSettings:(NSObject *)notificationSettings
+{
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        self.pendingSettings = notificationSettings;
+        [self scheduleRegistration];
+    });
+}
+
+- (void)scheduleRegistration
+/*
+  Every callback restarts the debounce interval, only the last scheduled registration runs.
+*/
+{
+    NSUInteger generation = ++self.debounceGeneration;
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.debounceInterval * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        
+        if (generation == self.debounceGeneration) [self registerChangesDeferringProfileUpdates:YES];
+    });
+}
+
+- (void)registerChangesDeferringProfileUpdates:(BOOL)defersProfileUpdates
+{
+    NSDictionary *state = [self currentState];
+    NSSet *changedFields = [self changedFieldsForState:state];
+    
+    NSData *token = self.pendingToken;
+    NSObject *settings = self.pendingSettings;
+    
+    self.pendingToken = nil;
+    self.pendingSettings = nil;
+    
+    NSMutableSet *sentFields = [[NSMutableSet alloc] init];
+    
+    // Settings are sent on their own. Any other change, the token included, is picked up by Appoxee when the token is registered.
+    if (settings && [changedFields containsObject:APXDeviceFieldNotificationSettings]) {
+        
+        [self.client didRegisterUserNotificationSettings:settings];
+        [sentFields addObject:APXDeviceFieldNotificationSettings];
+    }
+    
+    NSMutableSet *profileFields = [changedFields mutableCopy];
+    [profileFields removeObject:APXDeviceFieldNotificationSettings];
+    
+    if (token && [profileFields count] && defersProfileUpdates && ![sentFields count] && ![profileFields containsObject:APXDeviceFieldPushToken] && self.transferScheduler) {
+        
+        [self deferRegistrationWithToken:token];
+        return;
+    }
+    
+    if (token && [profileFields count]) {
+        
+        [self.client didRegisterForRemoteNotificationsWithDeviceToken:token];
+        [sentFields unionSet:profileFields];
+    }
+    
+    if (![sentFields count]) {
+        
+        [[[APXMetrics sharedMetrics] counterNamed:APXMetricDeviceRegistrationsSkipped] increment];
+        return;
+    }
+    
+    [[[APXMetrics sharedMetrics] counterNamed:APXMetricDeviceRegistrations] increment];
+    APXLogInfo(APXLogSubsystemNetwork, @"Registering changed device fields: %@", [[sentFields allObjects] componentsJoinedByString:@", "]);
+    
+    [self.client deviceInformationwithCompletionHandler:^(NSError *appoxeeError, id data) {
+        
+        if (appoxeeError || ![data isKindOfClass:[APXClientDevice class]]) return;
+        
+        NSSet *confirmedFields = [self fields:sentFields ofState:state confirmedByDevice:data];
+        
+        if ([confirmedFields count] < [sentFields count]) {
+            
+            NSMutableSet *unconfirmedFields = [sentFields mutableCopy];
+            [unconfirmedFields minusSet:confirmedFields];
+            APXLogWarning(APXLogSubsystemNetwork, @"Appoxee doesn't show device fields yet, they are sent again: %@", [[unconfirmedFields allObjects] componentsJoinedByString:@", "]);
+        }
+        
+        [self acknowledgeFields:confirmedFields ofState:state];
+        [self exportDevice:data];
+    }];
+}
+
+- (NSSet *)fields:(NSSet *)fields ofState:(NSDictionary *)state confirmedByDevice:(APXClientDevice *)device
+/*
+  A device is returned whether or not the registration went through, only the fields it shows with the values we sent are acknowledged.
+  Tokens are compared without the spaces and brackets of NSData's description, the locale on its language.
+*/
+{
+    NSMutableSet *confirmedFields = [[NSMutableSet alloc] init];
+    
+    for (NSString *field in fields) {
+        
+        NSString *value = state[field];
+        BOOL isConfirmed = NO;
+        
+        if ([field isEqualToString:APXDeviceFieldPushToken]) {
+            
+            NSString *pushToken = [[device.pushToken componentsSeparatedByCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"<> "]] componentsJoinedByString:@""];
+            isConfirmed = [pushToken length] && [pushToken caseInsensitiveCompare:value] == NSOrderedSame;
+            
+        } else if ([field isEqualToString:APXDeviceFieldNotificationSettings]) {
+            
+            isConfirmed = device.isPushEnabled == ([value integerValue] != 0);
+            
+        } else if ([field isEqualToString:APXDeviceFieldLocale]) {
+            
+            isConfirmed = [device.locale length] && [[self languageOfLocale:device.locale] isEqualToString:[self languageOfLocale:value]];
+            
+        } else if ([field isEqualToString:APXDeviceFieldTimeZone]) {
+            
+            isConfirmed = [device.timeZone isEqualToString:value];
+            
+        } else if ([field isEqualToString:APXDeviceFieldOSVersion]) {
+            
+            isConfirmed = [device.osVersion isEqualToString:value];
+            
+        } else if ([field isEqualToString:APXDeviceFieldHardwareType]) {
+            
+            isConfirmed = [device.hardwearType isEqualToString:value];
+            
+        } else if ([field isEqualToString:APXDeviceFieldSDKVersion]) {
+            
+            isConfirmed = [device.sdkVersion isEqualToString:value];
+        }
+        
+        if (isConfirmed) [confirmedFields addObject:field];
+    }
+    
+    return confirmedFields;
+}
+
+- (NSString *)languageOfLocale:(NSString *)locale
+{
+    return [[[locale componentsSeparatedByCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"-_"]] firstObject] lowercaseString];
+}
+
+- (void)deferRegistrationWithToken:(NSData *)token
+/*
+  The changes are looked up again when the transfer runs, a registration deferred over a time zone change sends the time zone of then.
+*/
+{
+    APXLogDebug(APXLogSubsystemNetwork, @"Deferring a profile only registration until the radio is awake");
+    
+    __weak typeof(self) weakSelf = self;
+    
+    [self.transferScheduler scheduleTransferWithIdentifier:kAPXDeviceRegistrationTransferIdentifier maximumDelay:self.profileUpdateMaximumDelay block:^{
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            
+            APXDeviceRegistrationFilter *filter = weakSelf;
+            
+            if (!filter.pendingToken) filter.pendingToken = token;
+            
+            [filter registerChangesDeferringProfileUpdates:NO];
+        });
+    }];
+}
+
+#pragma mark - State
+
+- (NSSet *)changedFields
+{
+    return [self changedFieldsForState:[self currentState]];
+}
+
+- (NSSet *)changedFieldsForState:(NSDictionary *)state
+{
+    NSDictionary *acknowledged = [[NSUserDefaults standardUserDefaults] dictionaryForKey:kAPXAcknowledgedDeviceStateKey];
+    NSMutableSet *changedFields = [[NSMutableSet alloc] init];
+    
+    [state enumerateKeysAndObjectsUsingBlock:^(NSString *field, NSString *value, BOOL *stop) {
+        
+        if (![acknowledged[field] isEqualToString:[self hashForValue:value]]) {
+            
+            [changedFields addObject:field];
+        }
+    }];
+    
+    return changedFields;
+}
+
+- (void)acknowledgeFields:(NSSet *)fields ofState:(NSDictionary *)state
+{
+    NSMutableDictionary *acknowledged = [[[NSUserDefaults standardUserDefaults] dictionaryForKey:kAPXAcknowledgedDeviceStateKey] mutableCopy] ?: [[NSMutableDictionary alloc] init];
+    
+    for (NSString *field in fields) {
+        
+        if (state[field]) acknowledged[field] = [self hashForValue:state[field]];
+    }
+    
+    [[NSUserDefaults standardUserDefaults] setObject:acknowledged forKey:kAPXAcknowledgedDeviceStateKey];
+}
+
+- (void)exportDevice:(APXClientDevice *)device
+{
+    APXSharedStore *sharedStore = self.sharedStore;
+    
+    if (!sharedStore) return;
+    
+    NSDictionary *entry = [APXSharedStore entryForDevice:device];
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        
+        [sharedStore setObject:entry forKey:APXSharedStoreDeviceKey error:NULL];
+    });
+}
+
+- (void)reset
+{
+    [[NSUserDefaults standardUserDefaults] removeObjectForKey:kAPXAcknowledgedDeviceStateKey];
+}
+
+- (NSDictionary *)currentState
+/*
+  Only fields we currently know about take part, i.e. the token is missing until APNS handed it to us.
+*/
+{
+    NSMutableDictionary *state = [[NSMutableDictionary alloc] init];
+    
+    if (self.pendingToken) state[APXDeviceFieldPushToken] = [self hexStringForData:self.pendingToken];
+    if (self.pendingSettings) state[APXDeviceFieldNotificationSettings] = [self stringForSettings:self.pendingSettings];
+    
+    state[APXDeviceFieldLocale] = [[NSLocale preferredLanguages] firstObject] ?: @"";
+    state[APXDeviceFieldTimeZone] = [[NSTimeZone localTimeZone] name] ?: @"";
+    state[APXDeviceFieldOSVersion] = [[UIDevice currentDevice] systemVersion] ?: @"";
+    state[APXDeviceFieldHardwareType] = [self hardwareType];
+    state[APXDeviceFieldSDKVersion] = [Appoxee sdkVersion];
+    
+    return state;
+}
+
+- (NSString *)stringForSettings:(NSObject *)settings
+{
+    if ([settings respondsToSelector:@selector(types)]) {
+        
+        return [[settings valueForKey:@"types"] description];
+    }
+    
+    return [settings description];
+}
+
+- (NSString *)hardwareType
+{
+    size_t size = 0;
+    sysctlbyname("hw.machine", NULL, &size, NULL, 0);
+    
+    if (!size) return @"";
+    
+    char *machine = malloc(size);
+    sysctlbyname("hw.machine", machine, &size, NULL, 0);
+    NSString *hardwareType = [NSString stringWithUTF8String:machine];
+    free(machine);
+    
+    return hardwareType ?: @"";
+}
+
+#pragma mark - Hashing
+
+- (NSString *)hashForValue:(NSString *)value
+{
+    NSData *data = [value dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+    
+    return [self hexStringForData:[NSData dataWithBytes:digest length:CC_SHA256_DIGEST_LENGTH]];
+}
+
+- (NSString *)hexStringForData:(NSData *)data
+{
+    const unsigned char *bytes = data.bytes;
+    NSMutableString *hexString = [[NSMutableString alloc] initWithCapacity:data.length * 2];
+    
+    for (NSUInteger i = 0; i < data.length; i++) {
+        
+        [hexString appendFormat:@"%02x", bytes[i]];
+    }
+    
+    return hexString;
+}
+
+@end
@@ -0,0 +1,42 @@
+//
+//  APXInboxChangeSet.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class APXRichMessage;
+
+@interface APXInboxChangeMove : NSObject
+
+@property (nonatomic, readonly) NSUInteger fromIndex; // index in the previous snapshot
+@property (nonatomic, readonly) NSUInteger toIndex; // index in the new snapshot
+
+- (instancetype)initWithFromIndex:(NSUInteger)fromIndex toIndex:(NSUInteger)toIndex;
+
+@end
+
+// A batch of changes between two inbox snapshots, keyed by APXRichMessage uniqueID.
+// Deleted, updated and move 'from' indexes refer to the previous snapshot, inserted and move 'to' indexes refer to the new one,
+// which is exactly what UITableView expects inside a beginUpdates / endUpdates block.
+@interface APXInboxChangeSet : NSObject
+
+@property (nonatomic, strong, readonly) NSArray *messages; // of Type APXRichMessage, the new snapshot
+@property (nonatomic, strong, readonly) NSIndexSet *deletedIndexes;
+@property (nonatomic, strong, readonly) NSIndexSet *insertedIndexes;
+@property (nonatomic, strong, readonly) NSIndexSet *updatedIndexes;
+@property (nonatomic, strong, readonly) NSArray *moves; // of Type APXInboxChangeMove
+@property (nonatomic, readonly, getter = isEmpty) BOOL empty;
+
++ (instancetype)changeSetFromMessages:(NSArray *)oldMessages toMessages:(NSArray *)newMessages;
+
+// Every message updated in place, i.e. when all rows were formatted again.
++ (instancetype)changeSetUpdatingMessages:(NSArray *)messages;
+
+// Whether the two versions of a message look the same in the Inbox, i.e. their row doesn't need to be updated.
++ (BOOL)isMessage:(APXRichMessage *)message visiblyEqualToMessage:(APXRichMessage *)otherMessage;
+
+@end
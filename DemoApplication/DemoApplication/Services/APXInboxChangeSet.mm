@@ -0,0 +1,136 @@
+//
+//  APXInboxChangeSet.mm
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXInboxChangeSet.h"
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#include "apx/InboxDiff.h"
+
+@implementation APXInboxChangeMove
+
+- (instancetype)initWithFromIndex:(NSUInteger)fromIndex toIndex:(NSUInteger)toIndex
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _fromIndex = fromIndex;
+        _toIndex = toIndex;
+    }
+    
+    return self;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %lu -> %lu>", NSStringFromClass([self class]), (unsigned long)self.fromIndex, (unsigned long)self.toIndex];
+}
+
+@end
+
+@interface APXInboxChangeSet ()
+
+@property (nonatomic, strong, readwrite) NSArray *messages;
+@property (nonatomic, strong, readwrite) NSIndexSet *deletedIndexes;
+@property (nonatomic, strong, readwrite) NSIndexSet *insertedIndexes;
+@property (nonatomic, strong, readwrite) NSIndexSet *updatedIndexes;
+@property (nonatomic, strong, readwrite) NSArray *moves;
+
+@end
+
+@implementation APXInboxChangeSet
+
+#pragma mark - Diffing
+
++ (instancetype)changeSetFromMessages:(NSArray *)oldMessages toMessages:(NSArray *)newMessages
+/*
+  The diff itself is apx::diffInbox of the portable core, see Core/include/apx/InboxDiff.h.
+*/
+{
+    APXInboxChangeSet *changeSet = [[APXInboxChangeSet alloc] init];
+    changeSet.messages = [newMessages copy] ?: @[];
+    
+    apx::InboxChanges changes = apx::diffInbox([self uniqueIDsOfMessages:oldMessages], [self uniqueIDsOfMessages:newMessages], [&](std::size_t oldIndex, std::size_t newIndex) {
+        
+        return (bool)[self isMessage:oldMessages[oldIndex] visiblyEqualToMessage:newMessages[newIndex]];
+    });
+    
+    NSMutableArray *moves = [[NSMutableArray alloc] initWithCapacity:changes.moves.size()];
+    
+    for (const std::pair<std::size_t, std::size_t> &move : changes.moves) {
+        
+        [moves addObject:[[APXInboxChangeMove alloc] initWithFromIndex:move.first toIndex:move.second]];
+    }
+    
+    changeSet.deletedIndexes = [self indexSetWithIndexes:changes.deleted];
+    changeSet.insertedIndexes = [self indexSetWithIndexes:changes.inserted];
+    changeSet.updatedIndexes = [self indexSetWithIndexes:changes.updated];
+    changeSet.moves = moves;
+    
+    return changeSet;
+}
+
++ (instancetype)changeSetUpdatingMessages:(NSArray *)messages
+{
+    APXInboxChangeSet *changeSet = [[APXInboxChangeSet alloc] init];
+    changeSet.messages = [messages copy] ?: @[];
+    changeSet.deletedIndexes = [NSIndexSet indexSet];
+    changeSet.insertedIndexes = [NSIndexSet indexSet];
+    changeSet.updatedIndexes = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, [changeSet.messages count])];
+    changeSet.moves = @[];
+    
+    return changeSet;
+}
+
++ (std::vector<std::int64_t>)uniqueIDsOfMessages:(NSArray *)messages
+{
+    std::vector<std::int64_t> uniqueIDs;
+    uniqueIDs.reserve([messages count]);
+    
+    for (APXRichMessage *message in messages) {
+        
+        uniqueIDs.push_back(message.uniqueID);
+    }
+    
+    return uniqueIDs;
+}
+
++ (NSIndexSet *)indexSetWithIndexes:(const std::vector<std::size_t> &)indexes
+{
+    NSMutableIndexSet *indexSet = [[NSMutableIndexSet alloc] init];
+    
+    for (std::size_t index : indexes) {
+        
+        [indexSet addIndex:index];
+    }
+    
+    return indexSet;
+}
+
++ (BOOL)isMessage:(APXRichMessage *)message visiblyEqualToMessage:(APXRichMessage *)otherMessage
+{
+    if (message.isRead != otherMessage.isRead) return NO;
+    if (message.title != otherMessage.title && ![message.title isEqualToString:otherMessage.title]) return NO;
+    if (message.content != otherMessage.content && ![message.content isEqualToString:otherMessage.content]) return NO;
+    if (message.postDate != otherMessage.postDate && ![message.postDate isEqualToDate:otherMessage.postDate]) return NO;
+    
+    return YES;
+}
+
+#pragma mark - Getters
+
+- (BOOL)isEmpty
+{
+    return ![self.deletedIndexes count] && ![self.insertedIndexes count] && ![self.updatedIndexes count] && ![self.moves count];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: deleted %@, inserted %@, updated %@, moves %@>", NSStringFromClass([self class]), self.deletedIndexes, self.insertedIndexes, self.updatedIndexes, self.moves];
+}
+
+@end
@@ -0,0 +1,34 @@
+//
+//  APXInboxRetentionPolicy.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Keys of the APXInboxRetention dictionary in the Info.plist.
+extern NSString * const APXInboxRetentionMaximumAgeKey; // NSNumber, seconds since the post date
+extern NSString * const APXInboxRetentionMaximumCountKey; // NSNumber
+
+// Which Inbox messages are expired: the ones posted more than maximumAge ago, and the oldest ones beyond maximumCount.
+// A limit of 0 doesn't apply. Messages without a post date never expire by age, and are the first to go by count.
+@interface APXInboxRetentionPolicy : NSObject <NSCopying>
+
+@property (nonatomic, readonly) NSTimeInterval maximumAge;
+@property (nonatomic, readonly) NSUInteger maximumCount;
+
+// The policy of the APXInboxRetention dictionary in the Info.plist, nil if there is none or it sets no limit.
+// The demo ships without limits: expired messages are deleted at Appoxee, not only on the device.
++ (instancetype)defaultPolicy;
+
+// nil if the dictionary sets no limit.
++ (instancetype)policyWithDictionary:(NSDictionary *)dictionary;
+
+- (instancetype)initWithMaximumAge:(NSTimeInterval)maximumAge maximumCount:(NSUInteger)maximumCount;
+
+// Indexes into messages, of Type APXRichMessage, which are expired at date.
+- (NSIndexSet *)expiredIndexesOfMessages:(NSArray *)messages atDate:(NSDate *)date;
+
+@end
@@ -0,0 +1,113 @@
+//
+//  APXInboxRetentionPolicy.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXInboxRetentionPolicy.h"
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+NSString * const APXInboxRetentionMaximumAgeKey = @"inbox_max_age";
+NSString * const APXInboxRetentionMaximumCountKey = @"inbox_max_count";
+
+static NSString * const kAPXInboxRetentionInfoKey = @"APXInboxRetention";
+
+@implementation APXInboxRetentionPolicy
+
+#pragma mark - Initialization
+
++ (instancetype)defaultPolicy
+{
+    return [self policyWithDictionary:[[NSBundle mainBundle] objectForInfoDictionaryKey:kAPXInboxRetentionInfoKey]];
+}
+
++ (instancetype)policyWithDictionary:(NSDictionary *)dictionary
+{
+    if (![dictionary isKindOfClass:[NSDictionary class]]) return nil;
+    
+    id maximumAge = dictionary[APXInboxRetentionMaximumAgeKey];
+    id maximumCount = dictionary[APXInboxRetentionMaximumCountKey];
+    
+    NSTimeInterval age = [maximumAge isKindOfClass:[NSNumber class]] ? MAX([maximumAge doubleValue], 0.0) : 0.0;
+    NSInteger count = [maximumCount isKindOfClass:[NSNumber class]] ? MAX([maximumCount integerValue], 0) : 0;
+    
+    if (age == 0.0 && count == 0) return nil;
+    
+    return [[self alloc] initWithMaximumAge:age maximumCount:(NSUInteger)count];
+}
+
+- (instancetype)initWithMaximumAge:(NSTimeInterval)maximumAge maximumCount:(NSUInteger)maximumCount
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _maximumAge = MAX(maximumAge, 0.0);
+        _maximumCount = maximumCount;
+    }
+    
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // Immutable.
+    return self;
+}
+
+#pragma mark - Expiry
+
+- (NSIndexSet *)expiredIndexesOfMessages:(NSArray *)messages atDate:(NSDate *)date
+/*
+  The count limit is applied to the messages the age limit kept. Sorting is only needed when there are more of them than the limit.
+*/
+{
+    NSMutableIndexSet *expired = [[NSMutableIndexSet alloc] init];
+    
+    if (self.maximumAge > 0.0) {
+        
+        NSDate *oldestPostDate = [date dateByAddingTimeInterval:-self.maximumAge];
+        
+        [messages enumerateObjectsUsingBlock:^(APXRichMessage *message, NSUInteger idx, BOOL *stop) {
+            
+            if (message.postDate && [message.postDate compare:oldestPostDate] == NSOrderedAscending) [expired addIndex:idx];
+        }];
+    }
+    
+    NSUInteger keptCount = [messages count] - [expired count];
+    
+    if (self.maximumCount > 0 && keptCount > self.maximumCount) {
+        
+        NSMutableArray *keptIndexes = [[NSMutableArray alloc] initWithCapacity:keptCount];
+        
+        for (NSUInteger idx = 0; idx < [messages count]; idx++) {
+            
+            if (![expired containsIndex:idx]) [keptIndexes addObject:@(idx)];
+        }
+        
+        // Oldest first.
+        [keptIndexes sortUsingComparator:^NSComparisonResult(NSNumber *index, NSNumber *otherIndex) {
+            
+            NSDate *postDate = [messages[[index unsignedIntegerValue]] postDate] ?: [NSDate distantPast];
+            NSDate *otherPostDate = [messages[[otherIndex unsignedIntegerValue]] postDate] ?: [NSDate distantPast];
+            
+            return [postDate compare:otherPostDate];
+        }];
+        
+        for (NSUInteger i = 0; i < keptCount - self.maximumCount; i++) {
+            
+            [expired addIndex:[keptIndexes[i] unsignedIntegerValue]];
+        }
+    }
+    
+    return expired;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: max age %.0fs, max count %lu>", NSStringFromClass([self class]), self.maximumAge, (unsigned long)self.maximumCount];
+}
+
+@end
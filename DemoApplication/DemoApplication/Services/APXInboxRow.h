@@ -0,0 +1,28 @@
+//
+//  APXInboxRow.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+// What an Inbox list shows of a message, computed once per message version instead of once per cell.
+// Rows don't reference the message, so a list holding them doesn't keep message content alive. Open a row's message with
+// -[APXInboxStore messageWithID:].
+@interface APXInboxRow : NSObject <NSCopying>
+
+@property (nonatomic, readonly) NSInteger uniqueID;
+@property (nonatomic, copy, readonly) NSString *title;
+@property (nonatomic, copy, readonly) NSString *snippet; // the content without markup and runs of whitespace, at most snippetLength characters
+@property (nonatomic, strong, readonly) NSDate *postDate;
+@property (nonatomic, copy, readonly) NSString *postDateString; // short, relative date and time in the current locale, as of the day the row was made
+@property (nonatomic, readonly) BOOL isRead;
+
++ (instancetype)rowForMessage:(APXRichMessage *)message;
+
++ (NSUInteger)snippetLength;
+
+@end
@@ -0,0 +1,127 @@
+//
+//  APXInboxRow.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXInboxRow.h"
+
+// Two lines of a list cell on the widest iPhone.
+static NSUInteger const kAPXInboxRowSnippetLength = 120;
+
+@interface APXInboxRow ()
+
+@property (nonatomic, readwrite) NSInteger uniqueID;
+@property (nonatomic, copy, readwrite) NSString *title;
+@property (nonatomic, copy, readwrite) NSString *snippet;
+@property (nonatomic, strong, readwrite) NSDate *postDate;
+@property (nonatomic, copy, readwrite) NSString *postDateString;
+@property (nonatomic, readwrite) BOOL isRead;
+
+@end
+
+@implementation APXInboxRow
+
+#pragma mark - Initialization
+
++ (instancetype)rowForMessage:(APXRichMessage *)message
+{
+    APXInboxRow *row = [[self alloc] init];
+    
+    row.uniqueID = message.uniqueID;
+    row.title = message.title ?: @"";
+    row.snippet = [self snippetForContent:message.content];
+    row.postDate = message.postDate;
+    row.postDateString = message.postDate ? [[self dateFormatter] stringFromDate:message.postDate] : @"";
+    row.isRead = message.isRead;
+    
+    return row;
+}
+
++ (NSUInteger)snippetLength
+{
+    return kAPXInboxRowSnippetLength;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // Immutable.
+    return self;
+}
+
+#pragma mark - Formatting
+
++ (NSDateFormatter *)dateFormatter
+/*
+  Creating a formatter costs far more than formatting a date, every row shares this one. NSDateFormatter is thread safe since iOS 7.
+*/
+{
+    static NSDateFormatter *formatter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        formatter = [[NSDateFormatter alloc] init];
+        formatter.dateStyle = NSDateFormatterShortStyle;
+        formatter.timeStyle = NSDateFormatterShortStyle;
+        formatter.doesRelativeDateFormatting = YES;
+    });
+    
+    return formatter;
+}
+
++ (NSString *)snippetForContent:(NSString *)content
+/*
+  Only scans as much of the content as the snippet can show, long HTML messages cost the same as short ones.
+  A tag cut off by the scan is dropped like a complete one.
+*/
+{
+    if (![content length]) return @"";
+    
+    static NSRegularExpression *markup = nil;
+    static NSRegularExpression *whitespace = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        markup = [NSRegularExpression regularExpressionWithPattern:@"<[^>]*(>|$)" options:0 error:NULL];
+        whitespace = [NSRegularExpression regularExpressionWithPattern:@"\\s+" options:0 error:NULL];
+    });
+    
+    NSUInteger scanLength = MIN([content length], kAPXInboxRowSnippetLength * 8);
+    NSString *text = [content substringWithRange:[content rangeOfComposedCharacterSequencesForRange:NSMakeRange(0, scanLength)]];
+    
+    text = [markup stringByReplacingMatchesInString:text options:0 range:NSMakeRange(0, [text length]) withTemplate:@" "];
+    text = [whitespace stringByReplacingMatchesInString:text options:0 range:NSMakeRange(0, [text length]) withTemplate:@" "];
+    text = [text stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    
+    if ([text length] <= kAPXInboxRowSnippetLength) return text;
+    
+    NSRange range = [text rangeOfComposedCharacterSequencesForRange:NSMakeRange(0, kAPXInboxRowSnippetLength - 1)];
+    
+    return [[text substringWithRange:range] stringByAppendingString:@"…"];
+}
+
+#pragma mark - NSObject
+
+- (BOOL)isEqual:(id)object
+{
+    if (self == object) return YES;
+    if (![object isKindOfClass:[APXInboxRow class]]) return NO;
+    
+    APXInboxRow *row = object;
+    
+    return self.uniqueID == row.uniqueID && self.isRead == row.isRead && [self.title isEqualToString:row.title] && [self.snippet isEqualToString:row.snippet] && [self.postDateString isEqualToString:row.postDateString];
+}
+
+- (NSUInteger)hash
+{
+    return (NSUInteger)self.uniqueID ^ [self.title hash];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %ld '%@'%@>", NSStringFromClass([self class]), (long)self.uniqueID, self.title, self.isRead ? @"" : @" unread"];
+}
+
+@end
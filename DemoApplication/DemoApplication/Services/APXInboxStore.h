@@ -0,0 +1,84 @@
+//
+//  APXInboxStore.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXInboxChangeSet.h"
+#import "APXInboxRow.h"
+#import "APXInboxRetentionPolicy.h"
+#import "APXAppoxeeClient.h"
+#import "APXSharedStore.h"
+#import "APXContentPrefetcher.h"
+
+typedef void(^APXInboxStoreObserverBlock)(APXInboxChangeSet *changes);
+typedef void(^APXInboxStoreCollectionHandler)(NSUInteger collectedCount, BOOL finished);
+
+// A local mirror of the Appoxee Inbox.
+// Every mutation (server sync, incoming push, deletion, read marking) updates the snapshot, and observers receive one coalesced
+// APXInboxChangeSet per run loop turn on the main queue, so table views can apply batch updates instead of reloading the whole section.
+//
+// Threading: messages, rows and messageWithID: can be called from any thread and never wait, snapshots are immutable and replaced
+// with an atomic pointer swap on the main queue. Two reads may see two different snapshots, keep the array which was read rather than
+// reading the property again. Every other method must be called from the main queue.
+@interface APXInboxStore : NSObject
+
+// The snapshot observers have last been notified of, of Type APXRichMessage.
+// Reading it before adding an observer keeps a data source consistent with every change set that follows.
+@property (nonatomic, strong, readonly) NSArray *messages;
+
+// messages projected for an Inbox list, of Type APXInboxRow, in the same order. Updated along with messages, rows of messages which
+// didn't visibly change are reused. When the calendar day changes every row is made again, for "Today" and "Yesterday" to move on,
+// and observers receive a change set updating every message.
+@property (nonatomic, strong, readonly) NSArray *rows;
+@property (nonatomic, strong, readonly) id<APXAppoxeeClient> client;
+
+// Expired messages are left out of every snapshot, and wait for collectExpiredMessagesWithTimeBudget:completionHandler: to delete them.
+// Setting it re-reads the SDK's cache, so a snapshot taken under the previous policy is replaced. nil keeps every message.
+@property (nonatomic, copy) APXInboxRetentionPolicy *retentionPolicy;
+
+// Messages which expired but weren't deleted at Appoxee yet.
+@property (nonatomic, readonly) NSUInteger expiredMessageCount;
+
+// When set, every snapshot is mirrored into its Inbox section in the background, for the app's extensions to read.
+@property (nonatomic, strong) APXSharedStore *sharedStore;
+
+// When set, the pages read messages link to are downloaded in the background with every snapshot that changed, and removed with their message.
+@property (nonatomic, strong) APXContentPrefetcher *contentPrefetcher;
+
+// A store backed by [Appoxee shared] through [APXRateLimitedClient sharedClient], mirrored into [APXSharedStore sharedStore], with the default retention policy,
+// prefetching through [APXContentPrefetcher sharedPrefetcher].
++ (instancetype)sharedStore;
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client;
+- (instancetype)init NS_UNAVAILABLE;
+
+// The message of the snapshot with uniqueID, nil if there is none. Use it to open the message of an APXInboxRow.
+- (APXRichMessage *)messageWithID:(NSInteger)uniqueID;
+
+// Sync with Appoxee servers. handler receives the same arguments as refreshInboxWithCompletionHandler:.
+- (void)refreshWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+// Re-read the SDK's local Inbox cache without a server round trip, i.e. after a push was handled or a message was marked as read.
+- (void)reloadFromCacheWithCompletionHandler:(AppoxeeCompletionHandler)handler;
+
+// Removes the messages from the snapshot right away, and deletes them at Appoxee. Syncs leave them out until Appoxee answered.
+- (void)deleteMessages:(NSArray *)messages;
+
+// Marks the message as read through the SDK, which only does so when its messageLink is read, and picks up the new state from the SDK cache.
+- (void)markMessageAsRead:(APXRichMessage *)message;
+
+// Deletes expired messages at Appoxee in small batches, which shrinks the SDK's Inbox cache, until none are left or budget seconds
+// have passed. Messages which couldn't be deleted are retried by the next call. Call it from the main queue, i.e. during a background
+// fetch. handler is called on the main queue, finished tells whether every expired message was collected.
+- (void)collectExpiredMessagesWithTimeBudget:(NSTimeInterval)budget completionHandler:(APXInboxStoreCollectionHandler)handler;
+
+// The block is called on the main queue with every non empty change set. Returns a token for removeObserver:.
+- (id)addObserverWithBlock:(APXInboxStoreObserverBlock)block;
+- (void)removeObserver:(id)observer;
+
+@end
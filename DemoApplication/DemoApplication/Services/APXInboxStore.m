@@ -0,0 +1,514 @@
+//
+//  APXInboxStore.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXInboxStore.h"
+#import "APXPushEventQueue.h"
+#import "APXLogger.h"
+#import "APXMetrics.h"
+#import "APXRequestScheduler.h"
+#import "APXRateLimitedClient.h"
+
+// Small enough for a batch to finish well within a background fetch, should the budget run out right after it started.
+static NSUInteger const kAPXInboxStoreCollectionBatchSize = 10;
+
+// The messages observers have last seen, with their rows and index. Never changed once published, readers on any thread see all three
+// from the same sync.
+@interface APXInboxSnapshot : NSObject
+
+@property (nonatomic, copy, readonly) NSArray *messages;
+@property (nonatomic, copy, readonly) NSArray *rows;
+@property (nonatomic, copy, readonly) NSDictionary *indexesByID; // uniqueID -> index in messages
+
+- (instancetype)initWithMessages:(NSArray *)messages rows:(NSArray *)rows indexesByID:(NSDictionary *)indexesByID;
+
+@end
+
+@implementation APXInboxSnapshot
+
+- (instancetype)initWithMessages:(NSArray *)messages rows:(NSArray *)rows indexesByID:(NSDictionary *)indexesByID
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _messages = [messages copy];
+        _rows = [rows copy];
+        _indexesByID = [indexesByID copy];
+    }
+    
+    return self;
+}
+
+@end
+
+@interface APXInboxStore ()
+
+@property (atomic, strong) APXInboxSnapshot *snapshot; // published on the main queue, read from any thread
+@property (nonatomic, strong, readwrite) id<APXAppoxeeClient> client;
+@property (nonatomic, strong) NSArray *pendingMessages; // the snapshot the next change set will lead to
+@property (nonatomic, strong) NSMutableDictionary *observers; // token -> APXInboxStoreObserverBlock
+@property (nonatomic) BOOL isDeliveryScheduled;
+@property (nonatomic, strong) APXCounter *refreshCounter;
+@property (nonatomic, strong) APXHistogram *refreshLatency;
+@property (nonatomic, strong) APXCounter *cacheReadCounter;
+@property (nonatomic, strong) dispatch_queue_t exportQueue;
+@property (nonatomic, strong) NSArray *messagesToExport; // guarded by @synchronized (self), nil if no export is scheduled
+@property (nonatomic, strong) NSMutableDictionary *expiredMessages; // uniqueID -> APXRichMessage, waiting to be collected
+@property (nonatomic, strong) NSMutableSet *collectingIDs; // uniqueIDs of the batch being deleted
+@property (nonatomic, strong) NSMutableSet *deletingIDs; // uniqueIDs deleteMessages: removed, until Appoxee answered
+@property (nonatomic, strong) APXCounter *expiredCounter;
+
+@end
+
+@implementation APXInboxStore
+
+#pragma mark - Initialization
+
++ (instancetype)sharedStore
+{
+    static APXInboxStore *sharedStore = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedStore = [[self alloc] initWithClient:[APXRateLimitedClient sharedClient]];
+        sharedStore.sharedStore = [APXSharedStore sharedStore];
+        sharedStore.contentPrefetcher = [APXContentPrefetcher sharedPrefetcher];
+        sharedStore.retentionPolicy = [APXInboxRetentionPolicy defaultPolicy];
+    });
+    
+    return sharedStore;
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _client = client;
+        _snapshot = [[APXInboxSnapshot alloc] initWithMessages:@[] rows:@[] indexesByID:@{}];
+        _pendingMessages = @[];
+        _observers = [[NSMutableDictionary alloc] init];
+        _refreshCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricInboxRefreshes];
+        _refreshLatency = [[APXMetrics sharedMetrics] histogramNamed:APXMetricInboxRefreshLatency];
+        _cacheReadCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricInboxCacheReads];
+        _exportQueue = dispatch_queue_create("com.appoxee.demo.inbox-store.export", DISPATCH_QUEUE_SERIAL);
+        _expiredMessages = [[NSMutableDictionary alloc] init];
+        _collectingIDs = [[NSMutableSet alloc] init];
+        _deletingIDs = [[NSMutableSet alloc] init];
+        _expiredCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricInboxMessagesExpired];
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(calendarDayDidChange:) name:NSCalendarDayChangedNotification object:nil];
+    }
+    
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+#pragma mark - Messages
+
+- (NSArray *)messages
+{
+    return self.snapshot.messages;
+}
+
+- (NSArray *)rows
+{
+    return self.snapshot.rows;
+}
+
+- (APXRichMessage *)messageWithID:(NSInteger)uniqueID
+{
+    APXInboxSnapshot *snapshot = self.snapshot;
+    NSNumber *index = snapshot.indexesByID[@(uniqueID)];
+    
+    return index ? snapshot.messages[[index unsignedIntegerValue]] : nil;
+}
+
+- (void)publishMessages:(NSArray *)messages
+/*
+  Rows are projected once per message version. A message which didn't visibly change keeps the row it had, so a sync of a long Inbox
+  which changed a single message formats a single date.
+*/
+{
+    APXInboxSnapshot *previousSnapshot = self.snapshot;
+    NSArray *previousMessages = previousSnapshot.messages;
+    NSArray *previousRows = previousSnapshot.rows;
+    NSDictionary *previousIndexes = previousSnapshot.indexesByID;
+    
+    NSMutableArray *rows = [[NSMutableArray alloc] initWithCapacity:[messages count]];
+    NSMutableDictionary *indexes = [[NSMutableDictionary alloc] initWithCapacity:[messages count]];
+    
+    [messages enumerateObjectsUsingBlock:^(APXRichMessage *message, NSUInteger idx, BOOL *stop) {
+        
+        NSNumber *uniqueID = @(message.uniqueID);
+        NSNumber *previousIndex = previousIndexes[uniqueID];
+        APXInboxRow *row = nil;
+        
+        if (previousIndex) {
+            
+            APXRichMessage *previousMessage = previousMessages[[previousIndex unsignedIntegerValue]];
+            
+            if (previousMessage == message || [APXInboxChangeSet isMessage:previousMessage visiblyEqualToMessage:message]) {
+                
+                row = previousRows[[previousIndex unsignedIntegerValue]];
+            }
+        }
+        
+        [rows addObject:row ?: [APXInboxRow rowForMessage:message]];
+        indexes[uniqueID] = @(idx);
+    }];
+    
+    self.snapshot = [[APXInboxSnapshot alloc] initWithMessages:messages rows:rows indexesByID:indexes];
+}
+
+- (void)calendarDayDidChange:(NSNotification *)notification
+/*
+  Relative dates of the rows are only right on the day they were formatted. The messages stay, only their rows are made again.
+*/
+{
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        APXInboxSnapshot *snapshot = self.snapshot;
+        
+        if (![snapshot.messages count]) return;
+        
+        NSMutableArray *rows = [[NSMutableArray alloc] initWithCapacity:[snapshot.messages count]];
+        
+        for (APXRichMessage *message in snapshot.messages) {
+            
+            [rows addObject:[APXInboxRow rowForMessage:message]];
+        }
+        
+        self.snapshot = [[APXInboxSnapshot alloc] initWithMessages:snapshot.messages rows:rows indexesByID:snapshot.indexesByID];
+        
+        APXInboxChangeSet *changes = [APXInboxChangeSet changeSetUpdatingMessages:snapshot.messages];
+        
+        for (APXInboxStoreObserverBlock block in [self.observers allValues]) {
+            
+            block(changes);
+        }
+    });
+}
+
+#pragma mark - Sync
+
+- (void)refreshWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [[APXPushEventQueue sharedQueue] noteOutboundRequest];
+    
+    uint64_t start = APXMetricsNow();
+    [self.refreshCounter increment];
+    
+    // A full Inbox sync should not hold up requests the user is waiting on.
+    [[APXRequestScheduler sharedScheduler] scheduleRequest:^(AppoxeeCompletionHandler done) {
+        
+        [self.client refreshInboxWithCompletionHandler:done];
+        
+    } inLane:APXRequestLaneDefault completion:^(NSError *appoxeeError, id data) {
+        
+        [self.refreshLatency recordDurationSince:start];
+        [self handleMessages:data withError:appoxeeError completionHandler:handler];
+    }];
+}
+
+- (void)reloadFromCacheWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.cacheReadCounter increment];
+    
+    [self.client getRichMessagesWithHandler:^(NSError *appoxeeError, id data) {
+        
+        [self handleMessages:data withError:appoxeeError completionHandler:handler];
+    }];
+}
+
+- (void)handleMessages:(id)data withError:(NSError *)appoxeeError completionHandler:(AppoxeeCompletionHandler)handler
+{
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        if (!appoxeeError && [data isKindOfClass:[NSArray class]]) {
+            
+            [self updateMessages:(NSArray *)data];
+            
+        } else {
+            
+            APXLogWarning(APXLogSubsystemInbox, @"Inbox sync failed: %@", appoxeeError);
+        }
+        
+        if (handler) handler(appoxeeError, data);
+    });
+}
+
+#pragma mark - Mutations
+
+- (void)deleteMessages:(NSArray *)messages
+/*
+  A sync which started before a deletion reached Appoxee still returns the message. Until Appoxee answered, its uniqueID is kept aside
+  and left out of every snapshot. A failed deletion gives the message back with the next sync.
+*/
+{
+    NSMutableSet *uniqueIDs = [[NSMutableSet alloc] initWithCapacity:[messages count]];
+    
+    for (APXRichMessage *message in messages) {
+        
+        NSNumber *uniqueID = @(message.uniqueID);
+        
+        [uniqueIDs addObject:uniqueID];
+        [self.deletingIDs addObject:uniqueID];
+        
+        [self.client deleteRichMessage:message withHandler:^(NSError *appoxeeError, id data) {
+            
+            dispatch_async(dispatch_get_main_queue(), ^{
+                
+                [self.deletingIDs removeObject:uniqueID];
+                
+                if (appoxeeError) {
+                    
+                    APXLogWarning(APXLogSubsystemInbox, @"Message %@ could not be deleted: %@", uniqueID, appoxeeError);
+                }
+            });
+        }];
+    }
+    
+    NSIndexSet *remaining = [self.pendingMessages indexesOfObjectsPassingTest:^BOOL(APXRichMessage *message, NSUInteger idx, BOOL *stop) {
+        return ![uniqueIDs containsObject:@(message.uniqueID)];
+    }];
+    
+    [self updateMessages:[self.pendingMessages objectsAtIndexes:remaining]];
+}
+
+- (void)markMessageAsRead:(APXRichMessage *)message
+/*
+  The SDK has no call of its own for it, reading messageLink is what marks the message as read in its cache. The cache is read once
+  the SDK has, so the snapshot can't miss it.
+*/
+{
+    if (!message || message.isRead) return;
+    
+    (void)message.messageLink;
+    
+    [self reloadFromCacheWithCompletionHandler:nil];
+}
+
+- (void)updateMessages:(NSArray *)messages
+{
+    if ([self.deletingIDs count]) {
+        
+        messages = [messages objectsAtIndexes:[messages indexesOfObjectsPassingTest:^BOOL(APXRichMessage *message, NSUInteger idx, BOOL *stop) {
+            return ![self.deletingIDs containsObject:@(message.uniqueID)];
+        }]];
+    }
+    
+    self.pendingMessages = [self messagesRemovingExpired:messages];
+    
+    [self scheduleDelivery];
+}
+
+#pragma mark - Retention
+
+- (void)setRetentionPolicy:(APXInboxRetentionPolicy *)retentionPolicy
+{
+    _retentionPolicy = [retentionPolicy copy];
+    
+    if (![self.pendingMessages count] && ![self.expiredMessages count]) return;
+    
+    // Messages set aside under the previous policy may not be expired under this one, the snapshot is rebuilt from the SDK's cache.
+    [self.expiredMessages removeAllObjects];
+    [self reloadFromCacheWithCompletionHandler:nil];
+}
+
+- (NSUInteger)expiredMessageCount
+{
+    return [self.expiredMessages count] + [self.collectingIDs count];
+}
+
+- (NSArray *)messagesRemovingExpired:(NSArray *)messages
+/*
+  Expired messages stay in the SDK's cache until they are collected, so every sync returns them again. They are only set aside once.
+*/
+{
+    NSIndexSet *expired = [self.retentionPolicy expiredIndexesOfMessages:messages atDate:[NSDate date]];
+    
+    if (![expired count]) return [messages copy];
+    
+    [messages enumerateObjectsAtIndexes:expired options:0 usingBlock:^(APXRichMessage *message, NSUInteger idx, BOOL *stop) {
+        
+        NSNumber *uniqueID = @(message.uniqueID);
+        
+        if (!self.expiredMessages[uniqueID] && ![self.collectingIDs containsObject:uniqueID]) {
+            
+            self.expiredMessages[uniqueID] = message;
+            [self.expiredCounter increment];
+        }
+    }];
+    
+    NSMutableArray *keptMessages = [messages mutableCopy];
+    [keptMessages removeObjectsAtIndexes:expired];
+    
+    return keptMessages;
+}
+
+- (void)collectExpiredMessagesWithTimeBudget:(NSTimeInterval)budget completionHandler:(APXInboxStoreCollectionHandler)handler
+{
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:MAX(budget, 0.0)];
+    
+    [self collectExpiredMessagesBefore:deadline collectedCount:0 completionHandler:handler];
+}
+
+- (void)collectExpiredMessagesBefore:(NSDate *)deadline collectedCount:(NSUInteger)collectedCount completionHandler:(APXInboxStoreCollectionHandler)handler
+/*
+  One batch at a time, and no batch starts after the deadline. A batch with a failed deletion ends the pass, rather than retrying
+  the same messages until the budget runs out.
+*/
+{
+    if (![self.expiredMessages count] || [self.collectingIDs count] || [deadline timeIntervalSinceNow] <= 0) {
+        
+        if (handler) handler(collectedCount, self.expiredMessageCount == 0);
+        return;
+    }
+    
+    NSArray *uniqueIDs = [[self.expiredMessages allKeys] sortedArrayUsingSelector:@selector(compare:)];
+    NSArray *batch = [uniqueIDs subarrayWithRange:NSMakeRange(0, MIN([uniqueIDs count], kAPXInboxStoreCollectionBatchSize))];
+    
+    NSMutableArray *failedMessages = [[NSMutableArray alloc] init];
+    dispatch_group_t group = dispatch_group_create();
+    
+    for (NSNumber *uniqueID in batch) {
+        
+        APXRichMessage *message = self.expiredMessages[uniqueID];
+        
+        [self.expiredMessages removeObjectForKey:uniqueID];
+        [self.collectingIDs addObject:uniqueID];
+        
+        dispatch_group_enter(group);
+        [self.client deleteRichMessage:message withHandler:^(NSError *appoxeeError, id data) {
+            
+            if (appoxeeError) {
+                
+                @synchronized (failedMessages) {
+                    
+                    [failedMessages addObject:message];
+                }
+            }
+            
+            dispatch_group_leave(group);
+        }];
+    }
+    
+    dispatch_group_notify(group, dispatch_get_main_queue(), ^{
+        
+        [self.collectingIDs minusSet:[NSSet setWithArray:batch]];
+        
+        for (APXRichMessage *message in failedMessages) {
+            
+            self.expiredMessages[@(message.uniqueID)] = message;
+        }
+        
+        NSUInteger batchCount = [batch count] - [failedMessages count];
+        APXLogDebug(APXLogSubsystemInbox, @"Collected %lu expired messages", (unsigned long)batchCount);
+        
+        if ([failedMessages count]) {
+            
+            APXLogWarning(APXLogSubsystemInbox, @"%lu expired messages could not be deleted", (unsigned long)[failedMessages count]);
+            
+            if (handler) handler(collectedCount + batchCount, NO);
+            return;
+        }
+        
+        [self collectExpiredMessagesBefore:deadline collectedCount:collectedCount + batchCount completionHandler:handler];
+    });
+}
+
+#pragma mark - Observers
+
+- (id)addObserverWithBlock:(APXInboxStoreObserverBlock)block
+{
+    NSString *token = [[NSUUID UUID] UUIDString];
+    
+    if (block) self.observers[token] = [block copy];
+    
+    return token;
+}
+
+- (void)removeObserver:(id)observer
+{
+    if (observer) [self.observers removeObjectForKey:observer];
+}
+
+- (void)scheduleDelivery
+/*
+  Any number of mutations within the same run loop turn result in a single change set,
+  computed between the snapshot observers saw last and the pending one.
+*/
+{
+    if (self.isDeliveryScheduled) return;
+    
+    self.isDeliveryScheduled = YES;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        self.isDeliveryScheduled = NO;
+        
+        APXInboxChangeSet *changes = [APXInboxChangeSet changeSetFromMessages:self.messages toMessages:self.pendingMessages];
+        
+        [self publishMessages:self.pendingMessages];
+        
+        if (changes.isEmpty) return;
+        
+        for (APXInboxStoreObserverBlock block in [self.observers allValues]) {
+            
+            block(changes);
+        }
+        
+        [self exportMessages:self.messages];
+        [self.contentPrefetcher prefetchContentForMessages:self.messages];
+    });
+}
+
+#pragma mark - Export
+
+- (void)exportMessages:(NSArray *)messages
+/*
+  While a write is pending further snapshots only replace the one it will pick up, a burst of change sets costs a single write.
+*/
+{
+    if (!self.sharedStore) return;
+    
+    @synchronized (self) {
+        
+        BOOL isScheduled = self.messagesToExport != nil;
+        self.messagesToExport = messages;
+        
+        if (isScheduled) return;
+    }
+    
+    APXSharedStore *sharedStore = self.sharedStore;
+    
+    dispatch_async(self.exportQueue, ^{
+        
+        NSArray *latestMessages = nil;
+        
+        @synchronized (self) {
+            
+            latestMessages = self.messagesToExport;
+            self.messagesToExport = nil;
+        }
+        
+        NSError *error = nil;
+        
+        if (![sharedStore setObject:[APXSharedStore entriesForMessages:latestMessages] forKey:APXSharedStoreInboxKey error:&error]) {
+            
+            APXLogWarning(APXLogSubsystemStorage, @"Inbox export failed: %@", error);
+        }
+    });
+}
+
+@end
@@ -0,0 +1,92 @@
+//
+//  APXLogger.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+typedef NS_ENUM(uint8_t, APXLogLevel) {
+    APXLogLevelOff = 0,
+    APXLogLevelError,
+    APXLogLevelWarning,
+    APXLogLevelInfo,
+    APXLogLevelDebug,
+    APXLogLevelVerbose
+};
+
+typedef NS_ENUM(uint8_t, APXLogSubsystem) {
+    APXLogSubsystemNetwork = 0,
+    APXLogSubsystemInbox,
+    APXLogSubsystemPush,
+    APXLogSubsystemStorage,
+    APXLogSubsystemCount
+};
+
+// Levels above APX_LOG_COMPILE_LEVEL are compiled out, their arguments are never evaluated.
+#ifndef APX_LOG_COMPILE_LEVEL
+#ifdef DEBUG
+#define APX_LOG_COMPILE_LEVEL APXLogLevelVerbose
+#else
+#define APX_LOG_COMPILE_LEVEL APXLogLevelInfo
+#endif
+#endif
+
+// Runtime level per subsystem, read without a lock on every log call. Set it through APXLogger.
+extern volatile uint8_t APXLogSubsystemLevels[APXLogSubsystemCount];
+
+static inline BOOL APXLogIsEnabled(APXLogLevel level, APXLogSubsystem subsystem)
+{
+    return subsystem < APXLogSubsystemCount && level <= APXLogSubsystemLevels[subsystem];
+}
+
+void APXLogWrite(APXLogLevel level, APXLogSubsystem subsystem, NSString *format, ...) NS_FORMAT_FUNCTION(3,4);
+
+#define APXLog(level, subsystem, format, ...) \
+    do { if ((level) <= APX_LOG_COMPILE_LEVEL && APXLogIsEnabled((level), (subsystem))) APXLogWrite((level), (subsystem), (format), ##__VA_ARGS__); } while (0)
+
+#define APXLogError(subsystem, format, ...) APXLog(APXLogLevelError, subsystem, format, ##__VA_ARGS__)
+#define APXLogWarning(subsystem, format, ...) APXLog(APXLogLevelWarning, subsystem, format, ##__VA_ARGS__)
+#define APXLogInfo(subsystem, format, ...) APXLog(APXLogLevelInfo, subsystem, format, ##__VA_ARGS__)
+#define APXLogDebug(subsystem, format, ...) APXLog(APXLogLevelDebug, subsystem, format, ##__VA_ARGS__)
+#define APXLogVerbose(subsystem, format, ...) APXLog(APXLogLevelVerbose, subsystem, format, ##__VA_ARGS__)
+
+// Keys of a decoded record.
+extern NSString * const APXLogRecordDateKey; // NSDate
+extern NSString * const APXLogRecordLevelKey; // NSNumber of APXLogLevel
+extern NSString * const APXLogRecordSubsystemKey; // NSNumber of APXLogSubsystem
+extern NSString * const APXLogRecordThreadKey; // NSNumber, the Mach thread ID
+extern NSString * const APXLogRecordMessageKey; // NSString
+
+// A structured logger cheap enough to leave on in the field.
+// The calling thread only formats the message and copies it into a ring buffer of its own, no lock is taken.
+// A background queue drains every thread's buffer once a second into a binary log file, rotated by size.
+// When a buffer is full, records are dropped and the number dropped is logged instead.
+@interface APXLogger : NSObject
+
+@property (nonatomic, strong, readonly) NSURL *directoryURL;
+@property (nonatomic) unsigned long long maximumFileSize; // default is 512KB
+@property (nonatomic) NSUInteger maximumFileCount; // default is 4
+
++ (instancetype)sharedLogger;
+
+// Defaults to APXLogLevelInfo for every subsystem.
+- (void)setLevel:(APXLogLevel)level forSubsystem:(APXLogSubsystem)subsystem;
+- (APXLogLevel)levelForSubsystem:(APXLogSubsystem)subsystem;
+
+// Writes every buffered record to disk before returning, i.e. before the app is suspended.
+- (void)flush;
+
+// Log files, oldest first.
+- (NSArray *)logFileURLs;
+
+#pragma mark - Decoding
+
+// Returns the records of a binary log file, of Type NSDictionary, or nil if it's not a log file.
++ (NSArray *)recordsInLogFileAtURL:(NSURL *)url;
+
++ (NSString *)lineForRecord:(NSDictionary *)record;
+
+@end
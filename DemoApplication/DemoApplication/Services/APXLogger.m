@@ -0,0 +1,394 @@
+//
+//  APXLogger.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXLogger.h"
+#import <pthread.h>
+#import <stdatomic.h>
+
+NSString * const APXLogRecordDateKey = @"date";
+NSString * const APXLogRecordLevelKey = @"level";
+NSString * const APXLogRecordSubsystemKey = @"subsystem";
+NSString * const APXLogRecordThreadKey = @"thread";
+NSString * const APXLogRecordMessageKey = @"message";
+
+volatile uint8_t APXLogSubsystemLevels[APXLogSubsystemCount] = {APXLogLevelInfo, APXLogLevelInfo, APXLogLevelInfo, APXLogLevelInfo};
+
+#define kAPXLogRingCapacity 256 // slots per thread, a power of two
+#define kAPXLogMessageCapacity 232 // UTF-8 bytes, longer messages are truncated
+
+static const char kAPXLogFileMagic[4] = {'A', 'P', 'X', 'L'};
+static const uint32_t kAPXLogFileVersion = 1;
+static NSTimeInterval const kAPXLogFlushInterval = 1.0;
+
+// File layout, little endian: the magic and the version, followed by records of
+// timestamp (double, CFAbsoluteTime), thread (uint64), level (uint8), subsystem (uint8), length (uint16), and 'length' bytes of UTF-8.
+typedef struct __attribute__((packed)) {
+    double timestamp;
+    uint64_t thread;
+    uint8_t level;
+    uint8_t subsystem;
+    uint16_t length;
+} APXLogRecordHeader;
+
+typedef struct {
+    APXLogRecordHeader header;
+    char message[kAPXLogMessageCapacity];
+} APXLogSlot;
+
+// Single producer (the owning thread), single consumer (the flush queue).
+typedef struct APXLogRing {
+    _Atomic(uint32_t) head;
+    _Atomic(uint32_t) tail;
+    _Atomic(uint32_t) dropped;
+    _Atomic(bool) isThreadAlive;
+    struct APXLogRing *next;
+    uint64_t thread;
+    APXLogSlot slots[kAPXLogRingCapacity];
+} APXLogRing;
+
+// Threads push their ring to the front of the list, only the flush queue unlinks rings.
+static APXLogRing * _Atomic APXLogRings = NULL;
+static pthread_key_t APXLogRingKey;
+
+static void APXLogRingThreadDidExit(void *ring)
+{
+    atomic_store_explicit(&((APXLogRing *)ring)->isThreadAlive, false, memory_order_release);
+}
+
+static APXLogRing *APXLogCurrentRing(void)
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        pthread_key_create(&APXLogRingKey, APXLogRingThreadDidExit);
+    });
+    
+    APXLogRing *ring = pthread_getspecific(APXLogRingKey);
+    
+    if (ring) return ring;
+    
+    ring = calloc(1, sizeof(APXLogRing));
+    
+    if (!ring) return NULL;
+    
+    pthread_threadid_np(NULL, &ring->thread);
+    atomic_init(&ring->isThreadAlive, true);
+    pthread_setspecific(APXLogRingKey, ring);
+    
+    ring->next = atomic_load(&APXLogRings);
+    while (!atomic_compare_exchange_weak(&APXLogRings, &ring->next, ring));
+    
+    // The first record of the process starts the flush timer.
+    [APXLogger sharedLogger];
+    
+    return ring;
+}
+
+void APXLogWrite(APXLogLevel level, APXLogSubsystem subsystem, NSString *format, ...)
+{
+    APXLogRing *ring = APXLogCurrentRing();
+    
+    if (!ring) return;
+    
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    
+    if (head - tail >= kAPXLogRingCapacity) {
+        
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    
+    va_list arguments;
+    va_start(arguments, format);
+    NSString *message = [[NSString alloc] initWithFormat:format arguments:arguments];
+    va_end(arguments);
+    
+    APXLogSlot *slot = &ring->slots[head & (kAPXLogRingCapacity - 1)];
+    NSUInteger length = 0;
+    
+    [message getBytes:slot->message maxLength:kAPXLogMessageCapacity usedLength:&length encoding:NSUTF8StringEncoding options:NSStringEncodingConversionAllowLossy range:NSMakeRange(0, [message length]) remainingRange:NULL];
+    
+    slot->header.timestamp = CFAbsoluteTimeGetCurrent();
+    slot->header.thread = ring->thread;
+    slot->header.level = level;
+    slot->header.subsystem = subsystem;
+    slot->header.length = (uint16_t)length;
+    
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+@interface APXLogger ()
+
+@property (nonatomic, strong, readwrite) NSURL *directoryURL;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) dispatch_source_t timer;
+@property (nonatomic, strong) NSFileHandle *fileHandle;
+
+@end
+
+@implementation APXLogger
+
+#pragma mark - Initialization
+
++ (instancetype)sharedLogger
+{
+    static APXLogger *sharedLogger = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedLogger = [[self alloc] init];
+    });
+    
+    return sharedLogger;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        
+        NSURL *caches = [[[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask] firstObject];
+        
+        _directoryURL = [caches URLByAppendingPathComponent:@"APXLogs" isDirectory:YES];
+        _maximumFileSize = 512 * 1024;
+        _maximumFileCount = 4;
+        _queue = dispatch_queue_create("com.appoxee.demo.logger", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        _timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _queue);
+        
+        [[NSFileManager defaultManager] createDirectoryAtURL:_directoryURL withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        __weak typeof(self) weakSelf = self;
+        dispatch_source_set_timer(_timer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kAPXLogFlushInterval * NSEC_PER_SEC)), (uint64_t)(kAPXLogFlushInterval * NSEC_PER_SEC), (uint64_t)(kAPXLogFlushInterval * NSEC_PER_SEC / 2));
+        dispatch_source_set_event_handler(_timer, ^{
+            
+            [weakSelf drainRings];
+        });
+        dispatch_resume(_timer);
+    }
+    
+    return self;
+}
+
+#pragma mark - Levels
+
+- (void)setLevel:(APXLogLevel)level forSubsystem:(APXLogSubsystem)subsystem
+{
+    if (subsystem < APXLogSubsystemCount) APXLogSubsystemLevels[subsystem] = level;
+}
+
+- (APXLogLevel)levelForSubsystem:(APXLogSubsystem)subsystem
+{
+    return subsystem < APXLogSubsystemCount ? APXLogSubsystemLevels[subsystem] : APXLogLevelOff;
+}
+
+#pragma mark - Flushing
+
+- (void)flush
+{
+    dispatch_sync(self.queue, ^{
+        
+        [self drainRings];
+        [self.fileHandle synchronizeFile];
+    });
+}
+
+- (void)drainRings
+/*
+  Called on 'queue'. Copies every pending record into one buffer, so each flush costs a single write.
+*/
+{
+    NSMutableData *data = [[NSMutableData alloc] init];
+    APXLogRing *previous = NULL;
+    APXLogRing *ring = atomic_load(&APXLogRings);
+    
+    while (ring) {
+        
+        APXLogRing *next = ring->next;
+        BOOL isThreadAlive = atomic_load_explicit(&ring->isThreadAlive, memory_order_acquire);
+        
+        [self drainRing:ring intoData:data];
+        
+        // A ring can only be unlinked behind another one, the front of the list belongs to the threads.
+        if (!isThreadAlive && previous) {
+            
+            previous->next = next;
+            free(ring);
+            
+        } else {
+            
+            previous = ring;
+        }
+        
+        ring = next;
+    }
+    
+    if ([data length]) [self appendData:data];
+}
+
+- (void)drainRing:(APXLogRing *)ring intoData:(NSMutableData *)data
+{
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    
+    while (tail != head) {
+        
+        APXLogSlot *slot = &ring->slots[tail & (kAPXLogRingCapacity - 1)];
+        
+        [data appendBytes:&slot->header length:sizeof(APXLogRecordHeader)];
+        [data appendBytes:slot->message length:slot->header.length];
+        tail++;
+    }
+    
+    atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    
+    uint32_t dropped = atomic_exchange_explicit(&ring->dropped, 0, memory_order_relaxed);
+    
+    if (dropped) {
+        
+        NSData *message = [[NSString stringWithFormat:@"%u log records dropped", dropped] dataUsingEncoding:NSUTF8StringEncoding];
+        APXLogRecordHeader header = {CFAbsoluteTimeGetCurrent(), ring->thread, APXLogLevelWarning, APXLogSubsystemStorage, (uint16_t)[message length]};
+        
+        [data appendBytes:&header length:sizeof(APXLogRecordHeader)];
+        [data appendData:message];
+    }
+}
+
+- (void)appendData:(NSData *)data
+/*
+  Called on 'queue'.
+*/
+{
+    if (!self.fileHandle || [self.fileHandle offsetInFile] + [data length] > self.maximumFileSize) {
+        
+        [self rotate];
+    }
+    
+    @try {
+        
+        [self.fileHandle writeData:data];
+        
+    } @catch (NSException *exception) {
+        
+        // Out of disk space, the records are lost.
+        self.fileHandle = nil;
+    }
+}
+
+- (void)rotate
+/*
+  Called on 'queue'. APXLog.0.bin is the newest file.
+*/
+{
+    [self.fileHandle closeFile];
+    self.fileHandle = nil;
+    
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSURL *current = [self fileURLAtIndex:0];
+    
+    if ([fileManager fileExistsAtPath:current.path]) {
+        
+        [fileManager removeItemAtURL:[self fileURLAtIndex:MAX(self.maximumFileCount, (NSUInteger)1) - 1] error:nil];
+        
+        for (NSInteger index = (NSInteger)MAX(self.maximumFileCount, (NSUInteger)1) - 2; index >= 0; index--) {
+            
+            [fileManager moveItemAtURL:[self fileURLAtIndex:index] toURL:[self fileURLAtIndex:index + 1] error:nil];
+        }
+    }
+    
+    NSMutableData *header = [[NSMutableData alloc] initWithBytes:kAPXLogFileMagic length:sizeof(kAPXLogFileMagic)];
+    [header appendBytes:&kAPXLogFileVersion length:sizeof(kAPXLogFileVersion)];
+    
+    [header writeToURL:current atomically:YES];
+    
+    self.fileHandle = [NSFileHandle fileHandleForWritingToURL:current error:nil];
+    [self.fileHandle seekToEndOfFile];
+}
+
+- (NSURL *)fileURLAtIndex:(NSUInteger)index
+{
+    return [self.directoryURL URLByAppendingPathComponent:[NSString stringWithFormat:@"APXLog.%lu.bin", (unsigned long)index]];
+}
+
+- (NSArray *)logFileURLs
+{
+    NSMutableArray *urls = [[NSMutableArray alloc] init];
+    
+    for (NSUInteger index = 0; index < self.maximumFileCount; index++) {
+        
+        NSURL *url = [self fileURLAtIndex:index];
+        
+        if ([[NSFileManager defaultManager] fileExistsAtPath:url.path]) [urls insertObject:url atIndex:0];
+    }
+    
+    return urls;
+}
+
+#pragma mark - Decoding
+
++ (NSArray *)recordsInLogFileAtURL:(NSURL *)url
+{
+    NSData *data = [NSData dataWithContentsOfURL:url options:NSDataReadingMappedIfSafe error:nil];
+    NSUInteger preambleLength = sizeof(kAPXLogFileMagic) + sizeof(kAPXLogFileVersion);
+    
+    if ([data length] < preambleLength || memcmp(data.bytes, kAPXLogFileMagic, sizeof(kAPXLogFileMagic))) return nil;
+    
+    uint32_t version = 0;
+    [data getBytes:&version range:NSMakeRange(sizeof(kAPXLogFileMagic), sizeof(version))];
+    
+    if (version != kAPXLogFileVersion) return nil;
+    
+    NSMutableArray *records = [[NSMutableArray alloc] init];
+    NSUInteger offset = preambleLength;
+    
+    // A record cut short by a crash ends the file.
+    while (offset + sizeof(APXLogRecordHeader) <= [data length]) {
+        
+        APXLogRecordHeader header;
+        [data getBytes:&header range:NSMakeRange(offset, sizeof(header))];
+        offset += sizeof(header);
+        
+        if (offset + header.length > [data length]) break;
+        
+        NSString *message = [[NSString alloc] initWithBytes:(const char *)data.bytes + offset length:header.length encoding:NSUTF8StringEncoding];
+        offset += header.length;
+        
+        [records addObject:@{APXLogRecordDateKey : [NSDate dateWithTimeIntervalSinceReferenceDate:header.timestamp],
+                             APXLogRecordLevelKey : @(header.level),
+                             APXLogRecordSubsystemKey : @(header.subsystem),
+                             APXLogRecordThreadKey : @(header.thread),
+                             APXLogRecordMessageKey : message ?: @""}];
+    }
+    
+    return records;
+}
+
++ (NSString *)lineForRecord:(NSDictionary *)record
+{
+    static NSDateFormatter *formatter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        formatter = [[NSDateFormatter alloc] init];
+        formatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+        formatter.dateFormat = @"yyyy-MM-dd HH:mm:ss.SSS";
+    });
+    
+    NSArray *levels = @[@"OFF", @"ERROR", @"WARNING", @"INFO", @"DEBUG", @"VERBOSE"];
+    NSArray *subsystems = @[@"network", @"inbox", @"push", @"storage"];
+    NSUInteger level = [record[APXLogRecordLevelKey] unsignedIntegerValue];
+    NSUInteger subsystem = [record[APXLogRecordSubsystemKey] unsignedIntegerValue];
+    
+    return [NSString stringWithFormat:@"%@ [%@] [%@] [%@] %@",
+            [formatter stringFromDate:record[APXLogRecordDateKey]],
+            level < [levels count] ? levels[level] : record[APXLogRecordLevelKey],
+            subsystem < [subsystems count] ? subsystems[subsystem] : record[APXLogRecordSubsystemKey],
+            record[APXLogRecordThreadKey],
+            record[APXLogRecordMessageKey]];
+}
+
+@end
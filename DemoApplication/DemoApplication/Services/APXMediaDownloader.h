@@ -0,0 +1,54 @@
+//
+//  APXMediaDownloader.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+extern NSString * const APXMediaDownloaderErrorDomain;
+
+typedef NS_ENUM(NSInteger, APXMediaDownloaderError) {
+    APXMediaDownloaderErrorTooLarge = 1, // the file is larger than maximumBytesPerFile
+    APXMediaDownloaderErrorDeadlineExceeded, // the partial file is kept, the next download of the URL resumes it
+    APXMediaDownloaderErrorHTTPStatus, // the server answered with neither 200 nor 206
+    APXMediaDownloaderErrorNoMedia // the notification doesn't reference any media
+};
+
+typedef void(^APXMediaDownloadCompletion)(NSURL *fileURL, NSError *error);
+typedef void(^APXMediaDownloadsCompletion)(NSArray *fileURLs, NSError *error);
+
+// Downloads rich push media for a notification service extension within its memory and time limits.
+// Bytes are streamed to disk as they arrive and a download is cancelled as soon as it exceeds its cap. An interrupted download
+// is resumed with a Range request. Finished files are kept under the SHA-256 of their content, hashed once the download finished, so
+// the same image sent under several URLs is stored once. A URL which is in the cache isn't downloaded again.
+// The app and its extensions share the cache: the index and every partial file are guarded by flock, like APXSharedStore.
+@interface APXMediaDownloader : NSObject
+
+@property (nonatomic, strong, readonly) NSURL *cacheDirectoryURL;
+@property (nonatomic) unsigned long long maximumBytesPerFile; // default is 10 MB
+@property (nonatomic) unsigned long long maximumCacheBytes; // least recently used files are evicted beyond it, default is 50 MB
+@property (nonatomic, copy) NSString *mediaKey; // the extraFields key holding a URL string or an array of them, default is "media"
+
+// A downloader caching next to [APXSharedStore sharedStore], so the app and its extensions share the cache.
++ (instancetype)sharedDownloader;
+
+- (instancetype)initWithCacheDirectoryURL:(NSURL *)cacheDirectoryURL configuration:(NSURLSessionConfiguration *)configuration;
+
+// The http(s) URLs in the notification's extraFields under mediaKey.
+- (NSArray *)mediaURLsForNotification:(APXPushNotification *)notification;
+
+// handler is called on the main queue no later than deadline, with the files which were downloaded in the order of mediaURLsForNotification:,
+// and the first error if any failed. Pass a deadline comfortably inside the extension's time budget.
+- (void)downloadMediaForNotification:(APXPushNotification *)notification deadline:(NSDate *)deadline completionHandler:(APXMediaDownloadsCompletion)handler;
+
+// handler is called on the main queue no later than deadline. The file is a hard link to the cached one, which
+// UNNotificationAttachment can move away without evicting it. Concurrent downloads of the same URL share one request.
+- (void)downloadMediaAtURL:(NSURL *)URL deadline:(NSDate *)deadline completionHandler:(APXMediaDownloadCompletion)handler;
+
+- (void)removeAllCachedMedia;
+
+@end
@@ -0,0 +1,747 @@
+//
+//  APXMediaDownloader.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXMediaDownloader.h"
+#import <CommonCrypto/CommonDigest.h>
+#import "APXSharedStore.h"
+#import "APXLogger.h"
+#import <sys/file.h>
+#import <sys/stat.h>
+
+NSString * const APXMediaDownloaderErrorDomain = @"APXMediaDownloaderErrorDomain";
+
+static unsigned long long const kAPXMediaDefaultMaximumBytesPerFile = 10 * 1024 * 1024;
+static unsigned long long const kAPXMediaDefaultMaximumCacheBytes = 50 * 1024 * 1024;
+static NSUInteger const kAPXMediaHashChunkSize = 64 * 1024;
+static NSTimeInterval const kAPXMediaPartialMaximumAge = 24 * 60 * 60; // an unused partial file older than this isn't worth resuming
+static NSTimeInterval const kAPXMediaLinkMaximumAge = 60 * 60; // links handed out to callers which never moved them away
+
+static NSString * const kAPXMediaIndexFileName = @"APXMediaIndex.plist";
+static NSString * const kAPXMediaIndexLockFileName = @"APXMediaIndex.lock";
+static NSString * const kAPXMediaIndexFilesKey = @"files"; // URL key -> cached file name
+static NSString * const kAPXMediaIndexValidatorsKey = @"validators"; // URL key -> ETag or Last-Modified of the partial file
+static NSString * const kAPXMediaPartialExtension = @"part";
+
+static BOOL APXMediaLockFile(int fd, int operation)
+{
+    while (flock(fd, operation) != 0) {
+        
+        if (errno != EINTR) return NO;
+    }
+    
+    return YES;
+}
+
+@interface APXMediaDownloadWaiter : NSObject
+
+@property (nonatomic, copy) APXMediaDownloadCompletion completion;
+@property (nonatomic) BOOL isFinished;
+
+@end
+
+@implementation APXMediaDownloadWaiter
+
+@end
+
+@interface APXMediaDownload : NSObject
+
+@property (nonatomic, strong) NSURL *URL;
+@property (nonatomic, copy) NSString *key; // SHA-256 of the URL
+@property (nonatomic, strong) NSURL *partialURL;
+@property (nonatomic) BOOL sharesPartialFile; // NO when another process was writing the shared one, the download then starts over privately
+@property (nonatomic, strong) NSURLSessionDataTask *task;
+@property (nonatomic, strong) NSFileHandle *fileHandle; // holds the flock of the partial file until the download ends
+@property (nonatomic) unsigned long long resumeOffset; // bytes already on disk when the request was sent
+@property (nonatomic) unsigned long long receivedBytes; // including resumeOffset once the server agreed to resume
+@property (nonatomic, strong) NSError *error; // set when the download was failed before the task completed
+@property (nonatomic, strong) NSMutableArray *waiters; // of Type APXMediaDownloadWaiter
+
+@end
+
+@implementation APXMediaDownload
+
+@end
+
+@interface APXMediaDownloader () <NSURLSessionDataDelegate>
+
+@property (nonatomic, strong, readwrite) NSURL *cacheDirectoryURL;
+@property (nonatomic, strong) NSURL *linkDirectoryURL;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) NSURLSession *session;
+@property (nonatomic, strong) NSMutableDictionary *downloads; // URL key -> APXMediaDownload, in flight
+@property (nonatomic, strong) NSMutableDictionary *downloadsByTask; // task identifier -> APXMediaDownload
+@property (nonatomic, strong) NSMutableDictionary *files; // URL key -> cached file name
+@property (nonatomic, strong) NSMutableDictionary *validators; // URL key -> ETag or Last-Modified
+
+@end
+
+@implementation APXMediaDownloader
+
+#pragma mark - Initialization
+
++ (instancetype)sharedDownloader
+{
+    static APXMediaDownloader *sharedDownloader = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSURL *directory = [[[APXSharedStore sharedStore].fileURL URLByDeletingLastPathComponent] URLByAppendingPathComponent:@"APXMedia" isDirectory:YES];
+        
+        sharedDownloader = [[self alloc] initWithCacheDirectoryURL:directory configuration:[NSURLSessionConfiguration defaultSessionConfiguration]];
+    });
+    
+    return sharedDownloader;
+}
+
+- (instancetype)initWithCacheDirectoryURL:(NSURL *)cacheDirectoryURL configuration:(NSURLSessionConfiguration *)configuration
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _cacheDirectoryURL = cacheDirectoryURL;
+        _linkDirectoryURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:@"APXMedia"] isDirectory:YES];
+        _maximumBytesPerFile = kAPXMediaDefaultMaximumBytesPerFile;
+        _maximumCacheBytes = kAPXMediaDefaultMaximumCacheBytes;
+        _mediaKey = @"media";
+        _queue = dispatch_queue_create("com.appoxee.demo.media-downloader", DISPATCH_QUEUE_SERIAL);
+        _downloads = [[NSMutableDictionary alloc] init];
+        _downloadsByTask = [[NSMutableDictionary alloc] init];
+        
+        [[NSFileManager defaultManager] createDirectoryAtURL:_cacheDirectoryURL withIntermediateDirectories:YES attributes:nil error:nil];
+        [[NSFileManager defaultManager] createDirectoryAtURL:_linkDirectoryURL withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        [self loadIndex];
+        
+        // The cache is the only copy we need, don't let URLCache keep another one in memory.
+        NSURLSessionConfiguration *sessionConfiguration = [configuration copy];
+        sessionConfiguration.URLCache = nil;
+        sessionConfiguration.requestCachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
+        
+        NSOperationQueue *delegateQueue = [[NSOperationQueue alloc] init];
+        delegateQueue.maxConcurrentOperationCount = 1;
+        delegateQueue.underlyingQueue = _queue;
+        
+        _session = [NSURLSession sessionWithConfiguration:sessionConfiguration delegate:self delegateQueue:delegateQueue];
+    }
+    
+    return self;
+}
+
+#pragma mark - Notifications
+
+- (NSArray *)mediaURLsForNotification:(APXPushNotification *)notification
+{
+    id media = notification.extraFields[self.mediaKey];
+    NSArray *strings = [media isKindOfClass:[NSArray class]] ? media : (media ? @[media] : @[]);
+    NSMutableArray *URLs = [[NSMutableArray alloc] initWithCapacity:[strings count]];
+    
+    for (id string in strings) {
+        
+        NSURL *URL = [string isKindOfClass:[NSString class]] ? [NSURL URLWithString:string] : nil;
+        NSString *scheme = [[URL scheme] lowercaseString];
+        
+        if ([scheme isEqualToString:@"https"] || [scheme isEqualToString:@"http"]) [URLs addObject:URL];
+    }
+    
+    return URLs;
+}
+
+- (void)downloadMediaForNotification:(APXPushNotification *)notification deadline:(NSDate *)deadline completionHandler:(APXMediaDownloadsCompletion)handler
+{
+    NSArray *URLs = [self mediaURLsForNotification:notification];
+    
+    if (![URLs count]) {
+        
+        NSError *error = [NSError errorWithDomain:APXMediaDownloaderErrorDomain code:APXMediaDownloaderErrorNoMedia userInfo:nil];
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            
+            if (handler) handler(@[], error);
+        });
+        
+        return;
+    }
+    
+    NSMutableArray *fileURLs = [[NSMutableArray alloc] initWithCapacity:[URLs count]];
+    NSMutableArray *errors = [[NSMutableArray alloc] init];
+    dispatch_group_t group = dispatch_group_create();
+    
+    for (NSUInteger i = 0; i < [URLs count]; i++) {
+        
+        [fileURLs addObject:[NSNull null]];
+        dispatch_group_enter(group);
+        
+        // Completions are delivered on the main queue, one at a time.
+        [self downloadMediaAtURL:URLs[i] deadline:deadline completionHandler:^(NSURL *fileURL, NSError *error) {
+            
+            if (fileURL) fileURLs[i] = fileURL;
+            if (error) [errors addObject:error];
+            
+            dispatch_group_leave(group);
+        }];
+    }
+    
+    dispatch_group_notify(group, dispatch_get_main_queue(), ^{
+        
+        [fileURLs removeObjectIdenticalTo:[NSNull null]];
+        
+        if (handler) handler(fileURLs, [errors firstObject]);
+    });
+}
+
+#pragma mark - Downloads
+
+- (void)downloadMediaAtURL:(NSURL *)URL deadline:(NSDate *)deadline completionHandler:(APXMediaDownloadCompletion)handler
+{
+    APXMediaDownloadWaiter *waiter = [[APXMediaDownloadWaiter alloc] init];
+    waiter.completion = handler;
+    
+    dispatch_async(self.queue, ^{
+        
+        NSString *key = [self keyForURL:URL];
+        NSURL *cachedURL = [self cachedFileURLForKey:key];
+        
+        if (!cachedURL && !self.downloads[key]) {
+            
+            // The app or an extension may have downloaded it since the index was read.
+            [self loadIndex];
+            cachedURL = [self cachedFileURLForKey:key];
+        }
+        
+        if (cachedURL) {
+            
+            [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate : [NSDate date]} ofItemAtPath:[cachedURL path] error:NULL];
+            [self finishWaiter:waiter withFileURL:cachedURL error:nil];
+            
+            return;
+        }
+        
+        APXMediaDownload *download = self.downloads[key];
+        
+        if (!download) download = [self startDownloadOfURL:URL key:key];
+        
+        [download.waiters addObject:waiter];
+        
+        // A caller out of time gets its answer, the request goes on as long as another caller waits for it.
+        NSTimeInterval timeout = MAX([deadline timeIntervalSinceNow], 0.0);
+        
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeout * NSEC_PER_SEC)), self.queue, ^{
+            
+            if (waiter.isFinished) return;
+            
+            NSError *error = [NSError errorWithDomain:APXMediaDownloaderErrorDomain code:APXMediaDownloaderErrorDeadlineExceeded userInfo:nil];
+            
+            [download.waiters removeObject:waiter];
+            [self finishWaiter:waiter withFileURL:nil error:error];
+            
+            if (![download.waiters count]) [self cancelDownload:download withError:error];
+        });
+    });
+}
+
+- (APXMediaDownload *)startDownloadOfURL:(NSURL *)URL key:(NSString *)key
+/*
+  Called on 'queue'. A partial file left by an earlier attempt is resumed only if we know the validator of the response which started it,
+  If-Range makes the server send the whole file instead should it have changed since.
+  While the app or an extension holds the lock of the URL's partial file, this download writes to a file of its own and starts from zero.
+*/
+{
+    APXMediaDownload *download = [[APXMediaDownload alloc] init];
+    download.URL = URL;
+    download.key = key;
+    download.partialURL = [[self.cacheDirectoryURL URLByAppendingPathComponent:key] URLByAppendingPathExtension:kAPXMediaPartialExtension];
+    download.fileHandle = [self lockedFileHandleForPartialURL:download.partialURL];
+    download.sharesPartialFile = (download.fileHandle != nil);
+    download.waiters = [[NSMutableArray alloc] init];
+    
+    if (!download.sharesPartialFile) {
+        
+        NSString *fileName = [NSString stringWithFormat:@"%@-%@", key, [[NSUUID UUID] UUIDString]];
+        
+        download.partialURL = [[self.cacheDirectoryURL URLByAppendingPathComponent:fileName] URLByAppendingPathExtension:kAPXMediaPartialExtension];
+        download.fileHandle = [self lockedFileHandleForPartialURL:download.partialURL];
+    }
+    
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:URL];
+    unsigned long long partialSize = [download.fileHandle seekToEndOfFile];
+    
+    if (partialSize > 0 && download.sharesPartialFile && self.validators[key]) {
+        
+        download.resumeOffset = partialSize;
+        [request setValue:[NSString stringWithFormat:@"bytes=%llu-", partialSize] forHTTPHeaderField:@"Range"];
+        [request setValue:self.validators[key] forHTTPHeaderField:@"If-Range"];
+    }
+    
+    download.task = [self.session dataTaskWithRequest:request];
+    
+    self.downloads[key] = download;
+    self.downloadsByTask[@(download.task.taskIdentifier)] = download;
+    
+    [download.task resume];
+    
+    return download;
+}
+
+- (NSFileHandle *)lockedFileHandleForPartialURL:(NSURL *)partialURL
+/*
+  Called on 'queue'. Returns nil if another download holds the lock. A file removed by trimCache between the open and the lock
+  is no longer the one at the path, it's not used either.
+*/
+{
+    int fd = open([partialURL fileSystemRepresentation], O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    
+    if (fd < 0) return nil;
+    
+    struct stat openedStat;
+    struct stat pathStat;
+    
+    if (!APXMediaLockFile(fd, LOCK_EX | LOCK_NB) || fstat(fd, &openedStat) != 0 ||
+        stat([partialURL fileSystemRepresentation], &pathStat) != 0 || openedStat.st_ino != pathStat.st_ino) {
+        
+        close(fd);
+        
+        return nil;
+    }
+    
+    return [[NSFileHandle alloc] initWithFileDescriptor:fd closeOnDealloc:YES];
+}
+
+#pragma mark - NSURLSessionDataDelegate
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveResponse:(NSURLResponse *)response completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler
+{
+    APXMediaDownload *download = self.downloadsByTask[@(dataTask.taskIdentifier)];
+    NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ? [(NSHTTPURLResponse *)response statusCode] : 0;
+    NSDictionary *headers = [response isKindOfClass:[NSHTTPURLResponse class]] ? [(NSHTTPURLResponse *)response allHeaderFields] : @{};
+    NSString *expectedRange = [NSString stringWithFormat:@"bytes %llu-", download.resumeOffset];
+    
+    if (statusCode == 206 && download.resumeOffset > 0 && [headers[@"Content-Range"] hasPrefix:expectedRange]) {
+        
+        download.receivedBytes = download.resumeOffset;
+        
+    } else if (statusCode == 200) {
+        
+        // A fresh start, either nothing was on disk or the file changed since.
+        [download.fileHandle truncateFileAtOffset:0];
+        download.receivedBytes = 0;
+        
+        if (download.sharesPartialFile) {
+            
+            [self updateIndex:^BOOL {
+                
+                self.validators[download.key] = headers[@"ETag"] ?: headers[@"Last-Modified"];
+                
+                return YES;
+            }];
+        }
+        
+    } else {
+        
+        [self failDownload:download withError:[NSError errorWithDomain:APXMediaDownloaderErrorDomain code:APXMediaDownloaderErrorHTTPStatus userInfo:@{@"status" : @(statusCode)}] removingPartialFile:(statusCode == 206 || statusCode == 416)];
+        completionHandler(NSURLSessionResponseCancel);
+        
+        return;
+    }
+    
+    if (response.expectedContentLength != NSURLResponseUnknownLength && download.receivedBytes + response.expectedContentLength > self.maximumBytesPerFile) {
+        
+        [self failDownload:download withError:[self tooLargeError] removingPartialFile:YES];
+        completionHandler(NSURLSessionResponseCancel);
+        
+        return;
+    }
+    
+    completionHandler(NSURLSessionResponseAllow);
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data
+/*
+  Servers don't always send a Content-Length, the cap is enforced on the bytes received as well.
+*/
+{
+    APXMediaDownload *download = self.downloadsByTask[@(dataTask.taskIdentifier)];
+    
+    if (download.error) return;
+    
+    download.receivedBytes += [data length];
+    
+    if (download.receivedBytes > self.maximumBytesPerFile) {
+        
+        [self failDownload:download withError:[self tooLargeError] removingPartialFile:YES];
+        [dataTask cancel];
+        
+        return;
+    }
+    
+    [download.fileHandle writeData:data];
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error
+{
+    APXMediaDownload *download = self.downloadsByTask[@(task.taskIdentifier)];
+    
+    [self.downloadsByTask removeObjectForKey:@(task.taskIdentifier)];
+    
+    if (!download || download.error) return;
+    
+    [self.downloads removeObjectForKey:download.key];
+    
+    if (error) {
+        
+        // The partial file stays, the next attempt resumes it.
+        APXLogWarning(APXLogSubsystemNetwork, @"Media download of %@ stopped after %llu bytes: %@", download.URL, download.receivedBytes, error);
+        [download.fileHandle closeFile];
+        download.fileHandle = nil;
+        [self finishWaitersOfDownload:download withFileURL:nil error:error];
+        
+        return;
+    }
+    
+    // The lock is kept until the file was moved, nobody resumes it meanwhile.
+    NSURL *fileURL = [self storePartialFileOfDownload:download];
+    
+    [download.fileHandle closeFile];
+    download.fileHandle = nil;
+    
+    [self finishWaitersOfDownload:download withFileURL:fileURL error:nil];
+    [self trimCache];
+}
+
+#pragma mark - Completion
+
+- (void)cancelDownload:(APXMediaDownload *)download withError:(NSError *)error
+/*
+  The partial file stays for the next attempt, which may start before the cancelled task reports back.
+*/
+{
+    download.error = error;
+    
+    [download.fileHandle closeFile];
+    download.fileHandle = nil;
+    
+    [self.downloads removeObjectForKey:download.key];
+    [download.task cancel];
+}
+
+- (void)failDownload:(APXMediaDownload *)download withError:(NSError *)error removingPartialFile:(BOOL)removePartialFile
+{
+    download.error = error;
+    
+    if (removePartialFile) {
+        
+        [[NSFileManager defaultManager] removeItemAtURL:download.partialURL error:NULL];
+        
+        if (download.sharesPartialFile) {
+            
+            [self updateIndex:^BOOL {
+                
+                [self.validators removeObjectForKey:download.key];
+                
+                return YES;
+            }];
+        }
+    }
+    
+    [download.fileHandle closeFile];
+    download.fileHandle = nil;
+    
+    [self.downloads removeObjectForKey:download.key];
+    [self finishWaitersOfDownload:download withFileURL:nil error:error];
+}
+
+- (void)finishWaitersOfDownload:(APXMediaDownload *)download withFileURL:(NSURL *)fileURL error:(NSError *)error
+{
+    for (APXMediaDownloadWaiter *waiter in download.waiters) {
+        
+        [self finishWaiter:waiter withFileURL:fileURL error:error];
+    }
+    
+    [download.waiters removeAllObjects];
+}
+
+- (void)finishWaiter:(APXMediaDownloadWaiter *)waiter withFileURL:(NSURL *)fileURL error:(NSError *)error
+/*
+  Called on 'queue'. Every waiter gets its own link, an attachment moving one away leaves the cache and the other waiters alone.
+*/
+{
+    if (waiter.isFinished) return;
+    
+    waiter.isFinished = YES;
+    
+    NSURL *linkURL = nil;
+    NSError *linkError = error;
+    
+    if (fileURL) {
+        
+        linkURL = [[self.linkDirectoryURL URLByAppendingPathComponent:[[NSUUID UUID] UUIDString]] URLByAppendingPathExtension:[fileURL pathExtension]];
+        
+        if (![[NSFileManager defaultManager] linkItemAtURL:fileURL toURL:linkURL error:NULL] &&
+            ![[NSFileManager defaultManager] copyItemAtURL:fileURL toURL:linkURL error:&linkError]) {
+                
+            linkURL = nil;
+        }
+    }
+    
+    APXMediaDownloadCompletion completion = waiter.completion;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        if (completion) completion(linkURL, linkError);
+    });
+}
+
+- (NSError *)tooLargeError
+{
+    return [NSError errorWithDomain:APXMediaDownloaderErrorDomain code:APXMediaDownloaderErrorTooLarge userInfo:@{@"limit" : @(self.maximumBytesPerFile)}];
+}
+
+#pragma mark - Cache
+
+- (NSString *)keyForURL:(NSURL *)URL
+{
+    NSData *data = [[URL absoluteString] dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+    
+    return [self hexStringForDigest:digest];
+}
+
+- (NSString *)hexStringForDigest:(const unsigned char *)digest
+{
+    NSMutableString *hexString = [[NSMutableString alloc] initWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    
+    for (NSUInteger i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        
+        [hexString appendFormat:@"%02x", digest[i]];
+    }
+    
+    return hexString;
+}
+
+- (NSURL *)cachedFileURLForKey:(NSString *)key
+{
+    NSString *fileName = self.files[key];
+    NSURL *fileURL = fileName ? [self.cacheDirectoryURL URLByAppendingPathComponent:fileName] : nil;
+    
+    if (fileURL && ![[NSFileManager defaultManager] fileExistsAtPath:[fileURL path]]) {
+        
+        [self.files removeObjectForKey:key];
+        fileURL = nil;
+    }
+    
+    return fileURL;
+}
+
+- (NSURL *)storePartialFileOfDownload:(APXMediaDownload *)download
+/*
+  Called on 'queue'. The file is hashed in chunks, memory use doesn't grow with its size.
+  If another URL already brought the same content, the new copy is dropped and both URLs point at one file.
+*/
+{
+    NSFileHandle *fileHandle = [NSFileHandle fileHandleForReadingFromURL:download.partialURL error:NULL];
+    
+    if (!fileHandle) return nil;
+    
+    CC_SHA256_CTX context;
+    CC_SHA256_Init(&context);
+    
+    while (YES) {
+        
+        @autoreleasepool {
+            
+            NSData *chunk = [fileHandle readDataOfLength:kAPXMediaHashChunkSize];
+            
+            if (![chunk length]) break;
+            
+            CC_SHA256_Update(&context, chunk.bytes, (CC_LONG)chunk.length);
+        }
+    }
+    
+    [fileHandle closeFile];
+    
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256_Final(digest, &context);
+    
+    NSString *extension = [[download.URL pathExtension] lowercaseString];
+    NSString *fileName = [self hexStringForDigest:digest];
+    
+    if ([extension length]) fileName = [fileName stringByAppendingPathExtension:extension];
+    
+    NSURL *fileURL = [self.cacheDirectoryURL URLByAppendingPathComponent:fileName];
+    
+    if ([[NSFileManager defaultManager] fileExistsAtPath:[fileURL path]]) {
+        
+        [[NSFileManager defaultManager] removeItemAtURL:download.partialURL error:NULL];
+        
+    } else if (![[NSFileManager defaultManager] moveItemAtURL:download.partialURL toURL:fileURL error:NULL]) {
+        
+        return nil;
+    }
+    
+    [self updateIndex:^BOOL {
+        
+        self.files[download.key] = fileName;
+        
+        if (download.sharesPartialFile) [self.validators removeObjectForKey:download.key];
+        
+        return YES;
+    }];
+    
+    return fileURL;
+}
+
+- (void)trimCache
+/*
+  Called on 'queue'. Least recently used first, a cache hit touches the file's modification date.
+*/
+{
+    [self removeStalePartialFiles];
+    [self removeStaleLinks];
+    
+    [self updateIndex:^BOOL {
+        
+        NSArray *keys = @[NSURLFileSizeKey, NSURLContentModificationDateKey];
+        NSArray *contents = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:self.cacheDirectoryURL includingPropertiesForKeys:keys options:NSDirectoryEnumerationSkipsHiddenFiles error:NULL];
+        NSSet *cachedFileNames = [NSSet setWithArray:[self.files allValues]];
+        NSMutableArray *files = [[NSMutableArray alloc] init];
+        unsigned long long totalBytes = 0;
+        
+        for (NSURL *fileURL in contents) {
+            
+            if (![cachedFileNames containsObject:[fileURL lastPathComponent]]) continue;
+            
+            NSDictionary *values = [fileURL resourceValuesForKeys:keys error:NULL];
+            totalBytes += [values[NSURLFileSizeKey] unsignedLongLongValue];
+            [files addObject:@{@"url" : fileURL, @"size" : values[NSURLFileSizeKey] ?: @0, @"date" : values[NSURLContentModificationDateKey] ?: [NSDate distantPast]}];
+        }
+        
+        if (totalBytes <= self.maximumCacheBytes) return NO;
+        
+        [files sortUsingDescriptors:@[[NSSortDescriptor sortDescriptorWithKey:@"date" ascending:YES]]];
+        
+        for (NSDictionary *file in files) {
+            
+            if (totalBytes <= self.maximumCacheBytes) break;
+            
+            NSString *fileName = [file[@"url"] lastPathComponent];
+            
+            [[NSFileManager defaultManager] removeItemAtURL:file[@"url"] error:NULL];
+            [self.files removeObjectsForKeys:[self.files allKeysForObject:fileName]];
+            totalBytes -= [file[@"size"] unsignedLongLongValue];
+        }
+        
+        return YES;
+    }];
+}
+
+- (void)removeStalePartialFiles
+/*
+  Called on 'queue'. A partial file nobody holds the lock of is removed when it can't be resumed, i.e. it was written under a private
+  name or its validator is gone, or when it wasn't written to for kAPXMediaPartialMaximumAge.
+*/
+{
+    NSArray *keys = @[NSURLContentModificationDateKey];
+    NSArray *contents = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:self.cacheDirectoryURL includingPropertiesForKeys:keys options:NSDirectoryEnumerationSkipsHiddenFiles error:NULL];
+    NSDate *oldestDate = [NSDate dateWithTimeIntervalSinceNow:-kAPXMediaPartialMaximumAge];
+    
+    for (NSURL *fileURL in contents) {
+        
+        if (![[fileURL pathExtension] isEqualToString:kAPXMediaPartialExtension]) continue;
+        
+        NSString *key = [[fileURL URLByDeletingPathExtension] lastPathComponent];
+        NSDate *date = [fileURL resourceValuesForKeys:keys error:NULL][NSURLContentModificationDateKey];
+        
+        if (self.validators[key] && [date compare:oldestDate] == NSOrderedDescending) continue;
+        
+        int fd = open([fileURL fileSystemRepresentation], O_RDWR | O_CLOEXEC);
+        
+        if (fd < 0) continue;
+        
+        if (APXMediaLockFile(fd, LOCK_EX | LOCK_NB)) {
+            
+            unlink([fileURL fileSystemRepresentation]);
+        }
+        
+        close(fd);
+    }
+}
+
+- (void)removeStaleLinks
+/*
+  Called on 'queue'. A hard link shares the dates of the cached file, its attribute modification date (ctime) is the one which
+  changes when the link is made.
+*/
+{
+    NSArray *keys = @[NSURLAttributeModificationDateKey];
+    NSArray *contents = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:self.linkDirectoryURL includingPropertiesForKeys:keys options:NSDirectoryEnumerationSkipsHiddenFiles error:NULL];
+    NSDate *oldestDate = [NSDate dateWithTimeIntervalSinceNow:-kAPXMediaLinkMaximumAge];
+    
+    for (NSURL *linkURL in contents) {
+        
+        NSDate *date = [linkURL resourceValuesForKeys:keys error:NULL][NSURLAttributeModificationDateKey];
+        
+        if ([date compare:oldestDate] == NSOrderedAscending) [[NSFileManager defaultManager] removeItemAtURL:linkURL error:NULL];
+    }
+}
+
+- (void)removeAllCachedMedia
+{
+    dispatch_async(self.queue, ^{
+        
+        [self updateIndex:^BOOL {
+            
+            for (NSString *fileName in [NSSet setWithArray:[self.files allValues]]) {
+                
+                [[NSFileManager defaultManager] removeItemAtURL:[self.cacheDirectoryURL URLByAppendingPathComponent:fileName] error:NULL];
+            }
+            
+            [self.files removeAllObjects];
+            
+            return YES;
+        }];
+    });
+}
+
+#pragma mark - Index
+
+- (void)loadIndex
+{
+    NSDictionary *index = [NSDictionary dictionaryWithContentsOfURL:[self.cacheDirectoryURL URLByAppendingPathComponent:kAPXMediaIndexFileName]];
+    
+    self.files = [index[kAPXMediaIndexFilesKey] mutableCopy] ?: [[NSMutableDictionary alloc] init];
+    self.validators = [index[kAPXMediaIndexValidatorsKey] mutableCopy] ?: [[NSMutableDictionary alloc] init];
+}
+
+- (void)updateIndex:(BOOL (^)(void))block
+/*
+  Called on 'queue'. The app and an extension both write the index, it's read again under the lock so neither drops the other's entries.
+  The block changes 'files' and 'validators' and returns whether to write them.
+*/
+{
+    int fd = open([[self.cacheDirectoryURL URLByAppendingPathComponent:kAPXMediaIndexLockFileName] fileSystemRepresentation], O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    
+    if (fd < 0 || !APXMediaLockFile(fd, LOCK_EX)) {
+        
+        APXLogWarning(APXLogSubsystemNetwork, @"Media index updated without its lock: %s", strerror(errno));
+    }
+    
+    [self loadIndex];
+    
+    if (block()) {
+        
+        NSDictionary *index = @{kAPXMediaIndexFilesKey : self.files, kAPXMediaIndexValidatorsKey : self.validators};
+        
+        [index writeToURL:[self.cacheDirectoryURL URLByAppendingPathComponent:kAPXMediaIndexFileName] atomically:YES];
+    }
+    
+    // Closing the descriptor releases the lock.
+    if (fd >= 0) close(fd);
+}
+
+@end
@@ -0,0 +1,92 @@
+//
+//  APXMetrics.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+// Snapshot keys.
+extern NSString * const APXMetricsCountersKey; // NSDictionary, name -> NSNumber
+extern NSString * const APXMetricsHistogramsKey; // NSDictionary, name -> NSDictionary of the keys below
+extern NSString * const APXMetricsCountKey;
+extern NSString * const APXMetricsMinKey;
+extern NSString * const APXMetricsMaxKey;
+extern NSString * const APXMetricsMeanKey;
+extern NSString * const APXMetricsP50Key;
+extern NSString * const APXMetricsP90Key;
+extern NSString * const APXMetricsP99Key;
+extern NSString * const APXMetricsP999Key;
+
+// Monotonic time in nanoseconds, for measuring durations.
+uint64_t APXMetricsNow(void);
+
+@interface APXCounter : NSObject
+
+@property (nonatomic, copy, readonly) NSString *name;
+@property (nonatomic, readonly) int64_t value;
+
+- (void)increment;
+- (void)add:(int64_t)delta;
+
+@end
+
+// An HDR style histogram. Values are bucketed by power of two, and each power of two is split into 16 linear sub buckets,
+// so percentiles are within about 6% of the recorded value at any magnitude. Recording is two atomic adds.
+@interface APXHistogram : NSObject
+
+@property (nonatomic, copy, readonly) NSString *name;
+
+- (void)recordValue:(uint64_t)value;
+
+// Records the time since start, a value of APXMetricsNow(), in microseconds.
+- (void)recordDurationSince:(uint64_t)start;
+
+- (NSDictionary *)snapshot;
+
+@end
+
+// Counters and histograms of what the app's Appoxee integration costs, to be read by an APM agent.
+// Look metrics up once and keep the returned object, i.e. in a static, the recording path never takes a lock.
+@interface APXMetrics : NSObject
+
++ (instancetype)sharedMetrics;
+
+- (APXCounter *)counterNamed:(NSString *)name;
+- (APXHistogram *)histogramNamed:(NSString *)name;
+
+- (NSDictionary *)snapshot;
+
+// Zeroes every metric. Values recorded while resetting may land on either side.
+- (void)reset;
+
+@end
+
+@interface Appoxee (APXMetrics)
+
+// The snapshot of [APXMetrics sharedMetrics]. Prefixed, so they can never clash with methods a later SDK version adds to Appoxee.
+- (NSDictionary *)apx_metricsSnapshot;
+- (void)apx_resetMetrics;
+
+@end
+
+// Metric names used by the Services.
+extern NSString * const APXMetricInboxRefreshes; // counter
+extern NSString * const APXMetricInboxRefreshLatency; // histogram, microseconds
+extern NSString * const APXMetricInboxCacheReads; // counter
+extern NSString * const APXMetricInboxMessagesExpired; // counter
+extern NSString * const APXMetricPushParseTime; // histogram, microseconds
+extern NSString * const APXMetricPushDelegateTime; // histogram, microseconds
+extern NSString * const APXMetricPushDuplicates; // counter
+extern NSString * const APXMetricPushEventQueueDepth; // histogram, events
+extern NSString * const APXMetricPushEventRetries; // counter
+extern NSString * const APXMetricDeviceRegistrations; // counter
+extern NSString * const APXMetricDeviceRegistrationsSkipped; // counter
+extern NSString * const APXMetricRateLimitDeferredCalls; // counter
+extern NSString * const APXMetricRateLimitMergedCalls; // counter
+extern NSString * const APXMetricTransfersPiggybacked; // counter, transfers sent while the radio was awake anyway
+extern NSString * const APXMetricTransfersDeadlineWakeups; // counter
+extern NSString * const APXMetricContentPrefetchesResumed; // counter, downloads continued from resume data
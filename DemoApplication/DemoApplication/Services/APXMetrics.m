@@ -0,0 +1,324 @@
+//
+//  APXMetrics.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXMetrics.h"
+#import <mach/mach_time.h>
+#import <stdatomic.h>
+
+NSString * const APXMetricsCountersKey = @"counters";
+NSString * const APXMetricsHistogramsKey = @"histograms";
+NSString * const APXMetricsCountKey = @"count";
+NSString * const APXMetricsMinKey = @"min";
+NSString * const APXMetricsMaxKey = @"max";
+NSString * const APXMetricsMeanKey = @"mean";
+NSString * const APXMetricsP50Key = @"p50";
+NSString * const APXMetricsP90Key = @"p90";
+NSString * const APXMetricsP99Key = @"p99";
+NSString * const APXMetricsP999Key = @"p999";
+
+NSString * const APXMetricInboxRefreshes = @"inbox.refreshes";
+NSString * const APXMetricInboxRefreshLatency = @"inbox.refresh_latency_us";
+NSString * const APXMetricInboxCacheReads = @"inbox.cache_reads";
+NSString * const APXMetricInboxMessagesExpired = @"inbox.messages_expired";
+NSString * const APXMetricPushParseTime = @"push.parse_time_us";
+NSString * const APXMetricPushDelegateTime = @"push.delegate_time_us";
+NSString * const APXMetricPushDuplicates = @"push.duplicates";
+NSString * const APXMetricPushEventQueueDepth = @"push_events.queue_depth";
+NSString * const APXMetricPushEventRetries = @"push_events.retries";
+NSString * const APXMetricDeviceRegistrations = @"device.registrations";
+NSString * const APXMetricDeviceRegistrationsSkipped = @"device.registrations_skipped";
+NSString * const APXMetricRateLimitDeferredCalls = @"rate_limit.deferred_calls";
+NSString * const APXMetricRateLimitMergedCalls = @"rate_limit.merged_calls";
+NSString * const APXMetricTransfersPiggybacked = @"transfers.piggybacked";
+NSString * const APXMetricTransfersDeadlineWakeups = @"transfers.deadline_wakeups";
+NSString * const APXMetricContentPrefetchesResumed = @"content.prefetches_resumed";
+
+#define kAPXHistogramSubBucketBits 4
+#define kAPXHistogramSubBuckets (1 << kAPXHistogramSubBucketBits)
+#define kAPXHistogramBucketCount ((64 - kAPXHistogramSubBucketBits + 1) * kAPXHistogramSubBuckets)
+
+uint64_t APXMetricsNow(void)
+{
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+    
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+}
+
+#pragma mark - Counter
+
+@implementation APXCounter {
+    _Atomic(int64_t) _value;
+}
+
+- (instancetype)initWithName:(NSString *)name
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _name = [name copy];
+        atomic_init(&_value, 0);
+    }
+    
+    return self;
+}
+
+- (int64_t)value
+{
+    return atomic_load_explicit(&_value, memory_order_relaxed);
+}
+
+- (void)increment
+{
+    atomic_fetch_add_explicit(&_value, 1, memory_order_relaxed);
+}
+
+- (void)add:(int64_t)delta
+{
+    atomic_fetch_add_explicit(&_value, delta, memory_order_relaxed);
+}
+
+- (void)reset
+{
+    atomic_store_explicit(&_value, 0, memory_order_relaxed);
+}
+
+@end
+
+#pragma mark - Histogram
+
+static inline NSUInteger APXHistogramBucketIndex(uint64_t value)
+/*
+  Values below kAPXHistogramSubBuckets get a bucket each, above that the magnitude picks the group and the
+  next kAPXHistogramSubBucketBits bits below the highest set bit pick the sub bucket.
+*/
+{
+    if (value < kAPXHistogramSubBuckets) return (NSUInteger)value;
+    
+    unsigned magnitude = 63 - __builtin_clzll(value);
+    unsigned shift = magnitude - kAPXHistogramSubBucketBits;
+    
+    return (shift + 1) * kAPXHistogramSubBuckets + (NSUInteger)((value >> shift) & (kAPXHistogramSubBuckets - 1));
+}
+
+static inline uint64_t APXHistogramBucketValue(NSUInteger index)
+/*
+  The highest value falling into a bucket, so percentiles never under report.
+*/
+{
+    if (index < kAPXHistogramSubBuckets) return index;
+    
+    unsigned shift = (unsigned)(index / kAPXHistogramSubBuckets) - 1;
+    uint64_t lowest = ((uint64_t)kAPXHistogramSubBuckets + index % kAPXHistogramSubBuckets) << shift;
+    
+    return lowest + ((1ULL << shift) - 1);
+}
+
+@implementation APXHistogram {
+    _Atomic(uint64_t) _buckets[kAPXHistogramBucketCount];
+    _Atomic(uint64_t) _sum;
+}
+
+- (instancetype)initWithName:(NSString *)name
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _name = [name copy];
+        [self reset];
+    }
+    
+    return self;
+}
+
+- (void)recordValue:(uint64_t)value
+{
+    atomic_fetch_add_explicit(&_buckets[APXHistogramBucketIndex(value)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&_sum, value, memory_order_relaxed);
+}
+
+- (void)recordDurationSince:(uint64_t)start
+{
+    [self recordValue:(APXMetricsNow() - start) / 1000];
+}
+
+- (void)reset
+{
+    for (NSUInteger i = 0; i < kAPXHistogramBucketCount; i++) {
+        
+        atomic_store_explicit(&_buckets[i], 0, memory_order_relaxed);
+    }
+    
+    atomic_store_explicit(&_sum, 0, memory_order_relaxed);
+}
+
+- (NSDictionary *)snapshot
+{
+    uint64_t counts[kAPXHistogramBucketCount];
+    uint64_t total = 0;
+    
+    for (NSUInteger i = 0; i < kAPXHistogramBucketCount; i++) {
+        
+        counts[i] = atomic_load_explicit(&_buckets[i], memory_order_relaxed);
+        total += counts[i];
+    }
+    
+    if (!total) return @{APXMetricsCountKey : @0};
+    
+    double percentiles[] = {0.5, 0.9, 0.99, 0.999};
+    NSArray *percentileKeys = @[APXMetricsP50Key, APXMetricsP90Key, APXMetricsP99Key, APXMetricsP999Key];
+    NSMutableDictionary *snapshot = [[NSMutableDictionary alloc] init];
+    uint64_t seen = 0;
+    NSUInteger next = 0;
+    
+    snapshot[APXMetricsCountKey] = @(total);
+    snapshot[APXMetricsMeanKey] = @((double)atomic_load_explicit(&_sum, memory_order_relaxed) / total);
+    
+    for (NSUInteger i = 0; i < kAPXHistogramBucketCount; i++) {
+        
+        if (!counts[i]) continue;
+        
+        if (!snapshot[APXMetricsMinKey]) snapshot[APXMetricsMinKey] = @(APXHistogramBucketValue(i));
+        
+        snapshot[APXMetricsMaxKey] = @(APXHistogramBucketValue(i));
+        seen += counts[i];
+        
+        while (next < [percentileKeys count] && seen >= (uint64_t)ceil(percentiles[next] * total)) {
+            
+            snapshot[percentileKeys[next++]] = @(APXHistogramBucketValue(i));
+        }
+    }
+    
+    return snapshot;
+}
+
+@end
+
+#pragma mark - Registry
+
+@interface APXMetrics ()
+
+@property (nonatomic, strong) NSMutableDictionary *counters;
+@property (nonatomic, strong) NSMutableDictionary *histograms;
+
+@end
+
+@implementation APXMetrics
+
++ (instancetype)sharedMetrics
+{
+    static APXMetrics *sharedMetrics = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedMetrics = [[self alloc] init];
+    });
+    
+    return sharedMetrics;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _counters = [[NSMutableDictionary alloc] init];
+        _histograms = [[NSMutableDictionary alloc] init];
+    }
+    
+    return self;
+}
+
+- (APXCounter *)counterNamed:(NSString *)name
+{
+    @synchronized (self) {
+        
+        APXCounter *counter = self.counters[name];
+        
+        if (!counter) {
+            
+            counter = [[APXCounter alloc] initWithName:name];
+            self.counters[name] = counter;
+        }
+        
+        return counter;
+    }
+}
+
+- (APXHistogram *)histogramNamed:(NSString *)name
+{
+    @synchronized (self) {
+        
+        APXHistogram *histogram = self.histograms[name];
+        
+        if (!histogram) {
+            
+            histogram = [[APXHistogram alloc] initWithName:name];
+            self.histograms[name] = histogram;
+        }
+        
+        return histogram;
+    }
+}
+
+- (NSDictionary *)snapshot
+{
+    NSArray *counters = nil;
+    NSArray *histograms = nil;
+    
+    @synchronized (self) {
+        
+        counters = [self.counters allValues];
+        histograms = [self.histograms allValues];
+    }
+    
+    NSMutableDictionary *counterValues = [[NSMutableDictionary alloc] initWithCapacity:[counters count]];
+    NSMutableDictionary *histogramValues = [[NSMutableDictionary alloc] initWithCapacity:[histograms count]];
+    
+    for (APXCounter *counter in counters) {
+        
+        counterValues[counter.name] = @(counter.value);
+    }
+    
+    for (APXHistogram *histogram in histograms) {
+        
+        histogramValues[histogram.name] = [histogram snapshot];
+    }
+    
+    return @{APXMetricsCountersKey : counterValues, APXMetricsHistogramsKey : histogramValues};
+}
+
+- (void)reset
+{
+    @synchronized (self) {
+        
+        [[self.counters allValues] makeObjectsPerformSelector:@selector(reset)];
+        [[self.histograms allValues] makeObjectsPerformSelector:@selector(reset)];
+    }
+}
+
+@end
+
+@implementation Appoxee (APXMetrics)
+
+- (NSDictionary *)apx_metricsSnapshot
+{
+    return [[APXMetrics sharedMetrics] snapshot];
+}
+
+- (void)apx_resetMetrics
+{
+    [[APXMetrics sharedMetrics] reset];
+}
+
+@end
@@ -0,0 +1,49 @@
+//
+//  APXPushActionExecutor.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXAppoxeeClient.h"
+#import "APXCustomFieldsStore.h"
+
+// Runs the background actions of a push action button within the few seconds iOS grants handleActionWithIdentifier:, for buttons
+// Appoxee's handleActionWithIdentifier:forRemoteNotification:completionHandler: doesn't handle. Appoxee runs a button it handles as a whole,
+// background actions included, they mustn't be executed a second time.
+// The actions are compiled into one operation: a single tags call with the net change, and one custom fields batch in which the set and
+// the increments of a field are folded together. The operation is journaled before anything is sent, and the custom fields store applies it
+// locally right away. Whatever wasn't confirmed by the deadline stays in the journal and is sent again by resumePendingOperations, so
+// delivery is at least once: an increment whose request was in flight when the app was terminated may be applied twice.
+@interface APXPushActionExecutor : NSObject
+
+@property (nonatomic, strong, readonly) id<APXAppoxeeClient> client;
+@property (nonatomic, strong, readonly) APXCustomFieldsStore *customFieldsStore;
+@property (nonatomic) NSTimeInterval deadline; // default is 3 seconds, completion handlers are called no later
+@property (nonatomic, readonly) NSUInteger pendingOperationCount;
+
+// Tags through [APXRateLimitedClient sharedClient], fields through [APXCustomFieldsStore sharedStore], journaled in Application Support.
++ (instancetype)sharedExecutor;
+
+// fileURL may be nil for an in-memory journal.
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client customFieldsStore:(APXCustomFieldsStore *)customFieldsStore fileURL:(NSURL *)fileURL;
+
+// The button of the notification's push action whose foreground action is named identifier, nil if there is none.
++ (APXPushNotificationActionButton *)actionButtonWithIdentifier:(NSString *)identifier ofNotification:(APXPushNotification *)notification;
+
+// Executes the Set, Remove and Increment actions of tags and custom fields, of Type APXPushNotificationActionButtonAction. A Set value
+// is sent as text, unless the field is incremented by the same actions, an Increment value must be a number. Returns NO,
+// without calling completionHandler, when there are none. Otherwise completionHandler is called on the main queue once every part was
+// confirmed, or once deadline has passed.
+- (BOOL)executeActions:(NSArray *)actions completionHandler:(void (^)(void))completionHandler;
+
+// Appoxee executed the actions itself, the custom fields they change are read from Appoxee again.
+- (void)invalidateFieldsOfActions:(NSArray *)actions;
+
+// Sends the journaled operations which aren't in flight again, i.e. on launch or during a background fetch.
+- (void)resumePendingOperations;
+
+@end
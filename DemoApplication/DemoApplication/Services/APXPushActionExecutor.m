@@ -0,0 +1,387 @@
+//
+//  APXPushActionExecutor.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXPushActionExecutor.h"
+#import "APXRateLimitedClient.h"
+#import "APXLogger.h"
+
+// Keys of a journaled operation, only the parts which are left to send are present.
+static NSString * const kAPXPushActionIDKey = @"id";
+static NSString * const kAPXPushActionTagsToAddKey = @"add"; // NSArray of NSString
+static NSString * const kAPXPushActionTagsToRemoveKey = @"remove"; // NSArray of NSString
+static NSString * const kAPXPushActionFieldsKey = @"set"; // NSDictionary, key -> NSString / NSNumber
+static NSString * const kAPXPushActionIncrementsKey = @"increment"; // NSDictionary, key -> NSNumber
+
+static NSTimeInterval const kAPXPushActionDefaultDeadline = 3.0;
+
+@interface APXPushActionExecutor ()
+
+@property (nonatomic, strong, readwrite) id<APXAppoxeeClient> client;
+@property (nonatomic, strong, readwrite) APXCustomFieldsStore *customFieldsStore;
+@property (nonatomic, strong) NSURL *fileURL;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) NSMutableArray *operations; // of Type NSMutableDictionary, oldest first, only touched on 'queue'
+@property (nonatomic, strong) NSMutableSet *inFlightIDs; // only touched on 'queue'
+
+@end
+
+@implementation APXPushActionExecutor
+
+#pragma mark - Initialization
+
++ (instancetype)sharedExecutor
+{
+    static APXPushActionExecutor *sharedExecutor = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSURL *directory = [[[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask] firstObject];
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        sharedExecutor = [[self alloc] initWithClient:[APXRateLimitedClient sharedClient] customFieldsStore:[APXCustomFieldsStore sharedStore] fileURL:[directory URLByAppendingPathComponent:@"APXPushActions.plist"]];
+    });
+    
+    return sharedExecutor;
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client customFieldsStore:(APXCustomFieldsStore *)customFieldsStore fileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _client = client;
+        _customFieldsStore = customFieldsStore;
+        _fileURL = fileURL;
+        _deadline = kAPXPushActionDefaultDeadline;
+        _queue = dispatch_queue_create("com.appoxee.demo.push-actions", DISPATCH_QUEUE_SERIAL);
+        _operations = [[NSMutableArray alloc] init];
+        _inFlightIDs = [[NSMutableSet alloc] init];
+        
+        [self load];
+    }
+    
+    return self;
+}
+
++ (APXPushNotificationActionButton *)actionButtonWithIdentifier:(NSString *)identifier ofNotification:(APXPushNotification *)notification
+{
+    if (![identifier length]) return nil;
+    
+    for (APXPushNotificationActionButton *button in notification.pushAction.actionButtons) {
+        
+        if ([button.foregroundActionButtonAction.name isEqualToString:identifier]) return button;
+    }
+    
+    return nil;
+}
+
+#pragma mark - Compiling
+
+- (NSMutableDictionary *)operationForActions:(NSArray *)actions
+/*
+  Actions apply in order, so the operation holds the net result: a tag added then removed is only removed, a field which is set then
+  incremented is set to the sum, and consecutive increments of a field are one increment.
+*/
+{
+    NSMutableOrderedSet *tagsToAdd = [[NSMutableOrderedSet alloc] init];
+    NSMutableOrderedSet *tagsToRemove = [[NSMutableOrderedSet alloc] init];
+    NSMutableDictionary *fields = [[NSMutableDictionary alloc] init];
+    NSMutableDictionary *increments = [[NSMutableDictionary alloc] init];
+    
+    for (APXPushNotificationActionButtonAction *action in actions) {
+        
+        NSString *name = [action isKindOfClass:[APXPushNotificationActionButtonAction class]] ? action.name : nil;
+        
+        if (![name length]) continue;
+        
+        if (action.type == kAPXPushNotificationActionButtonActionTypeTag) {
+            
+            if (action.todo == kAPXPushNotificationActionButtonActionTodoSet) {
+                
+                [tagsToRemove removeObject:name];
+                [tagsToAdd addObject:name];
+                
+            } else if (action.todo == kAPXPushNotificationActionButtonActionTodoRemove) {
+                
+                [tagsToAdd removeObject:name];
+                [tagsToRemove addObject:name];
+            }
+            
+        } else if (action.type == kAPXPushNotificationActionButtonActionTypeCustom) {
+            
+            if (action.todo == kAPXPushNotificationActionButtonActionTodoSet && [action.value isKindOfClass:[NSString class]]) {
+                
+                fields[name] = action.value;
+                [increments removeObjectForKey:name];
+                
+            } else if (action.todo == kAPXPushNotificationActionButtonActionTodoIncrement) {
+                
+                NSNumber *value = [self numberForString:action.value];
+                
+                // Incrementing a field which was just set says it holds a number.
+                NSNumber *setValue = [fields[name] isKindOfClass:[NSString class]] ? [self numberForString:fields[name]] : fields[name];
+                
+                if (!value) {
+                    
+                    APXLogWarning(APXLogSubsystemPush, @"Ignored increment of %@ by %@", name, action.value);
+                    
+                } else if (setValue) {
+                    
+                    fields[name] = [APXCustomFieldsStore sumOfNumber:setValue andNumber:value];
+                    
+                } else if (fields[name]) {
+                    
+                    APXLogWarning(APXLogSubsystemPush, @"Ignored increment of %@, which was set to text", name);
+                    
+                } else {
+                    
+                    increments[name] = increments[name] ? [APXCustomFieldsStore sumOfNumber:increments[name] andNumber:value] : value;
+                }
+                
+            } else if (action.todo == kAPXPushNotificationActionButtonActionTodoRemove) {
+                
+                APXLogWarning(APXLogSubsystemPush, @"Ignored removal of custom field %@, the SDK can't remove fields", name);
+            }
+        }
+    }
+    
+    NSMutableDictionary *operation = [[NSMutableDictionary alloc] init];
+    
+    if ([tagsToAdd count]) operation[kAPXPushActionTagsToAddKey] = [[tagsToAdd array] mutableCopy];
+    if ([tagsToRemove count]) operation[kAPXPushActionTagsToRemoveKey] = [[tagsToRemove array] mutableCopy];
+    if ([fields count]) operation[kAPXPushActionFieldsKey] = fields;
+    if ([increments count]) operation[kAPXPushActionIncrementsKey] = increments;
+    
+    if (![operation count]) return nil;
+    
+    operation[kAPXPushActionIDKey] = [[NSUUID UUID] UUIDString];
+    
+    return operation;
+}
+
+- (NSNumber *)numberForString:(NSString *)string
+/*
+  The payload carries every value as text. Only increments say their value is a number, a Set value is sent as the text it is,
+  "01234" stays a zip code. Integers are parsed as integers, so sums of them stay integral.
+*/
+{
+    if (![string isKindOfClass:[NSString class]]) return nil;
+    
+    NSScanner *scanner = [NSScanner scannerWithString:string];
+    long long integer = 0;
+    
+    if ([scanner scanLongLong:&integer] && [scanner isAtEnd] && integer != LLONG_MAX && integer != LLONG_MIN) return @(integer);
+    
+    scanner = [NSScanner scannerWithString:string];
+    double number = 0.0;
+    
+    if ([scanner scanDouble:&number] && [scanner isAtEnd] && isfinite(number)) return @(number);
+    
+    return nil;
+}
+
+#pragma mark - Executing
+
+- (BOOL)executeActions:(NSArray *)actions completionHandler:(void (^)(void))completionHandler
+{
+    NSMutableDictionary *operation = [self operationForActions:actions];
+    
+    if (!operation) return NO;
+    
+    // Only touched on the main queue.
+    __block BOOL isFinished = NO;
+    
+    void (^finish)(void) = ^{
+        
+        if (isFinished) return;
+        
+        isFinished = YES;
+        
+        if (completionHandler) completionHandler();
+    };
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.deadline * NSEC_PER_SEC)), dispatch_get_main_queue(), finish);
+    
+    dispatch_async(self.queue, ^{
+        
+        // Journaled before anything is sent, the process may be suspended at any point after.
+        [self.operations addObject:operation];
+        [self save];
+        
+        [self sendOperation:operation completionHandler:^{
+            
+            dispatch_async(dispatch_get_main_queue(), finish);
+        }];
+    });
+    
+    return YES;
+}
+
+- (void)invalidateFieldsOfActions:(NSArray *)actions
+{
+    for (APXPushNotificationActionButtonAction *action in actions) {
+        
+        if ([action isKindOfClass:[APXPushNotificationActionButtonAction class]] && action.type == kAPXPushNotificationActionButtonActionTypeCustom) {
+            
+            [self.customFieldsStore clearCache];
+            return;
+        }
+    }
+}
+
+- (void)resumePendingOperations
+{
+    dispatch_async(self.queue, ^{
+        
+        for (NSMutableDictionary *operation in [self.operations copy]) {
+            
+            if (![self.inFlightIDs containsObject:operation[kAPXPushActionIDKey]]) [self sendOperation:operation completionHandler:nil];
+        }
+    });
+}
+
+- (NSUInteger)pendingOperationCount
+{
+    __block NSUInteger count = 0;
+    
+    dispatch_sync(self.queue, ^{
+        
+        count = [self.operations count];
+    });
+    
+    return count;
+}
+
+- (void)sendOperation:(NSMutableDictionary *)operation completionHandler:(void (^)(void))completionHandler
+/*
+  Called on 'queue'. The parts run concurrently, each one confirmed is removed from the operation, and the operation from the journal once
+  nothing is left of it.
+*/
+{
+    NSString *operationID = operation[kAPXPushActionIDKey];
+    dispatch_group_t group = dispatch_group_create();
+    
+    [self.inFlightIDs addObject:operationID];
+    
+    NSArray *tagsToAdd = [operation[kAPXPushActionTagsToAddKey] copy];
+    NSArray *tagsToRemove = [operation[kAPXPushActionTagsToRemoveKey] copy];
+    
+    if ([tagsToAdd count] || [tagsToRemove count]) {
+        
+        dispatch_group_enter(group);
+        
+        [self.client addTagsToDevice:tagsToAdd andRemove:tagsToRemove withCompletionHandler:^(NSError *appoxeeError, id data) {
+            
+            dispatch_async(self.queue, ^{
+                
+                if (!appoxeeError) [operation removeObjectsForKeys:@[kAPXPushActionTagsToAddKey, kAPXPushActionTagsToRemoveKey]];
+                
+                dispatch_group_leave(group);
+            });
+        }];
+    }
+    
+    NSDictionary *fields = [operation[kAPXPushActionFieldsKey] copy];
+    
+    if ([fields count]) {
+        
+        dispatch_group_enter(group);
+        
+        [self.customFieldsStore setCustomFields:fields completionHandler:^(NSError *appoxeeError, id data) {
+            
+            dispatch_async(self.queue, ^{
+                
+                // A partial failure carries the fields which were set, only the others are sent again.
+                NSMutableDictionary *remainingFields = operation[kAPXPushActionFieldsKey];
+                
+                if (!appoxeeError) {
+                    
+                    [operation removeObjectForKey:kAPXPushActionFieldsKey];
+                    
+                } else if ([data isKindOfClass:[NSDictionary class]]) {
+                    
+                    [remainingFields removeObjectsForKeys:[(NSDictionary *)data allKeys]];
+                    
+                    if (![remainingFields count]) [operation removeObjectForKey:kAPXPushActionFieldsKey];
+                }
+                
+                dispatch_group_leave(group);
+            });
+        }];
+    }
+    
+    NSDictionary *increments = [operation[kAPXPushActionIncrementsKey] copy];
+    
+    [increments enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *value, BOOL *stop) {
+        
+        dispatch_group_enter(group);
+        
+        [self.customFieldsStore incrementCustomFieldForKey:key byValue:value completionHandler:^(NSError *appoxeeError, id data) {
+            
+            dispatch_async(self.queue, ^{
+                
+                NSMutableDictionary *remainingIncrements = operation[kAPXPushActionIncrementsKey];
+                
+                if (!appoxeeError) [remainingIncrements removeObjectForKey:key];
+                
+                if (![remainingIncrements count]) [operation removeObjectForKey:kAPXPushActionIncrementsKey];
+                
+                dispatch_group_leave(group);
+            });
+        }];
+    }];
+    
+    dispatch_group_notify(group, self.queue, ^{
+        
+        [self.inFlightIDs removeObject:operationID];
+        
+        // Only its id is left.
+        if ([operation count] == 1) {
+            
+            [self.operations removeObjectIdenticalTo:operation];
+            
+        } else {
+            
+            APXLogWarning(APXLogSubsystemPush, @"Push action %@ was not completed, it stays journaled", operationID);
+        }
+        
+        [self save];
+        
+        if (completionHandler) completionHandler();
+    });
+}
+
+#pragma mark - Persistence
+
+- (void)load
+{
+    if (!self.fileURL) return;
+    
+    NSData *data = [NSData dataWithContentsOfURL:self.fileURL];
+    id operations = data ? [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListMutableContainers format:NULL error:NULL] : nil;
+    
+    for (id operation in [operations isKindOfClass:[NSArray class]] ? operations : @[]) {
+        
+        if ([operation isKindOfClass:[NSMutableDictionary class]] && operation[kAPXPushActionIDKey]) [self.operations addObject:operation];
+    }
+}
+
+- (void)save
+/*
+  Called on 'queue'. Synchronous, the journal is tiny and must be on disk before the requests it describes are sent.
+*/
+{
+    if (!self.fileURL) return;
+    
+    NSData *data = [NSPropertyListSerialization dataWithPropertyList:self.operations format:NSPropertyListBinaryFormat_v1_0 options:0 error:NULL];
+    
+    [data writeToURL:self.fileURL options:NSDataWritingAtomic error:NULL];
+}
+
+@end
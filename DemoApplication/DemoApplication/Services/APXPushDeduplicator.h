@@ -0,0 +1,37 @@
+//
+//  APXPushDeduplicator.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+// The same Push Notification can reach the app through launch options, receivedRemoteNotification:,
+// didReceiveRemoteNotification:fetchCompletionHandler:... and userNotificationCenter:didReceiveNotificationResponse:...
+// The deduplicator remembers the most recent Appoxee uniqueIDs in a bounded, persisted set with constant time lookup,
+// so each notification / action pair is handled once.
+@interface APXPushDeduplicator : NSObject
+
+@property (nonatomic, readonly) NSUInteger capacity;
+
++ (instancetype)sharedDeduplicator;
+
+// capacity is the number of recent deliveries remembered, the oldest is evicted first. fileURL may be nil for an in-memory set.
+- (instancetype)initWithCapacity:(NSUInteger)capacity fileURL:(NSURL *)fileURL;
+
+// Returns YES the first time a notification is seen for an action identifier, and NO for every duplicate delivery. A nil, empty
+// and default action identifier are the same plain open.
+// Notifications without an Appoxee uniqueID can't be deduplicated, and always return YES.
+- (BOOL)shouldHandleNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier;
+
+- (BOOL)containsNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier;
+
+- (void)removeAllNotifications;
+
+// The key a notification / action pair is remembered by, nil without a uniqueID. Use it to identify the delivery elsewhere.
++ (NSString *)keyForNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier;
+
+@end
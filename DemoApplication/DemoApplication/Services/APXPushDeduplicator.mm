@@ -0,0 +1,168 @@
+//
+//  APXPushDeduplicator.mm
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXPushDeduplicator.h"
+#include <memory>
+#include "apx/RecentKeys.h"
+
+static NSUInteger const kAPXPushDeduplicatorDefaultCapacity = 256;
+
+// UNNotificationDefaultActionIdentifier, without linking UserNotifications.
+static NSString * const kAPXPushDeduplicatorDefaultActionIdentifier = @"com.apple.UNNotificationDefaultActionIdentifier";
+
+@interface APXPushDeduplicator ()
+{
+    std::unique_ptr<apx::RecentKeys> _recentKeys; // accessed on 'queue'
+}
+
+@property (nonatomic, readwrite) NSUInteger capacity;
+@property (nonatomic, strong) NSURL *fileURL;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) dispatch_queue_t ioQueue;
+
+@end
+
+@implementation APXPushDeduplicator
+
+#pragma mark - Initialization
+
++ (instancetype)sharedDeduplicator
+{
+    static APXPushDeduplicator *sharedDeduplicator = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSURL *directory = [[[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask] firstObject];
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        sharedDeduplicator = [[self alloc] initWithCapacity:kAPXPushDeduplicatorDefaultCapacity fileURL:[directory URLByAppendingPathComponent:@"APXRecentPushNotifications.plist"]];
+    });
+    
+    return sharedDeduplicator;
+}
+
+- (instancetype)init
+{
+    return [self initWithCapacity:kAPXPushDeduplicatorDefaultCapacity fileURL:nil];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity fileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _capacity = MAX(capacity, (NSUInteger)1);
+        _fileURL = fileURL;
+        _queue = dispatch_queue_create("com.appoxee.demo.push-deduplicator", DISPATCH_QUEUE_SERIAL);
+        _ioQueue = dispatch_queue_create("com.appoxee.demo.push-deduplicator.io", DISPATCH_QUEUE_SERIAL);
+        _recentKeys.reset(new apx::RecentKeys(_capacity));
+        
+        [self load];
+    }
+    
+    return self;
+}
+
+#pragma mark - Deduplication
+
+- (BOOL)shouldHandleNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier
+{
+    NSString *key = [[self class] keyForNotification:notification withIdentifier:actionIdentifier];
+    
+    if (!key) return YES;
+    
+    __block BOOL isNew = NO;
+    
+    dispatch_sync(self.queue, ^{
+        
+        isNew = _recentKeys->insert([key UTF8String]);
+        
+        if (isNew) [self save];
+    });
+    
+    return isNew;
+}
+
+- (BOOL)containsNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier
+{
+    NSString *key = [[self class] keyForNotification:notification withIdentifier:actionIdentifier];
+    
+    if (!key) return NO;
+    
+    __block BOOL contains = NO;
+    
+    dispatch_sync(self.queue, ^{
+        contains = _recentKeys->contains([key UTF8String]);
+    });
+    
+    return contains;
+}
+
+- (void)removeAllNotifications
+{
+    dispatch_sync(self.queue, ^{
+        
+        _recentKeys->clear();
+        [self save];
+    });
+}
+
++ (NSString *)keyForNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier
+/*
+  A plain open arrives without an identifier through the legacy callbacks and with the default action identifier through
+  UNUserNotificationCenter, both are keyed on the uniqueID alone.
+*/
+{
+    if (!notification.uniqueID) return nil;
+    
+    if (![actionIdentifier length] || [actionIdentifier isEqualToString:kAPXPushDeduplicatorDefaultActionIdentifier]) {
+        
+        return [NSString stringWithFormat:@"%ld", (long)notification.uniqueID];
+    }
+    
+    return [NSString stringWithFormat:@"%ld|%@", (long)notification.uniqueID, actionIdentifier];
+}
+
+#pragma mark - Persistence
+
+- (void)load
+{
+    if (!self.fileURL) return;
+    
+    NSArray *keys = [NSArray arrayWithContentsOfURL:self.fileURL];
+    
+    for (id key in keys) {
+        
+        if ([key isKindOfClass:[NSString class]]) _recentKeys->insert([key UTF8String]);
+    }
+}
+
+- (void)save
+/*
+  Called on 'queue'. Keys are written oldest first, so load restores the eviction order.
+*/
+{
+    if (!self.fileURL) return;
+    
+    std::vector<std::string> recentKeys = _recentKeys->keysOldestFirst();
+    NSMutableArray *keys = [[NSMutableArray alloc] initWithCapacity:recentKeys.size()];
+    
+    for (const std::string &key : recentKeys) {
+        
+        [keys addObject:@(key.c_str())];
+    }
+    
+    NSURL *fileURL = self.fileURL;
+    
+    dispatch_async(self.ioQueue, ^{
+        [keys writeToURL:fileURL atomically:YES];
+    });
+}
+
+@end
@@ -0,0 +1,62 @@
+//
+//  APXPushEventQueue.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXTransferScheduler.h"
+
+typedef NS_ENUM(NSInteger, APXPushEventType) {
+    APXPushEventTypeReceived = 1,
+    APXPushEventTypeOpened
+};
+
+// Keys of the event dictionaries handed to the transport.
+extern NSString * const APXPushEventIDKey; // NSString, stable for a notification / action identifier / event type, use it for server side dedup.
+extern NSString * const APXPushEventUniqueIDKey; // NSNumber
+extern NSString * const APXPushEventTypeKey; // NSNumber of APXPushEventType
+extern NSString * const APXPushEventActionIdentifierKey; // NSString, may be missing
+extern NSString * const APXPushEventTimestampKey; // NSNumber, seconds since 1970
+
+// Call completion with nil once the batch was accepted, or with an error to keep the events for the next flush.
+typedef void(^APXPushEventTransportBlock)(NSArray *events, void (^completion)(NSError *error));
+
+// Push receipt and open acknowledgements are journaled on disk and sent in batches, instead of one request per event.
+// A batch is only removed from the journal once the transport accepted it, so delivery is at least once.
+// The SDK reports its own receipts to Appoxee, these events go to the app's reporting endpoint.
+@interface APXPushEventQueue : NSObject
+
+// Events are only recorded while a transport is set, there is nowhere to deliver them otherwise.
+@property (nonatomic, copy) APXPushEventTransportBlock transport;
+@property (nonatomic) NSUInteger batchSize; // default is 50, reaching it triggers a flush
+@property (nonatomic) NSUInteger maximumPendingEvents; // default is 1000, the oldest events are dropped beyond it
+@property (nonatomic, readonly) NSUInteger pendingCount;
+
+// When set, events below a full batch are flushed the next time the radio is awake, but no later than maximumEventDelay after the first
+// of them was recorded, instead of waiting for the next flush.
+@property (nonatomic, strong) APXTransferScheduler *transferScheduler;
+@property (nonatomic) NSTimeInterval maximumEventDelay; // default is 15 minutes
+
+// Flushes along with [APXTransferScheduler sharedScheduler], through transportWithURL:session: to the APXPushEventsURL of Info.plist.
+// Without one, nothing is recorded, journaled or sent.
++ (instancetype)sharedQueue;
+
+// POSTs each batch as {"events": [...]} JSON to URL, a batch is accepted with any 2xx status.
++ (APXPushEventTransportBlock)transportWithURL:(NSURL *)URL session:(NSURLSession *)session;
+
+// fileURL may be nil for an in-memory journal.
+- (instancetype)initWithFileURL:(NSURL *)fileURL;
+
+- (void)recordEventOfType:(APXPushEventType)type forNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier;
+
+// Piggyback pending events on a request that is being sent anyway, i.e. an Inbox refresh.
+- (void)noteOutboundRequest;
+
+// Sends all pending events, batch by batch. completion is called with the number of events sent, and the first error if any.
+- (void)flushWithCompletionHandler:(void (^)(NSUInteger sentCount, NSError *error))completion;
+
+@end
@@ -0,0 +1,349 @@
+//
+//  APXPushEventQueue.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXPushEventQueue.h"
+#import "APXPushDeduplicator.h"
+#import "APXLogger.h"
+#import "APXMetrics.h"
+
+NSString * const APXPushEventIDKey = @"event_id";
+NSString * const APXPushEventUniqueIDKey = @"unique_id";
+NSString * const APXPushEventTypeKey = @"type";
+NSString * const APXPushEventActionIdentifierKey = @"action_identifier";
+NSString * const APXPushEventTimestampKey = @"timestamp";
+
+static NSString * const kAPXPushEventsTransferIdentifier = @"com.appoxee.demo.push-events";
+static NSString * const kAPXPushEventsURLKey = @"APXPushEventsURL";
+
+@interface APXPushEventQueue ()
+
+@property (nonatomic, strong) NSURL *fileURL;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) dispatch_queue_t ioQueue;
+@property (nonatomic, strong) NSMutableArray *events; // oldest first
+@property (nonatomic, strong) NSMutableSet *eventIDs;
+@property (nonatomic, strong) NSMutableSet *inFlightEventIDs;
+@property (nonatomic, strong) NSMutableArray *flushCompletions;
+@property (nonatomic) BOOL isFlushing;
+@property (nonatomic) NSUInteger sentCount;
+@property (nonatomic, strong) APXHistogram *queueDepth;
+@property (nonatomic, strong) APXCounter *retryCounter;
+
+@end
+
+@implementation APXPushEventQueue
+
+#pragma mark - Initialization
+
++ (instancetype)sharedQueue
+{
+    static APXPushEventQueue *sharedQueue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSString *URLString = [[NSBundle mainBundle] objectForInfoDictionaryKey:kAPXPushEventsURLKey];
+        NSURL *URL = [URLString length] ? [NSURL URLWithString:URLString] : nil;
+        
+        if (!URL) {
+            
+            // Nothing is journaled, recorded or flushed, an empty queue without a transport.
+            APXLogInfo(APXLogSubsystemPush, @"No %@ in Info.plist, push events are not recorded", kAPXPushEventsURLKey);
+            sharedQueue = [[self alloc] initWithFileURL:nil];
+            return;
+        }
+        
+        NSURL *directory = [[[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask] firstObject];
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        
+        sharedQueue = [[self alloc] initWithFileURL:[directory URLByAppendingPathComponent:@"APXPushEvents.plist"]];
+        sharedQueue.transferScheduler = [APXTransferScheduler sharedScheduler];
+        sharedQueue.transport = [self transportWithURL:URL session:[NSURLSession sharedSession]];
+    });
+    
+    return sharedQueue;
+}
+
++ (APXPushEventTransportBlock)transportWithURL:(NSURL *)URL session:(NSURLSession *)session
+{
+    return ^(NSArray *events, void (^completion)(NSError *error)) {
+        
+        NSError *error = nil;
+        NSData *body = [NSJSONSerialization dataWithJSONObject:@{@"events" : events} options:0 error:&error];
+        
+        if (!body) {
+            
+            completion(error);
+            return;
+        }
+        
+        NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:URL];
+        request.HTTPMethod = @"POST";
+        request.HTTPBody = body;
+        [request setValue:@"application/json" forHTTPHeaderField:@"Content-Type"];
+        
+        [[session dataTaskWithRequest:request completionHandler:^(NSData *data, NSURLResponse *response, NSError *requestError) {
+            
+            NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ? [(NSHTTPURLResponse *)response statusCode] : 0;
+            
+            if (!requestError && (statusCode < 200 || statusCode >= 300)) {
+                
+                requestError = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorBadServerResponse userInfo:@{@"status" : @(statusCode)}];
+            }
+            
+            completion(requestError);
+        }] resume];
+    };
+}
+
+- (instancetype)init
+{
+    return [self initWithFileURL:nil];
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _fileURL = fileURL;
+        _batchSize = 50;
+        _maximumPendingEvents = 1000;
+        _maximumEventDelay = 15.0 * 60.0;
+        _queue = dispatch_queue_create("com.appoxee.demo.push-events", DISPATCH_QUEUE_SERIAL);
+        _ioQueue = dispatch_queue_create("com.appoxee.demo.push-events.io", DISPATCH_QUEUE_SERIAL);
+        _events = [[NSMutableArray alloc] init];
+        _eventIDs = [[NSMutableSet alloc] init];
+        _inFlightEventIDs = [[NSMutableSet alloc] init];
+        _flushCompletions = [[NSMutableArray alloc] init];
+        _queueDepth = [[APXMetrics sharedMetrics] histogramNamed:APXMetricPushEventQueueDepth];
+        _retryCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricPushEventRetries];
+        
+        [self load];
+    }
+    
+    return self;
+}
+
+#pragma mark - Recording
+
+- (void)recordEventOfType:(APXPushEventType)type forNotification:(APXPushNotification *)notification withIdentifier:(NSString *)actionIdentifier
+{
+    NSString *deliveryKey = [APXPushDeduplicator keyForNotification:notification withIdentifier:actionIdentifier];
+    
+    if (!deliveryKey || !self.transport) return;
+    
+    // Taps on two different action buttons of the same push are two events.
+    NSMutableDictionary *event = [[NSMutableDictionary alloc] init];
+    event[APXPushEventIDKey] = [NSString stringWithFormat:@"%@-%ld", deliveryKey, (long)type];
+    event[APXPushEventUniqueIDKey] = @(notification.uniqueID);
+    event[APXPushEventTypeKey] = @(type);
+    event[APXPushEventTimestampKey] = @([[NSDate date] timeIntervalSince1970]);
+    
+    if ([actionIdentifier length]) event[APXPushEventActionIdentifierKey] = actionIdentifier;
+    
+    dispatch_async(self.queue, ^{
+        
+        if ([self.eventIDs containsObject:event[APXPushEventIDKey]]) return;
+        
+        [self.events addObject:event];
+        [self.eventIDs addObject:event[APXPushEventIDKey]];
+        [self trim];
+        [self save];
+        [self.queueDepth recordValue:[self.events count]];
+        
+        if ([self.events count] >= self.batchSize) {
+            
+            [self startFlush];
+            
+        } else {
+            
+            [self scheduleTransfer];
+        }
+    });
+}
+
+- (void)scheduleTransfer
+{
+    APXTransferScheduler *transferScheduler = self.transferScheduler;
+    
+    if (!transferScheduler) return;
+    
+    __weak typeof(self) weakSelf = self;
+    
+    // Scheduled again for every event, the earliest deadline is kept.
+    [transferScheduler scheduleTransferWithIdentifier:kAPXPushEventsTransferIdentifier maximumDelay:self.maximumEventDelay block:^{
+        
+        [weakSelf flushWithCompletionHandler:nil];
+    }];
+}
+
+- (void)trim
+/*
+  Called on 'queue'. Drops the oldest events which are not being sent right now.
+*/
+{
+    while ([self.events count] > self.maximumPendingEvents) {
+        
+        NSUInteger index = [self.events indexOfObjectPassingTest:^BOOL(NSDictionary *event, NSUInteger idx, BOOL *stop) {
+            return ![self.inFlightEventIDs containsObject:event[APXPushEventIDKey]];
+        }];
+        
+        if (index == NSNotFound) break;
+        
+        [self.eventIDs removeObject:self.events[index][APXPushEventIDKey]];
+        [self.events removeObjectAtIndex:index];
+    }
+}
+
+#pragma mark - Flushing
+
+- (void)noteOutboundRequest
+{
+    dispatch_async(self.queue, ^{
+        
+        if ([self.events count]) [self startFlush];
+    });
+}
+
+- (void)flushWithCompletionHandler:(void (^)(NSUInteger, NSError *))completion
+{
+    dispatch_async(self.queue, ^{
+        
+        if (completion) [self.flushCompletions addObject:[completion copy]];
+        
+        [self startFlush];
+    });
+}
+
+- (void)startFlush
+/*
+  Called on 'queue'. A flush that is already running picks up the new events, and calls every waiting completion when it is done.
+*/
+{
+    if (self.isFlushing) return;
+    
+    self.isFlushing = YES;
+    self.sentCount = 0;
+    
+    [self sendNextBatch];
+}
+
+- (void)sendNextBatch
+{
+    APXPushEventTransportBlock transport = self.transport;
+    NSArray *batch = [self.events subarrayWithRange:NSMakeRange(0, MIN([self.events count], MAX(self.batchSize, (NSUInteger)1)))];
+    
+    if (!transport || ![batch count]) {
+        
+        [self finishFlushWithError:nil];
+        return;
+    }
+    
+    NSArray *batchIDs = [batch valueForKey:APXPushEventIDKey];
+    [self.inFlightEventIDs addObjectsFromArray:batchIDs];
+    
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        
+        transport(batch, ^(NSError *error) {
+            
+            dispatch_async(self.queue, ^{
+                
+                [self.inFlightEventIDs minusSet:[NSSet setWithArray:batchIDs]];
+                
+                if (error) {
+                    
+                    [self finishFlushWithError:error];
+                    return;
+                }
+                
+                NSSet *sentIDs = [NSSet setWithArray:batchIDs];
+                NSIndexSet *sentIndexes = [self.events indexesOfObjectsPassingTest:^BOOL(NSDictionary *event, NSUInteger idx, BOOL *stop) {
+                    return [sentIDs containsObject:event[APXPushEventIDKey]];
+                }];
+                
+                [self.events removeObjectsAtIndexes:sentIndexes];
+                [self.eventIDs minusSet:sentIDs];
+                [self save];
+                
+                self.sentCount += [sentIndexes count];
+                
+                [self sendNextBatch];
+            });
+        });
+    });
+}
+
+- (void)finishFlushWithError:(NSError *)error
+{
+    if (error) {
+        
+        // The events stay in the journal and are sent again on the next flush.
+        [self.retryCounter increment];
+        APXLogWarning(APXLogSubsystemNetwork, @"Push event flush failed after %lu events: %@", (unsigned long)self.sentCount, error);
+    }
+    
+    NSArray *completions = [self.flushCompletions copy];
+    NSUInteger sentCount = self.sentCount;
+    
+    [self.flushCompletions removeAllObjects];
+    self.isFlushing = NO;
+    
+    if (![completions count]) return;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        for (void (^completion)(NSUInteger, NSError *) in completions) {
+            
+            completion(sentCount, error);
+        }
+    });
+}
+
+#pragma mark - Getters
+
+- (NSUInteger)pendingCount
+{
+    __block NSUInteger count = 0;
+    
+    dispatch_sync(self.queue, ^{
+        count = [self.events count];
+    });
+    
+    return count;
+}
+
+#pragma mark - Persistence
+
+- (void)load
+{
+    if (!self.fileURL) return;
+    
+    for (id event in [NSArray arrayWithContentsOfURL:self.fileURL]) {
+        
+        if ([event isKindOfClass:[NSDictionary class]] && event[APXPushEventIDKey] && ![self.eventIDs containsObject:event[APXPushEventIDKey]]) {
+            
+            [self.events addObject:event];
+            [self.eventIDs addObject:event[APXPushEventIDKey]];
+        }
+    }
+}
+
+- (void)save
+{
+    if (!self.fileURL) return;
+    
+    NSArray *events = [self.events copy];
+    NSURL *fileURL = self.fileURL;
+    
+    dispatch_async(self.ioQueue, ^{
+        [events writeToURL:fileURL atomically:YES];
+    });
+}
+
+@end
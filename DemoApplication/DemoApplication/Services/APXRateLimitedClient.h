@@ -0,0 +1,32 @@
+//
+//  APXRateLimitedClient.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "APXAppoxeeClient.h"
+#import "APXRateLimiter.h"
+
+// An APXAppoxeeClient in front of another one, which holds tag, custom field and alias writes and Inbox refreshes to the limits of
+// an APXRateLimiter. A call over its class's limit isn't sent but deferred, and merged into a deferred call it supersedes:
+// increments of a field are summed, a value set replaces a pending value or increment, an increment of a pending number is added to it,
+// tag changes become one net change, the last alias write wins and Inbox refreshes share one. The handlers of merged calls receive
+// the answer to the call which was sent. Deferred calls are sent in order as their bucket refills.
+// Reads, deletions and registration calls are passed through.
+@interface APXRateLimitedClient : NSObject <APXAppoxeeClient>
+
+@property (nonatomic, strong, readonly) id<APXAppoxeeClient> client;
+@property (nonatomic, strong, readonly) APXRateLimiter *limiter;
+
+// [Appoxee shared] limited by [APXRateLimiter sharedLimiter]. The Services' shared instances talk to Appoxee through it.
++ (instancetype)sharedClient;
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client limiter:(APXRateLimiter *)limiter;
+
+// Calls of the class waiting for a token, after merging.
+- (NSUInteger)deferredCallCountForClass:(APXRateLimitClass)rateClass;
+
+@end
@@ -0,0 +1,418 @@
+//
+//  APXRateLimitedClient.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXRateLimitedClient.h"
+#import "APXLogger.h"
+#import "APXMetrics.h"
+#import "APXTransferScheduler.h"
+
+typedef NS_ENUM(NSInteger, APXDeferredCallKind) {
+    APXDeferredCallKindInboxRefresh = 0,
+    APXDeferredCallKindSetAlias,
+    APXDeferredCallKindRemoveAlias,
+    APXDeferredCallKindTags,
+    APXDeferredCallKindSetValue,
+    APXDeferredCallKindIncrement
+};
+
+// A limited call, and the handlers of the calls merged into it.
+@interface APXDeferredCall : NSObject
+
+@property (nonatomic) APXDeferredCallKind kind;
+@property (nonatomic) APXRateLimitClass rateClass;
+@property (nonatomic, copy) NSString *mergeKey; // calls with the same key may be merged
+@property (nonatomic, copy) NSString *key; // of a custom field
+@property (nonatomic, strong) id value; // the alias, a custom field's value or increment
+@property (nonatomic, strong) NSMutableOrderedSet *tagsToAdd;
+@property (nonatomic, strong) NSMutableOrderedSet *tagsToRemove;
+@property (nonatomic, strong) NSMutableArray *handlers; // of Type AppoxeeCompletionHandler
+
+@end
+
+@implementation APXDeferredCall
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _handlers = [[NSMutableArray alloc] init];
+    }
+    
+    return self;
+}
+
+@end
+
+static NSNumber *APXSumOfNumbers(NSNumber *number, NSNumber *otherNumber)
+{
+    if (CFNumberIsFloatType((__bridge CFNumberRef)number) || CFNumberIsFloatType((__bridge CFNumberRef)otherNumber)) {
+        
+        return @([number doubleValue] + [otherNumber doubleValue]);
+    }
+    
+    return @([number longLongValue] + [otherNumber longLongValue]);
+}
+
+@interface APXRateLimitedClient ()
+
+@property (nonatomic, strong, readwrite) id<APXAppoxeeClient> client;
+@property (nonatomic, strong, readwrite) APXRateLimiter *limiter;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) NSArray *deferredCalls; // one NSMutableArray of APXDeferredCall per APXRateLimitClass, only touched on 'queue'
+@property (nonatomic, strong) NSMutableDictionary *latestCallsByMergeKey; // merge key -> the last deferred APXDeferredCall with it
+@property (nonatomic, strong) NSMutableIndexSet *scheduledClasses; // classes with a flush scheduled
+@property (nonatomic, strong) APXCounter *deferredCounter;
+@property (nonatomic, strong) APXCounter *mergedCounter;
+
+@end
+
+@implementation APXRateLimitedClient
+
+#pragma mark - Initialization
+
++ (instancetype)sharedClient
+{
+    static APXRateLimitedClient *sharedClient = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedClient = [[self alloc] initWithClient:[Appoxee shared] limiter:[APXRateLimiter sharedLimiter]];
+    });
+    
+    return sharedClient;
+}
+
+- (instancetype)initWithClient:(id<APXAppoxeeClient>)client limiter:(APXRateLimiter *)limiter
+{
+    self = [super init];
+    
+    if (self) {
+        
+        NSMutableArray *deferredCalls = [[NSMutableArray alloc] initWithCapacity:APXRateLimitClassCount];
+        
+        for (NSInteger rateClass = 0; rateClass < APXRateLimitClassCount; rateClass++) {
+            
+            [deferredCalls addObject:[[NSMutableArray alloc] init]];
+        }
+        
+        _client = client;
+        _limiter = limiter;
+        _queue = dispatch_queue_create("com.appoxee.demo.rate-limited-client", DISPATCH_QUEUE_SERIAL);
+        _deferredCalls = deferredCalls;
+        _latestCallsByMergeKey = [[NSMutableDictionary alloc] init];
+        _scheduledClasses = [[NSMutableIndexSet alloc] init];
+        _deferredCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricRateLimitDeferredCalls];
+        _mergedCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricRateLimitMergedCalls];
+    }
+    
+    return self;
+}
+
+- (NSUInteger)deferredCallCountForClass:(APXRateLimitClass)rateClass
+{
+    if (rateClass < 0 || rateClass >= APXRateLimitClassCount) return 0;
+    
+    __block NSUInteger count = 0;
+    
+    dispatch_sync(self.queue, ^{
+        
+        count = [self.deferredCalls[rateClass] count];
+    });
+    
+    return count;
+}
+
+#pragma mark - Limiting
+
+- (void)submitCall:(APXDeferredCall *)call handler:(AppoxeeCompletionHandler)handler
+/*
+  A call is only sent right away when none of its class are waiting, the deferred ones would otherwise be overtaken.
+*/
+{
+    if (handler) [call.handlers addObject:[handler copy]];
+    
+    dispatch_async(self.queue, ^{
+        
+        NSMutableArray *deferredCalls = self.deferredCalls[call.rateClass];
+        
+        if (![deferredCalls count] && [self.limiter consumeTokenForClass:call.rateClass]) {
+            
+            [self sendCall:call];
+            return;
+        }
+        
+        APXDeferredCall *pendingCall = self.latestCallsByMergeKey[call.mergeKey];
+        
+        if (pendingCall && [self mergeCall:call intoCall:pendingCall]) {
+            
+            [self.mergedCounter increment];
+            return;
+        }
+        
+        [deferredCalls addObject:call];
+        self.latestCallsByMergeKey[call.mergeKey] = call;
+        [self.deferredCounter increment];
+        
+        APXLogDebug(APXLogSubsystemNetwork, @"Deferred an Appoxee call over its rate limit, %lu waiting", (unsigned long)[deferredCalls count]);
+        
+        [self scheduleFlushForClass:call.rateClass];
+    });
+}
+
+- (BOOL)mergeCall:(APXDeferredCall *)call intoCall:(APXDeferredCall *)pendingCall
+/*
+  Called on 'queue'. pendingCall is changed to have the effect of both calls, in their order. Returns NO if there is no such call,
+  i.e. an increment of a pending string, call is then deferred after pendingCall.
+*/
+{
+    switch (call.kind) {
+        
+        case APXDeferredCallKindInboxRefresh:
+            break;
+            
+        case APXDeferredCallKindSetAlias:
+        case APXDeferredCallKindRemoveAlias:
+        case APXDeferredCallKindSetValue:
+            pendingCall.kind = call.kind;
+            pendingCall.value = call.value;
+            break;
+            
+        case APXDeferredCallKindTags:
+            [pendingCall.tagsToAdd minusOrderedSet:call.tagsToRemove];
+            [pendingCall.tagsToAdd unionOrderedSet:call.tagsToAdd];
+            [pendingCall.tagsToRemove minusOrderedSet:call.tagsToAdd];
+            [pendingCall.tagsToRemove unionOrderedSet:call.tagsToRemove];
+            break;
+            
+        case APXDeferredCallKindIncrement:
+            if (![pendingCall.value isKindOfClass:[NSNumber class]]) return NO;
+            pendingCall.value = APXSumOfNumbers(pendingCall.value, call.value);
+            break;
+    }
+    
+    [pendingCall.handlers addObjectsFromArray:call.handlers];
+    
+    return YES;
+}
+
+- (void)scheduleFlushForClass:(APXRateLimitClass)rateClass
+{
+    if ([self.scheduledClasses containsIndex:rateClass]) return;
+    
+    [self.scheduledClasses addIndex:rateClass];
+    
+    NSTimeInterval delay = [self.limiter delayUntilTokenForClass:rateClass];
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), self.queue, ^{
+        
+        [self.scheduledClasses removeIndex:rateClass];
+        [self flushClass:rateClass];
+    });
+}
+
+- (void)flushClass:(APXRateLimitClass)rateClass
+{
+    NSMutableArray *deferredCalls = self.deferredCalls[rateClass];
+    
+    while ([deferredCalls count] && [self.limiter consumeTokenForClass:rateClass]) {
+        
+        APXDeferredCall *call = deferredCalls[0];
+        [deferredCalls removeObjectAtIndex:0];
+        
+        // Once sent, a call can't take any more merges.
+        if (self.latestCallsByMergeKey[call.mergeKey] == call) [self.latestCallsByMergeKey removeObjectForKey:call.mergeKey];
+        
+        [self sendCall:call];
+    }
+    
+    if ([deferredCalls count]) [self scheduleFlushForClass:rateClass];
+}
+
+- (void)sendCall:(APXDeferredCall *)call
+{
+    [[APXTransferScheduler sharedScheduler] noteNetworkActivity];
+    
+    NSArray *handlers = [call.handlers copy];
+    
+    AppoxeeCompletionHandler handler = ^(NSError *appoxeeError, id data) {
+        
+        for (AppoxeeCompletionHandler callHandler in handlers) {
+            
+            callHandler(appoxeeError, data);
+        }
+    };
+    
+    switch (call.kind) {
+        
+        case APXDeferredCallKindInboxRefresh:
+            [self.client refreshInboxWithCompletionHandler:handler];
+            break;
+            
+        case APXDeferredCallKindSetAlias:
+            [self.client setDeviceAlias:call.value withCompletionHandler:handler];
+            break;
+            
+        case APXDeferredCallKindRemoveAlias:
+            [self.client removeDeviceAliasWithCompletionHandler:handler];
+            break;
+            
+        case APXDeferredCallKindTags:
+            [self.client addTagsToDevice:[call.tagsToAdd array] andRemove:[call.tagsToRemove array] withCompletionHandler:handler];
+            break;
+            
+        case APXDeferredCallKindSetValue:
+            if ([call.value isKindOfClass:[NSDate class]]) {
+                
+                [self.client setDateValue:call.value forKey:call.key withCompletionHandler:handler];
+                
+            } else if ([call.value isKindOfClass:[NSNumber class]]) {
+                
+                [self.client setNumberValue:call.value forKey:call.key withCompletionHandler:handler];
+                
+            } else {
+                
+                [self.client setStringValue:call.value forKey:call.key withCompletionHandler:handler];
+            }
+            break;
+            
+        case APXDeferredCallKindIncrement:
+            [self.client incrementNumericKey:call.key byNumericValue:call.value withCompletionHandler:handler];
+            break;
+    }
+}
+
+- (APXDeferredCall *)callOfKind:(APXDeferredCallKind)kind rateClass:(APXRateLimitClass)rateClass mergeKey:(NSString *)mergeKey
+{
+    APXDeferredCall *call = [[APXDeferredCall alloc] init];
+    call.kind = kind;
+    call.rateClass = rateClass;
+    call.mergeKey = mergeKey;
+    
+    return call;
+}
+
+- (void)submitCustomFieldCallOfKind:(APXDeferredCallKind)kind key:(NSString *)key value:(id)value handler:(AppoxeeCompletionHandler)handler
+{
+    APXDeferredCall *call = [self callOfKind:kind rateClass:APXRateLimitClassCustomFields mergeKey:[@"field." stringByAppendingString:key ?: @""]];
+    call.key = key;
+    call.value = value;
+    
+    [self submitCall:call handler:handler];
+}
+
+#pragma mark - Registration
+
+- (void)didRegisterForRemoteNotificationsWithDeviceToken:(NSData *)token
+{
+    [self.client didRegisterForRemoteNotificationsWithDeviceToken:token];
+}
+
+- (void)didRegisterUserNotificationSettings:(NSObject *)notificationSettings
+{
+    [self.client didRegisterUserNotificationSettings:notificationSettings];
+}
+
+- (void)deviceInformationwithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.client deviceInformationwithCompletionHandler:handler];
+}
+
+#pragma mark - Background Fetch
+
+- (void)performFetchWithCompletionHandler:(void (^)(UIBackgroundFetchResult))fetchHandler andNotifyCompletionWithBlock:(AppoxeeCompletionHandler)completionBlock
+{
+    [self.client performFetchWithCompletionHandler:fetchHandler andNotifyCompletionWithBlock:completionBlock];
+}
+
+#pragma mark - Inbox
+
+- (void)getRichMessagesWithHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.client getRichMessagesWithHandler:handler];
+}
+
+- (void)deleteRichMessage:(APXRichMessage *)richMessage withHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.client deleteRichMessage:richMessage withHandler:handler];
+}
+
+- (void)refreshInboxWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self submitCall:[self callOfKind:APXDeferredCallKindInboxRefresh rateClass:APXRateLimitClassInboxRefresh mergeKey:@"inbox"] handler:handler];
+}
+
+#pragma mark - Alias
+
+- (void)setDeviceAlias:(NSString *)alias withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    APXDeferredCall *call = [self callOfKind:APXDeferredCallKindSetAlias rateClass:APXRateLimitClassAlias mergeKey:@"alias"];
+    call.value = alias;
+    
+    [self submitCall:call handler:handler];
+}
+
+- (void)removeDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self submitCall:[self callOfKind:APXDeferredCallKindRemoveAlias rateClass:APXRateLimitClassAlias mergeKey:@"alias"] handler:handler];
+}
+
+- (void)getDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.client getDeviceAliasWithCompletionHandler:handler];
+}
+
+- (void)clearAliasCacheWithCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.client clearAliasCacheWithCompletionHandler:handler];
+}
+
+#pragma mark - Tags
+
+- (void)fetchDeviceTags:(AppoxeeCompletionHandler)handler
+{
+    [self.client fetchDeviceTags:handler];
+}
+
+- (void)addTagsToDevice:(NSArray *)tagsToAdd andRemove:(NSArray *)tagsToRemove withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    APXDeferredCall *call = [self callOfKind:APXDeferredCallKindTags rateClass:APXRateLimitClassTags mergeKey:@"tags"];
+    call.tagsToAdd = [NSMutableOrderedSet orderedSetWithArray:tagsToAdd ?: @[]];
+    call.tagsToRemove = [NSMutableOrderedSet orderedSetWithArray:tagsToRemove ?: @[]];
+    
+    [self submitCall:call handler:handler];
+}
+
+#pragma mark - Custom Fields
+
+- (void)setDateValue:(NSDate *)date forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self submitCustomFieldCallOfKind:APXDeferredCallKindSetValue key:key value:date handler:handler];
+}
+
+- (void)setNumberValue:(NSNumber *)number forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self submitCustomFieldCallOfKind:APXDeferredCallKindSetValue key:key value:number handler:handler];
+}
+
+- (void)incrementNumericKey:(NSString *)key byNumericValue:(NSNumber *)number withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self submitCustomFieldCallOfKind:APXDeferredCallKindIncrement key:key value:number handler:handler];
+}
+
+- (void)setStringValue:(NSString *)string forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self submitCustomFieldCallOfKind:APXDeferredCallKindSetValue key:key value:string handler:handler];
+}
+
+- (void)fetchCustomFieldByKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler
+{
+    [self.client fetchCustomFieldByKey:key withCompletionHandler:handler];
+}
+
+@end
@@ -0,0 +1,50 @@
+//
+//  APXRateLimiter.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+typedef NS_ENUM(NSInteger, APXRateLimitClass) {
+    APXRateLimitClassTags = 0, // "tags", default is 10 per minute
+    APXRateLimitClassCustomFields, // "custom_fields", writes only, default is 30 per minute
+    APXRateLimitClassAlias, // "alias", writes only, default is 5 per minute
+    APXRateLimitClassInboxRefresh, // "inbox_refresh", default is 6 per minute
+    APXRateLimitClassCount
+};
+
+// The response header Appoxee sends new limits in, i.e. "tags=10/60, custom_fields=30/60" for 10 calls per 60 seconds.
+// Classes which aren't listed keep their limit. A limit of 0 calls lifts it.
+extern NSString * const APXRateLimitHeaderField;
+
+// One token bucket per class of Appoxee operations. A bucket holds up to 'limit' tokens and gets them back at limit / interval
+// tokens per second, so a burst up to the limit goes out right away while a steady stream of calls is held to the rate.
+// All methods are thread safe.
+@interface APXRateLimiter : NSObject
+
+// Limits of the APXRateLimits string in the Info.plist, in the header format, over which the last limits Appoxee sent apply.
++ (instancetype)sharedLimiter;
+
+// The default limits, with full buckets. Limits sent by Appoxee are not persisted.
+- (instancetype)init;
+
+- (void)setLimit:(NSUInteger)limit perInterval:(NSTimeInterval)interval forClass:(APXRateLimitClass)rateClass;
+- (NSUInteger)limitForClass:(APXRateLimitClass)rateClass;
+- (NSTimeInterval)intervalForClass:(APXRateLimitClass)rateClass;
+
+// Takes a token from the class's bucket. NO if it's empty, the call should be deferred.
+- (BOOL)consumeTokenForClass:(APXRateLimitClass)rateClass;
+
+// Seconds until the bucket has a token again, 0 if it has one now.
+- (NSTimeInterval)delayUntilTokenForClass:(APXRateLimitClass)rateClass;
+
+// Applies limits in the header format. Returns NO, and changes nothing, if value isn't one.
+- (BOOL)updateLimitsWithHeaderValue:(NSString *)value;
+
+// Applies the limits of response's APXRateLimitHeaderField. NO if it isn't an HTTP response carrying one.
+- (BOOL)updateLimitsWithResponse:(NSURLResponse *)response;
+
+@end
@@ -0,0 +1,210 @@
+//
+//  APXRateLimiter.mm
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXRateLimiter.h"
+#import "APXLogger.h"
+#import "APXMetrics.h"
+#include <vector>
+#include "apx/RateLimits.h"
+#include "apx/TokenBucket.h"
+
+NSString * const APXRateLimitHeaderField = @"X-Appoxee-Rate-Limit";
+
+static NSString * const kAPXRateLimitsInfoKey = @"APXRateLimits";
+static NSString * const kAPXRateLimitsDefaultsKey = @"APXRateLimits"; // class name -> "limit/interval", the last limits Appoxee sent
+
+static NSString * const kAPXRateLimitClassNames[APXRateLimitClassCount] = {
+    @"tags",
+    @"custom_fields",
+    @"alias",
+    @"inbox_refresh"
+};
+
+static NSUInteger const kAPXRateLimitDefaultLimits[APXRateLimitClassCount] = { 10, 30, 5, 6 };
+static NSTimeInterval const kAPXRateLimitDefaultInterval = 60.0;
+
+@interface APXRateLimiter ()
+{
+    std::vector<apx::TokenBucket> _buckets; // by APXRateLimitClass, on the APXMetricsNow() clock
+}
+
+@property (nonatomic) BOOL persistsLimits;
+
+@end
+
+@implementation APXRateLimiter
+
+#pragma mark - Initialization
+
++ (instancetype)sharedLimiter
+{
+    static APXRateLimiter *sharedLimiter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        sharedLimiter = [[self alloc] init];
+        
+        NSString *configuredLimits = [[NSBundle mainBundle] objectForInfoDictionaryKey:kAPXRateLimitsInfoKey];
+        
+        if ([configuredLimits isKindOfClass:[NSString class]]) [sharedLimiter updateLimitsWithHeaderValue:configuredLimits];
+        
+        NSDictionary *sentLimits = [[NSUserDefaults standardUserDefaults] dictionaryForKey:kAPXRateLimitsDefaultsKey];
+        
+        [sentLimits enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *limit, BOOL *stop) {
+            
+            if ([name isKindOfClass:[NSString class]] && [limit isKindOfClass:[NSString class]]) {
+                
+                [sharedLimiter updateLimitsWithHeaderValue:[NSString stringWithFormat:@"%@=%@", name, limit]];
+            }
+        }];
+        
+        sharedLimiter.persistsLimits = YES;
+    });
+    
+    return sharedLimiter;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        
+        uint64_t now = APXMetricsNow();
+        _buckets.reserve(APXRateLimitClassCount);
+        
+        for (NSInteger rateClass = 0; rateClass < APXRateLimitClassCount; rateClass++) {
+            
+            _buckets.push_back(apx::TokenBucket((unsigned)kAPXRateLimitDefaultLimits[rateClass], kAPXRateLimitDefaultInterval, now));
+        }
+    }
+    
+    return self;
+}
+
+#pragma mark - Limits
+
+- (void)setLimit:(NSUInteger)limit perInterval:(NSTimeInterval)interval forClass:(APXRateLimitClass)rateClass
+{
+    if (rateClass < 0 || rateClass >= APXRateLimitClassCount) return;
+    
+    @synchronized (self) {
+        
+        // A lower limit applies right away, a higher one as the bucket refills.
+        _buckets[rateClass].setLimit((unsigned)MIN(limit, (NSUInteger)UINT_MAX), interval, APXMetricsNow());
+    }
+}
+
+- (NSUInteger)limitForClass:(APXRateLimitClass)rateClass
+{
+    if (rateClass < 0 || rateClass >= APXRateLimitClassCount) return 0;
+    
+    @synchronized (self) {
+        
+        return _buckets[rateClass].limit();
+    }
+}
+
+- (NSTimeInterval)intervalForClass:(APXRateLimitClass)rateClass
+{
+    if (rateClass < 0 || rateClass >= APXRateLimitClassCount) return 0.0;
+    
+    @synchronized (self) {
+        
+        return _buckets[rateClass].interval();
+    }
+}
+
+#pragma mark - Tokens
+
+- (BOOL)consumeTokenForClass:(APXRateLimitClass)rateClass
+{
+    if (rateClass < 0 || rateClass >= APXRateLimitClassCount) return YES;
+    
+    @synchronized (self) {
+        
+        return _buckets[rateClass].consume(APXMetricsNow());
+    }
+}
+
+- (NSTimeInterval)delayUntilTokenForClass:(APXRateLimitClass)rateClass
+{
+    if (rateClass < 0 || rateClass >= APXRateLimitClassCount) return 0.0;
+    
+    @synchronized (self) {
+        
+        return _buckets[rateClass].delayUntilToken(APXMetricsNow());
+    }
+}
+
+#pragma mark - Remote Limits
+
+- (BOOL)updateLimitsWithHeaderValue:(NSString *)value
+/*
+  apx::parseRateLimits reads the whole value before any limit is applied, a malformed header doesn't leave the limits half updated.
+  Unknown class names are skipped, so Appoxee can send limits of classes a newer app version knows about.
+*/
+{
+    std::vector<apx::RateLimit> limits;
+    
+    if (![value isKindOfClass:[NSString class]] || !apx::parseRateLimits([value UTF8String], limits)) return NO;
+    
+    BOOL changed = NO;
+    
+    for (const apx::RateLimit &limit : limits) {
+        
+        NSString *name = @(limit.name.c_str());
+        
+        for (NSInteger rateClass = 0; rateClass < APXRateLimitClassCount; rateClass++) {
+            
+            if (![name isEqualToString:kAPXRateLimitClassNames[rateClass]]) continue;
+            
+            [self setLimit:limit.limit perInterval:limit.interval forClass:(APXRateLimitClass)rateClass];
+            changed = YES;
+            
+            APXLogInfo(APXLogSubsystemNetwork, @"Rate limit of %@ set to %u per %g seconds", name, limit.limit, limit.interval);
+        }
+    }
+    
+    if (self.persistsLimits && changed) [self saveLimits];
+    
+    return YES;
+}
+
+- (BOOL)updateLimitsWithResponse:(NSURLResponse *)response
+{
+    if (![response isKindOfClass:[NSHTTPURLResponse class]]) return NO;
+    
+    __block NSString *value = nil;
+    
+    // Header names are case insensitive, and not every iOS version canonicalizes them.
+    [[(NSHTTPURLResponse *)response allHeaderFields] enumerateKeysAndObjectsUsingBlock:^(NSString *field, NSString *fieldValue, BOOL *stop) {
+        
+        if ([field caseInsensitiveCompare:APXRateLimitHeaderField] == NSOrderedSame) {
+            
+            value = fieldValue;
+            *stop = YES;
+        }
+    }];
+    
+    return value ? [self updateLimitsWithHeaderValue:value] : NO;
+}
+
+- (void)saveLimits
+{
+    NSMutableDictionary *limits = [[NSMutableDictionary alloc] initWithCapacity:APXRateLimitClassCount];
+    
+    for (NSInteger rateClass = 0; rateClass < APXRateLimitClassCount; rateClass++) {
+        
+        limits[kAPXRateLimitClassNames[rateClass]] = [NSString stringWithFormat:@"%lu/%g", (unsigned long)[self limitForClass:(APXRateLimitClass)rateClass], [self intervalForClass:(APXRateLimitClass)rateClass]];
+    }
+    
+    [[NSUserDefaults standardUserDefaults] setObject:limits forKey:kAPXRateLimitsDefaultsKey];
+}
+
+@end
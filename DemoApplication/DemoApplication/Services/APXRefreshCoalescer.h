@@ -0,0 +1,40 @@
+//
+//  APXRefreshCoalescer.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import "APXAppoxeeClient.h"
+
+@class APXInboxStore;
+
+typedef void(^APXRefreshCoalescerFetchHandler)(UIBackgroundFetchResult fetchResult);
+typedef void(^APXRefreshCoalescerRefreshBlock)(APXRefreshCoalescerFetchHandler completion);
+
+// Silent 'trigger update' pushes sent back to back should not make the app sync once per push.
+// A request starts a refresh right away, unless one started less than 'window' ago: then it waits for the window to end, along with any
+// other request arriving meanwhile, and they share a single refresh. Requests arriving while a refresh is in flight attach to it.
+// Every fetch completion handler is called exactly once, with the result of the shared refresh.
+@interface APXRefreshCoalescer : NSObject
+
+@property (nonatomic, readonly) NSTimeInterval window;
+@property (nonatomic, readonly) BOOL isRefreshing;
+
+// Coalesces the syncs of trigger updates and background fetches, through syncBlockWithClient:inboxStore: with [APXRateLimitedClient sharedClient]
+// and [APXInboxStore sharedStore].
++ (instancetype)sharedCoalescer;
+
+// A sync: the SDK's performFetch through client, then a refresh of inboxStore from Appoxee. Completes with the fetch result, or with
+// UIBackgroundFetchResultFailed when the Inbox refresh failed.
++ (APXRefreshCoalescerRefreshBlock)syncBlockWithClient:(id<APXAppoxeeClient>)client inboxStore:(APXInboxStore *)inboxStore;
+
+// refreshBlock performs the actual work, and must call its completion exactly once, on any queue.
+- (instancetype)initWithWindow:(NSTimeInterval)window refreshBlock:(APXRefreshCoalescerRefreshBlock)refreshBlock;
+
+// handler may be nil. Handlers are called on the main queue.
+- (void)requestRefreshWithFetchCompletionHandler:(APXRefreshCoalescerFetchHandler)handler;
+
+@end
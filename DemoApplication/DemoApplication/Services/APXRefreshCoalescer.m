@@ -0,0 +1,160 @@
+//
+//  APXRefreshCoalescer.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXRefreshCoalescer.h"
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXInboxStore.h"
+#import "APXRateLimitedClient.h"
+
+// Short enough to leave most of the ~30 seconds iOS grants a background fetch for the refresh itself.
+static NSTimeInterval const kAPXRefreshCoalescerDefaultWindow = 3.0;
+
+@interface APXRefreshCoalescer ()
+
+@property (nonatomic, readwrite) NSTimeInterval window;
+@property (nonatomic, readwrite) BOOL isRefreshing;
+@property (nonatomic, copy) APXRefreshCoalescerRefreshBlock refreshBlock;
+@property (nonatomic, strong) NSMutableArray *waitingHandlers; // handlers of the window which is currently open
+@property (nonatomic, strong) NSMutableArray *inFlightHandlers; // handlers of the refresh which is currently running
+@property (nonatomic) BOOL isWindowOpen;
+@property (nonatomic) CFAbsoluteTime lastRefreshTime; // when the last refresh started, 0 before the first one
+
+@end
+
+@implementation APXRefreshCoalescer
+
+#pragma mark - Initialization
+
++ (instancetype)sharedCoalescer
+{
+    static APXRefreshCoalescer *sharedCoalescer = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        APXRefreshCoalescerRefreshBlock syncBlock = [self syncBlockWithClient:[APXRateLimitedClient sharedClient] inboxStore:[APXInboxStore sharedStore]];
+        sharedCoalescer = [[self alloc] initWithWindow:kAPXRefreshCoalescerDefaultWindow refreshBlock:syncBlock];
+    });
+    
+    return sharedCoalescer;
+}
+
++ (APXRefreshCoalescerRefreshBlock)syncBlockWithClient:(id<APXAppoxeeClient>)client inboxStore:(APXInboxStore *)inboxStore
+{
+    return ^(APXRefreshCoalescerFetchHandler completion) {
+        
+        [client performFetchWithCompletionHandler:nil andNotifyCompletionWithBlock:^(NSError *appoxeeError, id data) {
+            
+            UIBackgroundFetchResult result = [data isKindOfClass:[NSNumber class]] ? [(NSNumber *)data integerValue] : UIBackgroundFetchResultFailed;
+            
+            // The Inbox store is only used from the main queue.
+            dispatch_async(dispatch_get_main_queue(), ^{
+                
+                [inboxStore refreshWithCompletionHandler:^(NSError *inboxError, id inboxData) {
+                    
+                    completion(inboxError ? UIBackgroundFetchResultFailed : result);
+                }];
+            });
+        }];
+    };
+}
+
+- (instancetype)initWithWindow:(NSTimeInterval)window refreshBlock:(APXRefreshCoalescerRefreshBlock)refreshBlock
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _window = MAX(window, 0.0);
+        _refreshBlock = [refreshBlock copy];
+        _waitingHandlers = [[NSMutableArray alloc] init];
+        _inFlightHandlers = [[NSMutableArray alloc] init];
+    }
+    
+    return self;
+}
+
+#pragma mark - Coalescing
+
+- (void)requestRefreshWithFetchCompletionHandler:(APXRefreshCoalescerFetchHandler)handler
+{
+    if (![NSThread isMainThread]) {
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self requestRefreshWithFetchCompletionHandler:handler];
+        });
+        
+        return;
+    }
+    
+    APXRefreshCoalescerFetchHandler fetchHandler = handler ? [handler copy] : ^(UIBackgroundFetchResult fetchResult) {};
+    
+    if (self.isRefreshing) {
+        
+        [self.inFlightHandlers addObject:fetchHandler];
+        return;
+    }
+    
+    [self.waitingHandlers addObject:fetchHandler];
+    
+    if (self.isWindowOpen) return;
+    
+    NSTimeInterval remainingWindow = self.lastRefreshTime ? self.window - (CFAbsoluteTimeGetCurrent() - self.lastRefreshTime) : 0.0;
+    
+    // A single push is refreshed for right away, the window only opens for the pushes which follow it.
+    if (remainingWindow <= 0) {
+        
+        [self startRefresh];
+        return;
+    }
+    
+    self.isWindowOpen = YES;
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(remainingWindow * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        
+        [self startRefresh];
+    });
+}
+
+- (void)startRefresh
+{
+    self.isWindowOpen = NO;
+    self.isRefreshing = YES;
+    self.lastRefreshTime = CFAbsoluteTimeGetCurrent();
+    
+    [self.inFlightHandlers addObjectsFromArray:self.waitingHandlers];
+    [self.waitingHandlers removeAllObjects];
+    
+    __block BOOL didComplete = NO;
+    
+    self.refreshBlock(^(UIBackgroundFetchResult fetchResult) {
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            
+            if (didComplete) return;
+            
+            didComplete = YES;
+            
+            [self finishRefreshWithResult:fetchResult];
+        });
+    });
+}
+
+- (void)finishRefreshWithResult:(UIBackgroundFetchResult)fetchResult
+{
+    NSArray *handlers = [self.inFlightHandlers copy];
+    
+    [self.inFlightHandlers removeAllObjects];
+    self.isRefreshing = NO;
+    
+    for (APXRefreshCoalescerFetchHandler handler in handlers) {
+        
+        handler(fetchResult);
+    }
+}
+
+@end
@@ -0,0 +1,47 @@
+//
+//  APXRequestScheduler.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+typedef NS_ENUM(NSInteger, APXRequestLane) {
+    APXRequestLaneUserInteractive = 0, // the user is waiting on the screen, default concurrency is 4
+    APXRequestLaneDefault, // default concurrency is 2
+    APXRequestLaneBackground, // bulk work nobody is waiting for, default concurrency is 1
+    APXRequestLaneCount
+};
+
+// Performs the Appoxee call, and passes 'done' as its completion handler.
+typedef void(^APXRequestBlock)(AppoxeeCompletionHandler done);
+
+@interface APXRequestHandle : NSObject
+
+@property (nonatomic, readonly) BOOL isCancelled;
+
+// A request which hasn't started is dropped, one which has is left to finish but its completion is not called.
+- (void)cancel;
+
+@end
+
+// Hands Appoxee calls to the SDK lane by lane, so a user initiated request doesn't wait behind an Inbox refresh
+// or a backlog of custom field writes. Each lane is an operation queue with its own quality of service and concurrency limit.
+@interface APXRequestScheduler : NSObject
+
++ (instancetype)sharedScheduler;
+
+- (void)setMaximumConcurrentRequests:(NSInteger)maximumConcurrentRequests forLane:(APXRequestLane)lane;
+
+// completion is called on the main queue, unless the request was cancelled.
+- (APXRequestHandle *)scheduleRequest:(APXRequestBlock)request inLane:(APXRequestLane)lane completion:(AppoxeeCompletionHandler)completion;
+
+- (void)cancelAllRequestsInLane:(APXRequestLane)lane;
+
+// Requests waiting or running in the lane.
+- (NSUInteger)requestCountInLane:(APXRequestLane)lane;
+
+@end
@@ -0,0 +1,211 @@
+//
+//  APXRequestScheduler.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXRequestScheduler.h"
+#import "APXTransferScheduler.h"
+
+#pragma mark - Operation
+
+@interface APXRequestOperation : NSOperation
+
+@property (nonatomic, copy) APXRequestBlock request;
+@property (nonatomic, copy) AppoxeeCompletionHandler completion;
+
+@end
+
+@implementation APXRequestOperation {
+    BOOL _executing;
+    BOOL _finished;
+}
+
+- (BOOL)isAsynchronous
+{
+    return YES;
+}
+
+- (BOOL)isExecuting
+{
+    @synchronized (self) {
+        return _executing;
+    }
+}
+
+- (BOOL)isFinished
+{
+    @synchronized (self) {
+        return _finished;
+    }
+}
+
+- (void)start
+{
+    if (self.isCancelled) {
+        
+        [self finish];
+        return;
+    }
+    
+    [self willChangeValueForKey:@"isExecuting"];
+    @synchronized (self) {
+        _executing = YES;
+    }
+    [self didChangeValueForKey:@"isExecuting"];
+    
+    __weak typeof(self) weakSelf = self;
+    __block BOOL isDone = NO;
+    
+    // The radio wakes up for this request, deferred transfers can go along.
+    [[APXTransferScheduler sharedScheduler] noteNetworkActivity];
+    
+    self.request(^(NSError *appoxeeError, id data) {
+        
+        // Guards against SDK calls that answer more than once.
+        @synchronized (weakSelf) {
+            
+            if (isDone) return;
+            
+            isDone = YES;
+        }
+        
+        APXRequestOperation *operation = weakSelf;
+        AppoxeeCompletionHandler completion = operation.completion;
+        
+        if (completion && !operation.isCancelled) {
+            
+            dispatch_async(dispatch_get_main_queue(), ^{
+                
+                completion(appoxeeError, data);
+            });
+        }
+        
+        [operation finish];
+    });
+}
+
+- (void)finish
+{
+    [self willChangeValueForKey:@"isExecuting"];
+    [self willChangeValueForKey:@"isFinished"];
+    @synchronized (self) {
+        _executing = NO;
+        _finished = YES;
+    }
+    [self didChangeValueForKey:@"isFinished"];
+    [self didChangeValueForKey:@"isExecuting"];
+    
+    self.request = nil;
+    self.completion = nil;
+}
+
+@end
+
+#pragma mark - Handle
+
+@interface APXRequestHandle ()
+
+@property (nonatomic, weak) APXRequestOperation *operation;
+@property (nonatomic, readwrite) BOOL isCancelled;
+
+@end
+
+@implementation APXRequestHandle
+
+- (void)cancel
+{
+    self.isCancelled = YES;
+    [self.operation cancel];
+}
+
+@end
+
+#pragma mark - Scheduler
+
+@interface APXRequestScheduler ()
+
+@property (nonatomic, strong) NSArray *queues; // of Type NSOperationQueue, indexed by APXRequestLane
+
+@end
+
+@implementation APXRequestScheduler
+
++ (instancetype)sharedScheduler
+{
+    static APXRequestScheduler *sharedScheduler = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedScheduler = [[self alloc] init];
+    });
+    
+    return sharedScheduler;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        
+        NSArray *names = @[@"user-interactive", @"default", @"background"];
+        NSArray *qualities = @[@(NSQualityOfServiceUserInteractive), @(NSQualityOfServiceDefault), @(NSQualityOfServiceBackground)];
+        NSArray *concurrency = @[@4, @2, @1];
+        NSMutableArray *queues = [[NSMutableArray alloc] initWithCapacity:APXRequestLaneCount];
+        
+        for (NSInteger lane = 0; lane < APXRequestLaneCount; lane++) {
+            
+            NSOperationQueue *queue = [[NSOperationQueue alloc] init];
+            queue.name = [NSString stringWithFormat:@"com.appoxee.demo.requests.%@", names[lane]];
+            queue.qualityOfService = [qualities[lane] integerValue];
+            queue.maxConcurrentOperationCount = [concurrency[lane] integerValue];
+            
+            [queues addObject:queue];
+        }
+        
+        _queues = queues;
+    }
+    
+    return self;
+}
+
+- (NSOperationQueue *)queueForLane:(APXRequestLane)lane
+{
+    return (lane >= 0 && lane < APXRequestLaneCount) ? self.queues[lane] : self.queues[APXRequestLaneDefault];
+}
+
+- (void)setMaximumConcurrentRequests:(NSInteger)maximumConcurrentRequests forLane:(APXRequestLane)lane
+{
+    [self queueForLane:lane].maxConcurrentOperationCount = MAX(maximumConcurrentRequests, (NSInteger)1);
+}
+
+- (APXRequestHandle *)scheduleRequest:(APXRequestBlock)request inLane:(APXRequestLane)lane completion:(AppoxeeCompletionHandler)completion
+{
+    APXRequestHandle *handle = [[APXRequestHandle alloc] init];
+    
+    if (!request) return handle;
+    
+    APXRequestOperation *operation = [[APXRequestOperation alloc] init];
+    operation.request = request;
+    operation.completion = completion;
+    operation.queuePriority = lane == APXRequestLaneUserInteractive ? NSOperationQueuePriorityHigh : NSOperationQueuePriorityNormal;
+    
+    handle.operation = operation;
+    [[self queueForLane:lane] addOperation:operation];
+    
+    return handle;
+}
+
+- (void)cancelAllRequestsInLane:(APXRequestLane)lane
+{
+    [[self queueForLane:lane] cancelAllOperations];
+}
+
+- (NSUInteger)requestCountInLane:(APXRequestLane)lane
+{
+    return [self queueForLane:lane].operationCount;
+}
+
+@end
@@ -0,0 +1,52 @@
+//
+//  APXSharedStore.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+// Sections of the shared store.
+extern NSString * const APXSharedStoreInboxKey; // NSArray of inbox entries, see entryForMessage:, without the message links
+extern NSString * const APXSharedStoreDeviceKey; // NSDictionary, see entryForDevice:
+extern NSString * const APXSharedStoreConfigKey; // NSDictionary, the 'sdk' section of AppoxeeConfig.plist
+
+// Inbox entry keys.
+extern NSString * const APXSharedInboxEntryIDKey; // NSNumber
+extern NSString * const APXSharedInboxEntryTitleKey; // NSString
+extern NSString * const APXSharedInboxEntryContentKey; // NSString
+extern NSString * const APXSharedInboxEntryPostDateKey; // NSDate
+extern NSString * const APXSharedInboxEntryIsReadKey; // NSNumber, BOOL
+
+// A snapshot of the Inbox, the device state and the SDK configuration, in one file the app and its extensions can read at the same time.
+// Notification service and content extensions can't see the SDK's caches, with the store they read what the app last saw
+// without parsing the payload again or going to the network.
+// Writers take an exclusive flock on a lock file next to the store and replace the file with a rename. Readers don't lock at all,
+// they map either the old or the new file, never a torn one, and the parsed snapshot is reused until the file changes.
+@interface APXSharedStore : NSObject
+
+@property (nonatomic, strong, readonly) NSURL *fileURL;
+
+// A store in the App Group container named by APXAppGroupIdentifier in the Info.plist, or in Application Support if there is none.
+// The app and each extension need the App Group entitlement, and the same APXAppGroupIdentifier.
++ (instancetype)sharedStore;
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL;
+
+// The whole store, an empty dictionary if nothing was written yet.
+- (NSDictionary *)snapshot;
+
+- (id)objectForKey:(NSString *)key;
+
+// object is a property list, nil removes the section. An unchanged section is not written again.
+// Blocks while another thread or process writes, call it off the main queue.
+- (BOOL)setObject:(id)object forKey:(NSString *)key error:(NSError **)error;
+
++ (NSDictionary *)entryForMessage:(APXRichMessage *)message;
++ (NSArray *)entriesForMessages:(NSArray *)messages;
++ (NSDictionary *)entryForDevice:(APXClientDevice *)device;
+
+@end
@@ -0,0 +1,240 @@
+//
+//  APXSharedStore.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXSharedStore.h"
+#import <sys/file.h>
+#import <sys/stat.h>
+
+NSString * const APXSharedStoreInboxKey = @"inbox";
+NSString * const APXSharedStoreDeviceKey = @"device";
+NSString * const APXSharedStoreConfigKey = @"config";
+
+NSString * const APXSharedInboxEntryIDKey = @"id";
+NSString * const APXSharedInboxEntryTitleKey = @"title";
+NSString * const APXSharedInboxEntryContentKey = @"content";
+NSString * const APXSharedInboxEntryPostDateKey = @"post_date";
+NSString * const APXSharedInboxEntryIsReadKey = @"is_read";
+
+static NSString * const kAPXAppGroupIdentifierKey = @"APXAppGroupIdentifier";
+
+@interface APXSharedStore ()
+
+@property (nonatomic, strong, readwrite) NSURL *fileURL;
+@property (nonatomic, strong) NSURL *lockURL;
+@property (nonatomic, strong) NSDictionary *cachedSnapshot;
+@property (nonatomic) ino_t cachedInode;
+@property (nonatomic) off_t cachedSize;
+@property (nonatomic) struct timespec cachedModificationTime;
+
+@end
+
+@implementation APXSharedStore
+
+#pragma mark - Initialization
+
++ (instancetype)sharedStore
+{
+    static APXSharedStore *sharedStore = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        NSString *groupIdentifier = [[NSBundle mainBundle] objectForInfoDictionaryKey:kAPXAppGroupIdentifierKey];
+        NSURL *directory = [groupIdentifier length] ? [[NSFileManager defaultManager] containerURLForSecurityApplicationGroupIdentifier:groupIdentifier] : nil;
+        
+        if (!directory) {
+            
+            directory = [[[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory inDomains:NSUserDomainMask] firstObject];
+            [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+        }
+        
+        sharedStore = [[self alloc] initWithFileURL:[directory URLByAppendingPathComponent:@"APXSharedStore.plist"]];
+    });
+    
+    return sharedStore;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _fileURL = fileURL;
+        _lockURL = [[fileURL URLByDeletingPathExtension] URLByAppendingPathExtension:@"lock"];
+    }
+    
+    return self;
+}
+
+#pragma mark - Reads
+
+- (NSDictionary *)snapshot
+{
+    return [self readSnapshot];
+}
+
+- (id)objectForKey:(NSString *)key
+{
+    return key ? [self readSnapshot][key] : nil;
+}
+
+- (NSDictionary *)readSnapshot
+/*
+  A write always creates a new file, so inode, size and modification time identify the content we parsed last.
+  The file is mapped rather than read, the parser works on the page cache without a copy of the whole file.
+*/
+{
+    struct stat info;
+    
+    if (stat([self.fileURL fileSystemRepresentation], &info) != 0) return @{};
+    
+    @synchronized (self) {
+        
+        if (self.cachedSnapshot && self.cachedInode == info.st_ino && self.cachedSize == info.st_size &&
+            self.cachedModificationTime.tv_sec == info.st_mtimespec.tv_sec && self.cachedModificationTime.tv_nsec == info.st_mtimespec.tv_nsec) {
+                
+            return self.cachedSnapshot;
+        }
+    }
+    
+    NSData *data = [NSData dataWithContentsOfURL:self.fileURL options:NSDataReadingMappedAlways error:NULL];
+    id plist = data ? [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:NULL] : nil;
+    NSDictionary *snapshot = [plist isKindOfClass:[NSDictionary class]] ? plist : @{};
+    
+    @synchronized (self) {
+        
+        self.cachedSnapshot = snapshot;
+        self.cachedInode = info.st_ino;
+        self.cachedSize = info.st_size;
+        self.cachedModificationTime = info.st_mtimespec;
+    }
+    
+    return snapshot;
+}
+
+#pragma mark - Writes
+
+- (BOOL)setObject:(id)object forKey:(NSString *)key error:(NSError **)error
+{
+    if (!key) return NO;
+    
+    __block NSError *writeError = nil;
+    
+    BOOL success = [self performWithExclusiveLock:^BOOL {
+        
+        // Read again under the lock, another process may have written a different section since.
+        NSDictionary *current = [self readSnapshot];
+        
+        if (current[key] == object || [current[key] isEqual:object]) return YES;
+        
+        NSMutableDictionary *snapshot = [current mutableCopy];
+        
+        if (object) {
+            
+            snapshot[key] = object;
+            
+        } else {
+            
+            [snapshot removeObjectForKey:key];
+        }
+        
+        NSData *data = [NSPropertyListSerialization dataWithPropertyList:snapshot format:NSPropertyListBinaryFormat_v1_0 options:0 error:&writeError];
+        
+        // Extensions run while the device is locked, i.e. a notification service extension receiving a push.
+        return data && [data writeToURL:self.fileURL options:NSDataWritingAtomic | NSDataWritingFileProtectionCompleteUntilFirstUserAuthentication error:&writeError];
+        
+    } error:&writeError];
+    
+    if (!success && error) *error = writeError;
+    
+    return success;
+}
+
+- (BOOL)performWithExclusiveLock:(BOOL (^)(void))block error:(NSError **)error
+/*
+  flock locks belong to an open file description, so every call opens the lock file: two threads of the same process
+  sharing a descriptor would not exclude each other.
+*/
+{
+    int fd = open([self.lockURL fileSystemRepresentation], O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    
+    if (fd < 0) {
+        
+        if (error) *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+        return NO;
+    }
+    
+    while (flock(fd, LOCK_EX) != 0) {
+        
+        if (errno != EINTR) {
+            
+            if (error) *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+            close(fd);
+            
+            return NO;
+        }
+    }
+    
+    BOOL success = block();
+    
+    flock(fd, LOCK_UN);
+    close(fd);
+    
+    return success;
+}
+
+#pragma mark - Entries
+
++ (NSDictionary *)entryForMessage:(APXRichMessage *)message
+/*
+  The link is left out, the SDK marks a message as read when its messageLink is read.
+*/
+{
+    NSMutableDictionary *entry = [[NSMutableDictionary alloc] initWithCapacity:5];
+    
+    entry[APXSharedInboxEntryIDKey] = @(message.uniqueID);
+    entry[APXSharedInboxEntryIsReadKey] = @(message.isRead);
+    
+    if (message.title) entry[APXSharedInboxEntryTitleKey] = message.title;
+    if (message.content) entry[APXSharedInboxEntryContentKey] = message.content;
+    if (message.postDate) entry[APXSharedInboxEntryPostDateKey] = message.postDate;
+    
+    return entry;
+}
+
++ (NSArray *)entriesForMessages:(NSArray *)messages
+{
+    NSMutableArray *entries = [[NSMutableArray alloc] initWithCapacity:[messages count]];
+    
+    for (APXRichMessage *message in messages) {
+        
+        [entries addObject:[self entryForMessage:message]];
+    }
+    
+    return entries;
+}
+
++ (NSDictionary *)entryForDevice:(APXClientDevice *)device
+{
+    NSMutableDictionary *entry = [[NSMutableDictionary alloc] init];
+    
+    if (device.udid) entry[@"udid"] = device.udid;
+    if (device.pushToken) entry[@"push_token"] = device.pushToken;
+    if (device.applicationID) entry[@"application_id"] = device.applicationID;
+    if (device.sdkVersion) entry[@"sdk_version"] = device.sdkVersion;
+    if (device.locale) entry[@"locale"] = device.locale;
+    if (device.timeZone) entry[@"time_zone"] = device.timeZone;
+    if (device.osVersion) entry[@"os_version"] = device.osVersion;
+    
+    entry[@"inbox_enabled"] = @(device.isInboxEnabled);
+    entry[@"push_enabled"] = @(device.isPushEnabled);
+    
+    return entry;
+}
+
+@end
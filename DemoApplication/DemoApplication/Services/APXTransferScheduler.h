@@ -0,0 +1,44 @@
+//
+//  APXTransferScheduler.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+typedef void(^APXTransferBlock)(void);
+
+// Waking the cellular radio costs several seconds of high power, whatever the size of the transfer, and it stays awake for a while after.
+// Deferrable work (push acknowledgements, profile only re-registrations) is held here and sent in one go while the radio is awake anyway:
+// within 'activeWindow' of any other request the app or the SDK made, or as soon as the device is on Wi-Fi. Each transfer has a deadline,
+// the first one to pass sends every pending transfer along with it. All methods are thread safe.
+@interface APXTransferScheduler : NSObject
+
+@property (atomic) NSTimeInterval activeWindow; // default is 10 seconds, about the time a cellular radio stays in its high power state
+
+// Whether a request was seen within activeWindow.
+@property (nonatomic, readonly) BOOL isRadioActive;
+
+// Updated by reachability monitoring, always NO without it.
+@property (atomic, readonly) BOOL isOnWiFi;
+
+@property (nonatomic, readonly) NSUInteger pendingTransferCount;
+
+// Monitors reachability, and is told of the requests of APXRequestScheduler and APXRateLimitedClient.
++ (instancetype)sharedScheduler;
+
+// Without reachability monitoring, transfers only run along with a request or by their deadline.
+- (instancetype)init;
+
+- (instancetype)initMonitoringReachability:(BOOL)monitorsReachability;
+
+// Call it whenever a request is being sent, pending transfers go out along with it.
+- (void)noteNetworkActivity;
+
+// block runs on a background queue, right away if the radio is awake, otherwise once it is, but no later than maximumDelay seconds from now.
+// A transfer scheduled again under the same identifier before it ran replaces the block, and keeps the earlier deadline.
+- (void)scheduleTransferWithIdentifier:(NSString *)identifier maximumDelay:(NSTimeInterval)maximumDelay block:(APXTransferBlock)block;
+
+@end
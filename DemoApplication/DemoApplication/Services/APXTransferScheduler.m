@@ -0,0 +1,278 @@
+//
+//  APXTransferScheduler.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXTransferScheduler.h"
+#import <SystemConfiguration/SystemConfiguration.h>
+#import <netinet/in.h>
+#import "APXLogger.h"
+#import "APXMetrics.h"
+
+// A pending transfer.
+@interface APXTransfer : NSObject
+
+@property (nonatomic, copy) APXTransferBlock block;
+@property (nonatomic) uint64_t deadline; // APXMetricsNow()
+
+@end
+
+@implementation APXTransfer
+
+@end
+
+@interface APXTransferScheduler ()
+
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) NSMutableDictionary *transfers; // identifier -> APXTransfer, only touched on 'queue'
+@property (nonatomic, strong) dispatch_source_t deadlineTimer;
+@property (nonatomic) uint64_t timerDeadline; // the deadline deadlineTimer is armed for, 0 if it isn't
+@property (atomic) uint64_t lastActivity; // APXMetricsNow(), 0 if there was none
+@property (atomic, readwrite) BOOL isOnWiFi;
+@property (nonatomic) SCNetworkReachabilityRef reachability;
+@property (nonatomic, strong) APXCounter *piggybackedCounter;
+@property (nonatomic, strong) APXCounter *deadlineCounter;
+
+- (void)reachabilityDidChangeWithFlags:(SCNetworkReachabilityFlags)flags;
+
+@end
+
+static void APXTransferSchedulerReachabilityCallback(SCNetworkReachabilityRef target, SCNetworkReachabilityFlags flags, void *info)
+{
+    [(__bridge APXTransferScheduler *)info reachabilityDidChangeWithFlags:flags];
+}
+
+@implementation APXTransferScheduler
+
+#pragma mark - Initialization
+
++ (instancetype)sharedScheduler
+{
+    static APXTransferScheduler *sharedScheduler = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedScheduler = [[self alloc] initMonitoringReachability:YES];
+    });
+    
+    return sharedScheduler;
+}
+
+- (instancetype)init
+{
+    return [self initMonitoringReachability:NO];
+}
+
+- (instancetype)initMonitoringReachability:(BOOL)monitorsReachability
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _activeWindow = 10.0;
+        _queue = dispatch_queue_create("com.appoxee.demo.transfer-scheduler", DISPATCH_QUEUE_SERIAL);
+        _transfers = [[NSMutableDictionary alloc] init];
+        _deadlineTimer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _queue);
+        _piggybackedCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricTransfersPiggybacked];
+        _deadlineCounter = [[APXMetrics sharedMetrics] counterNamed:APXMetricTransfersDeadlineWakeups];
+        
+        __weak typeof(self) weakSelf = self;
+        
+        dispatch_source_set_event_handler(_deadlineTimer, ^{
+            
+            [weakSelf deadlineTimerDidFire];
+        });
+        
+        dispatch_resume(_deadlineTimer);
+        
+        if (monitorsReachability) [self startMonitoringReachability];
+    }
+    
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_reachability) {
+        
+        SCNetworkReachabilitySetDispatchQueue(_reachability, NULL);
+        SCNetworkReachabilitySetCallback(_reachability, NULL, NULL);
+        CFRelease(_reachability);
+    }
+    
+    dispatch_source_cancel(_deadlineTimer);
+}
+
+#pragma mark - Radio State
+
+- (BOOL)isRadioActive
+{
+    uint64_t lastActivity = self.lastActivity;
+    
+    return lastActivity && (double)(APXMetricsNow() - lastActivity) / NSEC_PER_SEC < self.activeWindow;
+}
+
+- (NSUInteger)pendingTransferCount
+{
+    __block NSUInteger count = 0;
+    
+    dispatch_sync(self.queue, ^{
+        
+        count = [self.transfers count];
+    });
+    
+    return count;
+}
+
+- (void)noteNetworkActivity
+{
+    self.lastActivity = APXMetricsNow();
+    
+    dispatch_async(self.queue, ^{
+        
+        if ([self.transfers count]) [self.piggybackedCounter add:(int64_t)[self.transfers count]];
+        
+        [self runTransfers];
+    });
+}
+
+- (void)startMonitoringReachability
+/*
+  Reachability of the internet at large rather than of an Appoxee host, it's only used to tell Wi-Fi from cellular.
+*/
+{
+    struct sockaddr_in address;
+    bzero(&address, sizeof(address));
+    address.sin_len = sizeof(address);
+    address.sin_family = AF_INET;
+    
+    self.reachability = SCNetworkReachabilityCreateWithAddress(kCFAllocatorDefault, (const struct sockaddr *)&address);
+    
+    if (!self.reachability) return;
+    
+    SCNetworkReachabilityContext context = {0, (__bridge void *)self, NULL, NULL, NULL};
+    
+    SCNetworkReachabilitySetCallback(self.reachability, APXTransferSchedulerReachabilityCallback, &context);
+    SCNetworkReachabilitySetDispatchQueue(self.reachability, self.queue);
+    
+    dispatch_async(self.queue, ^{
+        
+        SCNetworkReachabilityFlags flags = 0;
+        
+        if (SCNetworkReachabilityGetFlags(self.reachability, &flags)) [self reachabilityDidChangeWithFlags:flags];
+    });
+}
+
+- (void)reachabilityDidChangeWithFlags:(SCNetworkReachabilityFlags)flags
+{
+    BOOL isReachable = (flags & kSCNetworkReachabilityFlagsReachable) && !(flags & kSCNetworkReachabilityFlagsConnectionRequired);
+    BOOL isOnWiFi = isReachable && !(flags & kSCNetworkReachabilityFlagsIsWWAN);
+    
+    if (isOnWiFi == self.isOnWiFi) return;
+    
+    self.isOnWiFi = isOnWiFi;
+    
+    APXLogDebug(APXLogSubsystemNetwork, @"%@ Wi-Fi", isOnWiFi ? @"On" : @"Off");
+    
+    if (isOnWiFi) [self runTransfers];
+}
+
+#pragma mark - Transfers
+
+- (void)scheduleTransferWithIdentifier:(NSString *)identifier maximumDelay:(NSTimeInterval)maximumDelay block:(APXTransferBlock)block
+{
+    if (!identifier || !block) return;
+    
+    uint64_t deadline = APXMetricsNow() + (uint64_t)(MAX(maximumDelay, 0.0) * NSEC_PER_SEC);
+    
+    dispatch_async(self.queue, ^{
+        
+        APXTransfer *transfer = self.transfers[identifier];
+        
+        if (!transfer) {
+            
+            transfer = [[APXTransfer alloc] init];
+            transfer.deadline = deadline;
+            self.transfers[identifier] = transfer;
+        }
+        
+        transfer.block = block;
+        transfer.deadline = MIN(transfer.deadline, deadline);
+        
+        if (self.isRadioActive || self.isOnWiFi) {
+            
+            [self.piggybackedCounter add:(int64_t)[self.transfers count]];
+            [self runTransfers];
+            return;
+        }
+        
+        [self armDeadlineTimer];
+    });
+}
+
+- (void)armDeadlineTimer
+/*
+  Called on 'queue'. One timer for the earliest deadline, there is no point in waking up for the later ones.
+*/
+{
+    uint64_t earliestDeadline = UINT64_MAX;
+    
+    for (APXTransfer *transfer in [self.transfers allValues]) {
+        
+        earliestDeadline = MIN(earliestDeadline, transfer.deadline);
+    }
+    
+    if (earliestDeadline == UINT64_MAX) {
+        
+        dispatch_source_set_timer(self.deadlineTimer, DISPATCH_TIME_FOREVER, DISPATCH_TIME_FOREVER, 0);
+        self.timerDeadline = 0;
+        return;
+    }
+    
+    if (earliestDeadline == self.timerDeadline) return;
+    
+    uint64_t now = APXMetricsNow();
+    int64_t delay = earliestDeadline > now ? (int64_t)(earliestDeadline - now) : 0;
+    
+    // The last tenth of the delay is leeway, the system may fire the timer along with other wakeups but never after the deadline.
+    dispatch_source_set_timer(self.deadlineTimer, dispatch_time(DISPATCH_TIME_NOW, delay - delay / 10), DISPATCH_TIME_FOREVER, (uint64_t)(delay / 10));
+    self.timerDeadline = earliestDeadline;
+}
+
+- (void)deadlineTimerDidFire
+{
+    self.timerDeadline = 0;
+    
+    if (![self.transfers count]) return;
+    
+    [self.deadlineCounter increment];
+    APXLogDebug(APXLogSubsystemNetwork, @"Transfer deadline reached, sending %lu pending transfers", (unsigned long)[self.transfers count]);
+    
+    // Whatever is pending goes along, the radio is woken up for the first one anyway.
+    self.lastActivity = APXMetricsNow();
+    [self runTransfers];
+}
+
+- (void)runTransfers
+/*
+  Called on 'queue'.
+*/
+{
+    if (![self.transfers count]) return;
+    
+    NSArray *transfers = [self.transfers allValues];
+    [self.transfers removeAllObjects];
+    [self armDeadlineTimer];
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        
+        for (APXTransfer *transfer in transfers) {
+            
+            transfer.block();
+        }
+    });
+}
+
+@end
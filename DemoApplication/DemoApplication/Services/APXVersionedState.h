@@ -0,0 +1,59 @@
+//
+//  APXVersionedState.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// A local copy of device state which is written to Appoxee, so the app can read its own writes without a round trip.
+// Every local write is applied right away and stamped with a new version. Server answers are reconciled by that version:
+// a read which was issued before a newer local write is dropped, and a failed write only rolls back if nothing was written after it.
+// Values are property list objects, [NSNull null] marks a value known to be unset.
+//
+// Threading: all methods are thread safe. Reads never wait, they look at an immutable snapshot which writes replace with an atomic
+// pointer swap, so a read on the main queue doesn't queue behind writes or network completions. Writes are serialized on a queue
+// of their own, and a read which starts after a write returned sees it. Every read sees a whole write, never part of one.
+@interface APXVersionedState : NSObject
+
+// Confirmed values older than this read as unknown, so the next read goes to the server and picks up changes made elsewhere,
+// i.e. by the dashboard or another device. 0 keeps them until they are invalidated. The default is one day.
+@property (atomic) NSTimeInterval maximumAge;
+
+// fileURL keeps the values confirmed by the server across launches, nil keeps the state in memory.
+- (instancetype)initWithFileURL:(NSURL *)fileURL;
+
+// nil if the value is unknown, and has to be read from the server.
+- (id)objectForKey:(NSString *)key;
+
+// The known values of keys, unknown keys are left out.
+- (NSDictionary *)objectsForKeys:(NSArray *)keys;
+
+// Every known value, without the ones known to be unset.
+- (NSDictionary *)dictionaryRepresentation;
+
+// Take it before issuing a server read, and hand it back to applyServerValues:readVersions:.
+- (uint64_t)versionForKey:(NSString *)key;
+- (NSDictionary *)versionsForKeys:(NSArray *)keys; // key -> NSNumber
+
+// Optimistically applies all values in one step, and returns the version the write is stamped with.
+- (uint64_t)applyLocalValues:(NSDictionary *)values;
+
+// The server accepted the write stamped with version. value becomes what a later failure rolls back to.
+- (void)confirmValue:(id)value forKey:(NSString *)key version:(uint64_t)version;
+
+// The server rejected the write stamped with version. Returns YES if the key was rolled back to its last confirmed value,
+// which is saved again, NO if a newer write superseded it.
+- (BOOL)rejectValueForKey:(NSString *)key version:(uint64_t)version;
+
+// Applies the values of a server read, skipping every key which was written locally since its version was taken.
+// Returns the keys which were applied.
+- (NSArray *)applyServerValues:(NSDictionary *)values readVersions:(NSDictionary *)versions;
+
+// Forgets the values, so the next read goes to the server. In flight reads of the keys are dropped.
+- (void)invalidateValuesForKeys:(NSArray *)keys;
+- (void)invalidateAllValues;
+
+@end
@@ -0,0 +1,399 @@
+//
+//  APXVersionedState.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXVersionedState.h"
+
+static NSTimeInterval const kAPXVersionedStateDefaultMaximumAge = 24.0 * 60.0 * 60.0;
+
+static NSString * const kAPXVersionedStateValuesKey = @"values";
+static NSString * const kAPXVersionedStateConfirmationTimesKey = @"confirmed_at"; // key -> NSNumber, CFAbsoluteTime
+
+@interface APXVersionedEntry : NSObject
+
+@property (nonatomic, strong) id value; // what readers see, nil if unknown
+@property (nonatomic) uint64_t version; // of the last local write or invalidation
+@property (nonatomic, strong) id confirmedValue; // what the server is known to hold, nil if unknown
+@property (nonatomic) uint64_t confirmedVersion;
+@property (nonatomic) CFAbsoluteTime confirmedTime; // when the server last showed or accepted confirmedValue, 0 if never
+@property (nonatomic, readonly, getter = isPending) BOOL pending; // a local write is waiting for the server
+
+@end
+
+@implementation APXVersionedEntry
+
+- (BOOL)isPending
+{
+    return self.version > self.confirmedVersion;
+}
+
+@end
+
+// What readers see, an immutable copy of every entry which is replaced as a whole after each change.
+@interface APXVersionedSnapshot : NSObject
+
+@property (nonatomic, copy, readonly) NSDictionary *values; // key -> value, unknown keys are left out
+@property (nonatomic, copy, readonly) NSDictionary *versions; // key -> NSNumber
+@property (nonatomic, copy, readonly) NSDictionary *confirmationTimes; // key -> NSNumber, only keys whose value is the confirmed one
+
+- (instancetype)initWithValues:(NSDictionary *)values versions:(NSDictionary *)versions confirmationTimes:(NSDictionary *)confirmationTimes;
+
+@end
+
+@implementation APXVersionedSnapshot
+
+- (instancetype)initWithValues:(NSDictionary *)values versions:(NSDictionary *)versions confirmationTimes:(NSDictionary *)confirmationTimes
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _values = [values copy];
+        _versions = [versions copy];
+        _confirmationTimes = [confirmationTimes copy];
+    }
+    
+    return self;
+}
+
+@end
+
+@interface APXVersionedState ()
+
+@property (nonatomic, strong) NSURL *fileURL;
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) dispatch_queue_t ioQueue;
+@property (nonatomic, strong) NSMutableDictionary *entries; // key -> APXVersionedEntry, only touched on 'queue'
+@property (atomic, strong) APXVersionedSnapshot *snapshot; // published on 'queue', read from any thread without taking it
+@property (nonatomic) uint64_t lastVersion;
+
+@end
+
+@implementation APXVersionedState
+
+#pragma mark - Initialization
+
+- (instancetype)init
+{
+    return [self initWithFileURL:nil];
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _fileURL = fileURL;
+        _queue = dispatch_queue_create("com.appoxee.demo.versioned-state", DISPATCH_QUEUE_SERIAL);
+        _ioQueue = dispatch_queue_create("com.appoxee.demo.versioned-state.io", DISPATCH_QUEUE_SERIAL);
+        _entries = [[NSMutableDictionary alloc] init];
+        _maximumAge = kAPXVersionedStateDefaultMaximumAge;
+        
+        [self load];
+        [self publish];
+    }
+    
+    return self;
+}
+
+#pragma mark - Reads
+
+- (id)objectForKey:(NSString *)key
+{
+    return [self objectsForKeys:key ? @[key] : @[]][key];
+}
+
+- (NSDictionary *)objectsForKeys:(NSArray *)keys
+{
+    APXVersionedSnapshot *snapshot = self.snapshot;
+    NSMutableDictionary *values = [[NSMutableDictionary alloc] initWithCapacity:[keys count]];
+    
+    for (NSString *key in keys) {
+        
+        id value = snapshot.values[key];
+        
+        if (value && ![self isKey:key expiredInSnapshot:snapshot]) values[key] = value;
+    }
+    
+    return values;
+}
+
+- (NSDictionary *)dictionaryRepresentation
+{
+    APXVersionedSnapshot *snapshot = self.snapshot;
+    NSMutableDictionary *values = [[NSMutableDictionary alloc] initWithCapacity:[snapshot.values count]];
+    
+    [snapshot.values enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+        
+        if (value != [NSNull null] && ![self isKey:key expiredInSnapshot:snapshot]) values[key] = value;
+    }];
+    
+    return values;
+}
+
+- (BOOL)isKey:(NSString *)key expiredInSnapshot:(APXVersionedSnapshot *)snapshot
+/*
+  Only confirmed values expire. A local write which is still waiting for the server is what the app last wrote, it stays.
+*/
+{
+    NSNumber *confirmationTime = snapshot.confirmationTimes[key];
+    NSTimeInterval maximumAge = self.maximumAge;
+    
+    return confirmationTime && maximumAge > 0.0 && CFAbsoluteTimeGetCurrent() - [confirmationTime doubleValue] > maximumAge;
+}
+
+- (uint64_t)versionForKey:(NSString *)key
+{
+    return key ? [self.snapshot.versions[key] unsignedLongLongValue] : 0;
+}
+
+- (NSDictionary *)versionsForKeys:(NSArray *)keys
+{
+    NSDictionary *snapshotVersions = self.snapshot.versions;
+    NSMutableDictionary *versions = [[NSMutableDictionary alloc] initWithCapacity:[keys count]];
+    
+    for (NSString *key in keys) {
+        
+        versions[key] = snapshotVersions[key] ?: @0;
+    }
+    
+    return versions;
+}
+
+#pragma mark - Local Writes
+
+- (uint64_t)applyLocalValues:(NSDictionary *)values
+{
+    __block uint64_t version = 0;
+    
+    dispatch_sync(self.queue, ^{
+        
+        version = ++self.lastVersion;
+        
+        [values enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+            
+            APXVersionedEntry *entry = [self entryForKey:key];
+            entry.value = value;
+            entry.version = version;
+        }];
+        
+        [self publish];
+    });
+    
+    return version;
+}
+
+- (void)confirmValue:(id)value forKey:(NSString *)key version:(uint64_t)version
+/*
+  Writes can be confirmed out of order, an older confirmation never replaces the rollback value of a newer one.
+*/
+{
+    if (!key) return;
+    
+    dispatch_sync(self.queue, ^{
+        
+        APXVersionedEntry *entry = self.entries[key];
+        
+        if (!entry || version < entry.confirmedVersion) return;
+        
+        entry.confirmedValue = value ?: [NSNull null];
+        entry.confirmedVersion = version;
+        entry.confirmedTime = CFAbsoluteTimeGetCurrent();
+        
+        [self publish];
+        [self save];
+    });
+}
+
+- (BOOL)rejectValueForKey:(NSString *)key version:(uint64_t)version
+{
+    if (!key) return NO;
+    
+    __block BOOL rolledBack = NO;
+    
+    dispatch_sync(self.queue, ^{
+        
+        APXVersionedEntry *entry = self.entries[key];
+        
+        if (entry.version == version) {
+            
+            // Unknown if nothing was ever confirmed, the next read goes to the server.
+            entry.value = entry.confirmedValue;
+            entry.confirmedVersion = version;
+            rolledBack = YES;
+            
+            [self publish];
+            [self save];
+        }
+    });
+    
+    return rolledBack;
+}
+
+#pragma mark - Server Reads
+
+- (NSArray *)applyServerValues:(NSDictionary *)values readVersions:(NSDictionary *)versions
+/*
+  Keys of 'versions' without a value in 'values' were read and found unset.
+  A key with a pending write is skipped as well, the server may have answered before the write reached it.
+*/
+{
+    NSMutableArray *appliedKeys = [[NSMutableArray alloc] initWithCapacity:[versions count]];
+    
+    dispatch_sync(self.queue, ^{
+        
+        [versions enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *version, BOOL *stop) {
+            
+            APXVersionedEntry *entry = self.entries[key];
+            
+            if (entry.version != [version unsignedLongLongValue] || entry.isPending) return;
+            
+            entry = [self entryForKey:key];
+            entry.value = values[key] ?: [NSNull null];
+            entry.confirmedValue = entry.value;
+            entry.confirmedTime = CFAbsoluteTimeGetCurrent();
+            
+            [appliedKeys addObject:key];
+        }];
+        
+        if ([appliedKeys count]) {
+            
+            [self publish];
+            [self save];
+        }
+    });
+    
+    return appliedKeys;
+}
+
+#pragma mark - Invalidation
+
+- (void)invalidateValuesForKeys:(NSArray *)keys
+{
+    dispatch_sync(self.queue, ^{
+        
+        [self invalidateKeys:keys];
+    });
+}
+
+- (void)invalidateAllValues
+{
+    dispatch_sync(self.queue, ^{
+        
+        [self invalidateKeys:[self.entries allKeys]];
+    });
+}
+
+- (void)invalidateKeys:(NSArray *)keys
+/*
+  Called on 'queue'. Entries are kept with a new version rather than removed, that is what drops reads already in flight.
+*/
+{
+    uint64_t version = ++self.lastVersion;
+    
+    for (NSString *key in keys) {
+        
+        APXVersionedEntry *entry = [self entryForKey:key];
+        entry.value = nil;
+        entry.confirmedValue = nil;
+        entry.version = version;
+        entry.confirmedVersion = version;
+        entry.confirmedTime = 0.0;
+    }
+    
+    [self publish];
+    [self save];
+}
+
+#pragma mark - Storage
+
+- (APXVersionedEntry *)entryForKey:(NSString *)key
+{
+    APXVersionedEntry *entry = self.entries[key];
+    
+    if (!entry) {
+        
+        entry = [[APXVersionedEntry alloc] init];
+        self.entries[key] = entry;
+    }
+    
+    return entry;
+}
+
+- (void)load
+/*
+  A file of the earlier format holds the values alone. Without a confirmation time they count as expired, and are read again.
+*/
+{
+    if (!self.fileURL) return;
+    
+    NSDictionary *contents = [NSDictionary dictionaryWithContentsOfURL:self.fileURL];
+    BOOL hasTimes = [contents[kAPXVersionedStateValuesKey] isKindOfClass:[NSDictionary class]];
+    NSDictionary *values = hasTimes ? contents[kAPXVersionedStateValuesKey] : contents;
+    NSDictionary *times = hasTimes && [contents[kAPXVersionedStateConfirmationTimesKey] isKindOfClass:[NSDictionary class]] ? contents[kAPXVersionedStateConfirmationTimesKey] : nil;
+    
+    [values enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        
+        if (![key isKindOfClass:[NSString class]]) return;
+        
+        APXVersionedEntry *entry = [self entryForKey:key];
+        entry.value = value;
+        entry.confirmedValue = value;
+        entry.confirmedTime = [times[key] isKindOfClass:[NSNumber class]] ? [times[key] doubleValue] : 0.0;
+    }];
+}
+
+- (void)publish
+/*
+  Called on 'queue', after every change readers can see. Readers holding the previous snapshot keep a consistent view of it,
+  a write of several keys is never seen half applied.
+*/
+{
+    NSMutableDictionary *values = [[NSMutableDictionary alloc] initWithCapacity:[self.entries count]];
+    NSMutableDictionary *versions = [[NSMutableDictionary alloc] initWithCapacity:[self.entries count]];
+    NSMutableDictionary *confirmationTimes = [[NSMutableDictionary alloc] initWithCapacity:[self.entries count]];
+    
+    [self.entries enumerateKeysAndObjectsUsingBlock:^(NSString *key, APXVersionedEntry *entry, BOOL *stop) {
+        
+        if (entry.value) values[key] = entry.value;
+        versions[key] = @(entry.version);
+        
+        if (entry.value && !entry.isPending) confirmationTimes[key] = @(entry.confirmedTime);
+    }];
+    
+    self.snapshot = [[APXVersionedSnapshot alloc] initWithValues:values versions:versions confirmationTimes:confirmationTimes];
+}
+
+- (void)save
+/*
+  Called on 'queue'. Keys with a pending write are left out, if the app is killed before the server answers they are simply read again.
+*/
+{
+    if (!self.fileURL) return;
+    
+    NSMutableDictionary *values = [[NSMutableDictionary alloc] initWithCapacity:[self.entries count]];
+    NSMutableDictionary *times = [[NSMutableDictionary alloc] initWithCapacity:[self.entries count]];
+    
+    [self.entries enumerateKeysAndObjectsUsingBlock:^(NSString *key, APXVersionedEntry *entry, BOOL *stop) {
+        
+        if (!entry.isPending && entry.confirmedValue && entry.confirmedValue != [NSNull null]) {
+            
+            values[key] = entry.confirmedValue;
+            times[key] = @(entry.confirmedTime);
+        }
+    }];
+    
+    NSDictionary *contents = @{kAPXVersionedStateValuesKey : values, kAPXVersionedStateConfirmationTimesKey : times};
+    NSURL *fileURL = self.fileURL;
+    
+    dispatch_async(self.ioQueue, ^{
+        [contents writeToURL:fileURL atomically:YES];
+    });
+}
+
+@end
@@ -0,0 +1,62 @@
+//
+//  APXWebViewPool.h
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXContentPrefetcher.h"
+
+// The token of the shell template which is replaced by the message HTML.
+extern NSString * const APXWebViewPoolContentPlaceholder;
+
+typedef void(^APXWebViewLoadCompletion)(UIWebView *webView, NSError *error);
+
+// Displays rich messages in a few web views which are created, and have the shell template loaded, ahead of time.
+// HTML passed to webViewForHTML: is injected into the already loaded shell instead of loading a new page, and the messages next to
+// the one on screen can be prepared in idle web views, so moving to them only swaps a web view which has finished loading.
+// Must be used from the main queue.
+@interface APXWebViewPool : NSObject
+
+@property (nonatomic, readonly) NSUInteger capacity;
+@property (nonatomic, copy, readonly) NSString *shellTemplate;
+
+// When set, links it has stored are displayed from disk, with the link as the base URL of their relative resources.
+@property (nonatomic, strong) APXContentPrefetcher *contentPrefetcher;
+
+// Three web views, the message on screen and the ones above and below it, displaying what [APXContentPrefetcher sharedPrefetcher] stored.
++ (instancetype)sharedPool;
+
+// shellTemplate must contain APXWebViewPoolContentPlaceholder inside an element with the id 'apx-content'. nil uses a plain template.
+- (instancetype)initWithCapacity:(NSUInteger)capacity shellTemplate:(NSString *)shellTemplate;
+
+// Creates the idle web views and loads the shell into them. Idle web views are released on a memory warning, and created again by the next call.
+- (void)prewarm;
+
+// The shell template with content in place of the placeholder.
+- (NSString *)HTMLForContent:(NSString *)content;
+
+// A web view displaying the message's link, or its content when it has no link, loaded as a page so its scripts run. Reading the
+// link marks the message as read. One prepared for the message is returned as is, unless the message has a link.
+// delegate receives the web view's UIWebViewDelegate calls until it's recycled. handler is called once the message has loaded,
+// on the main queue, and never after the web view was recycled.
+- (UIWebView *)webViewForMessage:(APXRichMessage *)message delegate:(id<UIWebViewDelegate>)delegate completionHandler:(APXWebViewLoadCompletion)handler;
+
+// Scripts in injected content don't run, content which needs them should be shown through its URL.
+- (UIWebView *)webViewForHTML:(NSString *)html delegate:(id<UIWebViewDelegate>)delegate completionHandler:(APXWebViewLoadCompletion)handler;
+- (UIWebView *)webViewForURL:(NSURL *)URL delegate:(id<UIWebViewDelegate>)delegate completionHandler:(APXWebViewLoadCompletion)handler;
+
+// Loads the content of messages into idle web views, in order, as long as there are any. Prepared messages which aren't listed
+// may be replaced. Their links aren't read, so they stay unread, and a message with a link is loaded once it's opened.
+- (void)prepareMessages:(NSArray *)messages;
+
+// Removes the web view from its superview and returns it to the pool. The message it displayed stays loaded, as if it was prepared.
+- (void)recycleWebView:(UIWebView *)webView;
+
+// Adds webView to placeholder's superview, pinned to its edges, and hides placeholder, which is usually the storyboard's web view.
++ (void)installWebView:(UIWebView *)webView inPlaceOfView:(UIView *)placeholder;
+
+@end
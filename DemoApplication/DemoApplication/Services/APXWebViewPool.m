@@ -0,0 +1,490 @@
+//
+//  APXWebViewPool.m
+//  DemoApplication
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXWebViewPool.h"
+
+NSString * const APXWebViewPoolContentPlaceholder = @"{{content}}";
+
+static NSUInteger const kAPXWebViewPoolDefaultCapacity = 3;
+
+static NSString * const kAPXWebViewPoolDefaultShellTemplate =
+    @"<!DOCTYPE html><html><head>"
+    @"<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
+    @"<style>body { margin: 16px; font: -apple-system-body; word-wrap: break-word; } img, video { max-width: 100%; height: auto; }</style>"
+    @"</head><body><div id=\"apx-content\">{{content}}</div></body></html>";
+
+@interface APXWebViewPoolEntry : NSObject
+
+@property (nonatomic, strong) UIWebView *webView;
+@property (nonatomic, strong) NSNumber *messageID; // the message the web view displays, or was prepared with
+@property (nonatomic, strong) id content; // the NSURL or HTML the web view was loaded with
+@property (nonatomic, weak) id<UIWebViewDelegate> delegate;
+@property (nonatomic, strong) NSMutableArray *completions; // of Type APXWebViewLoadCompletion
+@property (nonatomic) NSUInteger generation; // changes whenever the web view is handed out or recycled
+@property (nonatomic) BOOL isInUse;
+@property (nonatomic) BOOL isLoadingShell;
+@property (nonatomic) BOOL isShellLoaded; // HTML can be injected without loading a page
+@property (nonatomic) BOOL isLoaded;
+@property (nonatomic, strong) NSError *loadError;
+
+@end
+
+@implementation APXWebViewPoolEntry
+
+@end
+
+@interface APXWebViewPool () <UIWebViewDelegate>
+
+@property (nonatomic, readwrite) NSUInteger capacity;
+@property (nonatomic, copy, readwrite) NSString *shellTemplate;
+@property (nonatomic, copy) NSString *shellPrefix;
+@property (nonatomic, copy) NSString *shellSuffix;
+@property (nonatomic, strong) NSMutableArray *entries; // of Type APXWebViewPoolEntry, least recently used first
+
+@end
+
+@implementation APXWebViewPool
+
+#pragma mark - Initialization
+
++ (instancetype)sharedPool
+{
+    static APXWebViewPool *sharedPool = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        sharedPool = [[self alloc] initWithCapacity:kAPXWebViewPoolDefaultCapacity shellTemplate:nil];
+        sharedPool.contentPrefetcher = [APXContentPrefetcher sharedPrefetcher];
+    });
+    
+    return sharedPool;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity shellTemplate:(NSString *)shellTemplate
+{
+    self = [super init];
+    
+    if (self) {
+        
+        _capacity = MAX(capacity, 1);
+        _shellTemplate = [shellTemplate length] ? [shellTemplate copy] : kAPXWebViewPoolDefaultShellTemplate;
+        _entries = [[NSMutableArray alloc] init];
+        
+        // Split once, so rendering only concatenates.
+        NSRange range = [_shellTemplate rangeOfString:APXWebViewPoolContentPlaceholder];
+        
+        if (range.location == NSNotFound) {
+            
+            _shellPrefix = _shellTemplate;
+            _shellSuffix = @"";
+            
+        } else {
+            
+            _shellPrefix = [_shellTemplate substringToIndex:range.location];
+            _shellSuffix = [_shellTemplate substringFromIndex:NSMaxRange(range)];
+        }
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(didReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+    
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    
+    // UIWebView doesn't retain its delegate.
+    for (APXWebViewPoolEntry *entry in self.entries) {
+        
+        entry.webView.delegate = nil;
+    }
+}
+
+- (void)prewarm
+{
+    while ([self.entries count] < self.capacity) {
+        
+        [self loadContent:@"" ofEntry:[self addEntry] injectable:YES];
+    }
+}
+
+#pragma mark - Rendering
+
+- (NSString *)HTMLForContent:(NSString *)content
+{
+    NSMutableString *html = [[NSMutableString alloc] initWithCapacity:[self.shellPrefix length] + [content length] + [self.shellSuffix length]];
+    
+    [html appendString:self.shellPrefix];
+    [html appendString:content ?: @""];
+    [html appendString:self.shellSuffix];
+    
+    return html;
+}
+
+- (id)contentForMessage:(APXRichMessage *)message
+/*
+  Only called when the message is opened, the SDK marks a message as read when its messageLink is read.
+*/
+{
+    NSURL *URL = [message.messageLink length] ? [NSURL URLWithString:message.messageLink] : nil;
+    
+    if ([URL scheme]) return URL;
+    
+    return message.content ?: @"";
+}
+
+- (void)loadContent:(id)content ofEntry:(APXWebViewPoolEntry *)entry injectable:(BOOL)injectable
+/*
+  content is either an NSURL, which is loaded as a page, from the prefetcher's copy when it has one, or an HTML string.
+  Injectable HTML goes into the shell which is already loaded when possible, replacing the content of a div takes a few milliseconds where loading a page takes hundreds.
+  Scripts set with innerHTML don't run though, a message's content is always loaded as a page, which then isn't used as a shell.
+*/
+{
+    entry.content = content;
+    entry.isLoaded = NO;
+    entry.loadError = nil;
+    
+    if ([content isKindOfClass:[NSURL class]]) {
+        
+        entry.isLoadingShell = NO;
+        entry.isShellLoaded = NO;
+        
+        NSURL *cachedURL = [content isFileURL] ? nil : [self.contentPrefetcher cachedContentURLForURL:content];
+        NSData *cachedPage = cachedURL ? [NSData dataWithContentsOfURL:cachedURL options:NSDataReadingMappedIfSafe error:nil] : nil;
+        
+        if (cachedPage) {
+            
+            [entry.webView loadData:cachedPage MIMEType:@"text/html" textEncodingName:@"utf-8" baseURL:content];
+            return;
+        }
+        
+        [entry.webView loadRequest:[NSURLRequest requestWithURL:content]];
+        return;
+    }
+    
+    if (injectable && entry.isShellLoaded && !entry.webView.isLoading && [self injectHTML:content intoWebView:entry.webView]) {
+        
+        entry.isLoaded = YES;
+        return;
+    }
+    
+    entry.isLoadingShell = injectable;
+    entry.isShellLoaded = NO;
+    [entry.webView loadHTMLString:[self HTMLForContent:content] baseURL:nil];
+}
+
+- (BOOL)injectHTML:(NSString *)html intoWebView:(UIWebView *)webView
+{
+    NSData *data = [NSJSONSerialization dataWithJSONObject:@[html] options:0 error:NULL];
+    NSString *array = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    
+    // JSON allows the line and paragraph separators in strings, JavaScript doesn't.
+    array = [array stringByReplacingOccurrencesOfString:[NSString stringWithFormat:@"%C", (unichar)0x2028] withString:@"\\u2028"];
+    array = [array stringByReplacingOccurrencesOfString:[NSString stringWithFormat:@"%C", (unichar)0x2029] withString:@"\\u2029"];
+    
+    NSString *script = [NSString stringWithFormat:@"(function (html) { var element = document.getElementById('apx-content'); if (!element) return ''; element.innerHTML = html; window.scrollTo(0, 0); return 'ok'; })(%@[0])", array];
+    
+    return [[webView stringByEvaluatingJavaScriptFromString:script] isEqualToString:@"ok"];
+}
+
+#pragma mark - Web Views
+
+- (UIWebView *)webViewForMessage:(APXRichMessage *)message delegate:(id<UIWebViewDelegate>)delegate completionHandler:(APXWebViewLoadCompletion)handler
+{
+    NSNumber *messageID = @(message.uniqueID);
+    id content = [self contentForMessage:message];
+    APXWebViewPoolEntry *entry = [self idleEntryForMessageID:messageID];
+    
+    // A message with a link was prepared with its content, which isn't what it displays.
+    if (entry && [entry.content isEqual:content]) {
+        
+        [self claimEntry:entry delegate:delegate];
+        
+    } else {
+        
+        entry = [self claimEntry:[self reusableEntryKeepingMessageIDs:nil] ?: [self addEntry] delegate:delegate];
+        entry.messageID = messageID;
+        [self loadContent:content ofEntry:entry injectable:NO];
+    }
+    
+    [self addCompletion:handler toEntry:entry];
+    
+    return entry.webView;
+}
+
+- (UIWebView *)webViewForHTML:(NSString *)html delegate:(id<UIWebViewDelegate>)delegate completionHandler:(APXWebViewLoadCompletion)handler
+{
+    APXWebViewPoolEntry *entry = [self claimEntry:[self reusableEntryKeepingMessageIDs:nil] ?: [self addEntry] delegate:delegate];
+    
+    entry.messageID = nil;
+    [self loadContent:html ?: @"" ofEntry:entry injectable:YES];
+    [self addCompletion:handler toEntry:entry];
+    
+    return entry.webView;
+}
+
+- (UIWebView *)webViewForURL:(NSURL *)URL delegate:(id<UIWebViewDelegate>)delegate completionHandler:(APXWebViewLoadCompletion)handler
+{
+    APXWebViewPoolEntry *entry = [self claimEntry:[self reusableEntryKeepingMessageIDs:nil] ?: [self addEntry] delegate:delegate];
+    
+    entry.messageID = nil;
+    [self loadContent:URL ?: [NSURL URLWithString:@"about:blank"] ofEntry:entry injectable:NO];
+    [self addCompletion:handler toEntry:entry];
+    
+    return entry.webView;
+}
+
+- (void)prepareMessages:(NSArray *)messages
+/*
+  Messages which weren't opened are prepared from their content, reading their link would mark them as read.
+*/
+{
+    NSMutableSet *messageIDs = [[NSMutableSet alloc] initWithCapacity:[messages count]];
+    
+    for (APXRichMessage *message in messages) {
+        
+        [messageIDs addObject:@(message.uniqueID)];
+    }
+    
+    for (APXRichMessage *message in messages) {
+        
+        NSNumber *messageID = @(message.uniqueID);
+        
+        if ([self entryForMessageID:messageID]) continue;
+        
+        APXWebViewPoolEntry *entry = [self reusableEntryKeepingMessageIDs:messageIDs];
+        
+        if (!entry && [self.entries count] < self.capacity) entry = [self addEntry];
+        if (!entry) break;
+        
+        entry.messageID = messageID;
+        [self loadContent:message.content ?: @"" ofEntry:entry injectable:NO];
+    }
+}
+
+- (void)recycleWebView:(UIWebView *)webView
+{
+    APXWebViewPoolEntry *entry = [self entryForWebView:webView];
+    
+    if (!entry.isInUse) return;
+    
+    entry.isInUse = NO;
+    entry.delegate = nil;
+    entry.generation++;
+    [entry.completions removeAllObjects];
+    
+    [webView removeFromSuperview];
+    [webView.scrollView setContentOffset:CGPointZero animated:NO];
+    
+    // Web views created while every other one was in use aren't kept.
+    while ([self.entries count] > self.capacity) {
+        
+        APXWebViewPoolEntry *idleEntry = [self reusableEntryKeepingMessageIDs:nil];
+        
+        if (!idleEntry) break;
+        
+        [self removeEntry:idleEntry];
+    }
+}
+
++ (void)installWebView:(UIWebView *)webView inPlaceOfView:(UIView *)placeholder
+{
+    if (webView.superview == placeholder.superview) return;
+    
+    webView.translatesAutoresizingMaskIntoConstraints = NO;
+    [placeholder.superview insertSubview:webView aboveSubview:placeholder];
+    
+    for (NSNumber *attribute in @[@(NSLayoutAttributeLeading), @(NSLayoutAttributeTrailing), @(NSLayoutAttributeTop), @(NSLayoutAttributeBottom)]) {
+        
+        NSLayoutAttribute layoutAttribute = [attribute integerValue];
+        [placeholder.superview addConstraint:[NSLayoutConstraint constraintWithItem:webView attribute:layoutAttribute relatedBy:NSLayoutRelationEqual toItem:placeholder attribute:layoutAttribute multiplier:1.0 constant:0.0]];
+    }
+    
+    placeholder.hidden = YES;
+}
+
+#pragma mark - Entries
+
+- (APXWebViewPoolEntry *)addEntry
+{
+    APXWebViewPoolEntry *entry = [[APXWebViewPoolEntry alloc] init];
+    
+    entry.webView = [[UIWebView alloc] initWithFrame:[[UIScreen mainScreen] bounds]];
+    entry.webView.backgroundColor = [UIColor whiteColor];
+    entry.webView.delegate = self;
+    entry.completions = [[NSMutableArray alloc] init];
+    
+    [self.entries addObject:entry];
+    
+    return entry;
+}
+
+- (void)removeEntry:(APXWebViewPoolEntry *)entry
+{
+    entry.webView.delegate = nil;
+    [entry.webView stopLoading];
+    
+    [self.entries removeObject:entry];
+}
+
+- (APXWebViewPoolEntry *)claimEntry:(APXWebViewPoolEntry *)entry delegate:(id<UIWebViewDelegate>)delegate
+{
+    entry.isInUse = YES;
+    entry.delegate = delegate;
+    entry.generation++;
+    
+    [self.entries removeObject:entry];
+    [self.entries addObject:entry];
+    
+    return entry;
+}
+
+- (void)addCompletion:(APXWebViewLoadCompletion)handler toEntry:(APXWebViewPoolEntry *)entry
+{
+    if (!handler) return;
+    
+    if (!entry.isLoaded) {
+        
+        [entry.completions addObject:[handler copy]];
+        return;
+    }
+    
+    // Already loaded, still called asynchronously so callers see the same order of events either way.
+    NSUInteger generation = entry.generation;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        
+        if (entry.generation == generation) handler(entry.webView, entry.loadError);
+    });
+}
+
+- (void)finishLoadOfEntry:(APXWebViewPoolEntry *)entry error:(NSError *)error
+{
+    entry.isShellLoaded = entry.isLoadingShell && !error;
+    entry.isLoadingShell = NO;
+    entry.isLoaded = YES;
+    entry.loadError = error;
+    
+    NSArray *completions = [entry.completions copy];
+    [entry.completions removeAllObjects];
+    
+    for (APXWebViewLoadCompletion completion in completions) {
+        
+        completion(entry.webView, error);
+    }
+}
+
+- (APXWebViewPoolEntry *)entryForWebView:(UIWebView *)webView
+{
+    for (APXWebViewPoolEntry *entry in self.entries) {
+        
+        if (entry.webView == webView) return entry;
+    }
+    
+    return nil;
+}
+
+- (APXWebViewPoolEntry *)entryForMessageID:(NSNumber *)messageID
+{
+    for (APXWebViewPoolEntry *entry in self.entries) {
+        
+        if ([entry.messageID isEqualToNumber:messageID]) return entry;
+    }
+    
+    return nil;
+}
+
+- (APXWebViewPoolEntry *)idleEntryForMessageID:(NSNumber *)messageID
+{
+    APXWebViewPoolEntry *entry = [self entryForMessageID:messageID];
+    
+    return entry.isInUse ? nil : entry;
+}
+
+- (APXWebViewPoolEntry *)reusableEntryKeepingMessageIDs:(NSSet *)messageIDs
+/*
+  An idle web view without a message if there is one, otherwise the least recently used one whose message isn't in messageIDs.
+*/
+{
+    APXWebViewPoolEntry *leastRecentlyUsed = nil;
+    
+    for (APXWebViewPoolEntry *entry in self.entries) {
+        
+        if (entry.isInUse) continue;
+        if (!entry.messageID) return entry;
+        
+        if (!leastRecentlyUsed && ![messageIDs containsObject:entry.messageID]) leastRecentlyUsed = entry;
+    }
+    
+    return leastRecentlyUsed;
+}
+
+#pragma mark - UIWebViewDelegate
+
+- (BOOL)webView:(UIWebView *)webView shouldStartLoadWithRequest:(NSURLRequest *)request navigationType:(UIWebViewNavigationType)navigationType
+{
+    APXWebViewPoolEntry *entry = [self entryForWebView:webView];
+    id<UIWebViewDelegate> delegate = entry.delegate;
+    
+    if ([delegate respondsToSelector:_cmd] && ![delegate webView:webView shouldStartLoadWithRequest:request navigationType:navigationType]) return NO;
+    
+    if (navigationType != UIWebViewNavigationTypeOther && [request.URL isEqual:request.mainDocumentURL]) {
+        
+        // The user followed a link, the web view no longer shows the message, nor the shell.
+        entry.messageID = nil;
+        entry.content = nil;
+        entry.isLoadingShell = NO;
+        entry.isShellLoaded = NO;
+    }
+    
+    return YES;
+}
+
+- (void)webViewDidStartLoad:(UIWebView *)webView
+{
+    id<UIWebViewDelegate> delegate = [self entryForWebView:webView].delegate;
+    
+    if ([delegate respondsToSelector:_cmd]) [delegate webViewDidStartLoad:webView];
+}
+
+- (void)webViewDidFinishLoad:(UIWebView *)webView
+{
+    APXWebViewPoolEntry *entry = [self entryForWebView:webView];
+    id<UIWebViewDelegate> delegate = entry.delegate;
+    
+    if ([delegate respondsToSelector:_cmd]) [delegate webViewDidFinishLoad:webView];
+    
+    // Frames report their own loads, the page is done once nothing is loading anymore.
+    if (entry && !webView.isLoading) [self finishLoadOfEntry:entry error:nil];
+}
+
+- (void)webView:(UIWebView *)webView didFailLoadWithError:(NSError *)error
+{
+    APXWebViewPoolEntry *entry = [self entryForWebView:webView];
+    id<UIWebViewDelegate> delegate = entry.delegate;
+    
+    if ([delegate respondsToSelector:_cmd]) [delegate webView:webView didFailLoadWithError:error];
+    
+    // A load replaced by the next one.
+    if ([error.domain isEqualToString:NSURLErrorDomain] && error.code == NSURLErrorCancelled) return;
+    
+    if (entry && !webView.isLoading) [self finishLoadOfEntry:entry error:error];
+}
+
+#pragma mark - Notifications
+
+- (void)didReceiveMemoryWarning:(NSNotification *)notification
+{
+    for (APXWebViewPoolEntry *entry in [self.entries copy]) {
+        
+        if (!entry.isInUse) [self removeEntry:entry];
+    }
+}
+
+@end
@@ -0,0 +1,45 @@
+//
+//  APXBenchmark.h
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Result keys, durations are in microseconds per iteration.
+extern NSString * const APXBenchmarkNameKey;
+extern NSString * const APXBenchmarkIterationsKey;
+extern NSString * const APXBenchmarkMinKey;
+extern NSString * const APXBenchmarkMedianKey;
+extern NSString * const APXBenchmarkP90Key;
+extern NSString * const APXBenchmarkP99Key;
+extern NSString * const APXBenchmarkMaxKey;
+
+// Set to 1 where the benchmarks have to be compared, i.e. in CI on the reference device.
+extern NSString * const APXBenchmarkBaselineRequiredEnvironmentKey;
+
+// A minimal microbenchmark harness. Runs a block for a number of warmup iterations, then times each measured iteration on its own,
+// and reports percentiles rather than a mean, so a single page fault or context switch doesn't skew the result.
+//
+// Every result is appended to APXBenchmarkResults.json in the temporary directory of the test host.
+// APXBenchmarkBaseline.json in the test bundle holds the reference medians, which are compared when the results come from
+// the same hardware type as the baseline. There, a benchmark without a baseline fails as well. Elsewhere nothing is compared,
+// unless the APXBenchmarkBaselineRequiredEnvironmentKey variable is set, which fails every run off the reference device.
+// To update the baseline, run the benchmarks on the reference device and copy the results file over, it has the same format.
+@interface APXBenchmark : NSObject
+
+@property (nonatomic, copy, readonly) NSString *name;
+@property (nonatomic) NSUInteger warmupIterations; // default is 10
+@property (nonatomic) NSUInteger iterations; // default is 200
+
+- (instancetype)initWithName:(NSString *)name;
+
+// Returns the result dictionary, and records it in the results file.
+- (NSDictionary *)runBlock:(void (^)(void))block;
+
+// Returns a failure description when the result's median is slower than the baseline allows, or can't be compared where it has to be.
+- (NSString *)regressionForResult:(NSDictionary *)result;
+
+@end
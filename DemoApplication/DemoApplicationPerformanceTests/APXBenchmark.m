@@ -0,0 +1,179 @@
+//
+//  APXBenchmark.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXBenchmark.h"
+#import <mach/mach_time.h>
+#import <sys/sysctl.h>
+
+NSString * const APXBenchmarkNameKey = @"name";
+NSString * const APXBenchmarkIterationsKey = @"iterations";
+NSString * const APXBenchmarkMinKey = @"min_us";
+NSString * const APXBenchmarkMedianKey = @"p50_us";
+NSString * const APXBenchmarkP90Key = @"p90_us";
+NSString * const APXBenchmarkP99Key = @"p99_us";
+NSString * const APXBenchmarkMaxKey = @"max_us";
+
+NSString * const APXBenchmarkBaselineRequiredEnvironmentKey = @"APX_BENCHMARK_BASELINE_REQUIRED";
+
+static NSString * const kAPXBenchmarkDeviceKey = @"device";
+static NSString * const kAPXBenchmarkThresholdKey = @"threshold";
+static NSString * const kAPXBenchmarkBenchmarksKey = @"benchmarks";
+
+// A median up to 25% slower than the baseline is considered noise.
+static double const kAPXBenchmarkDefaultThreshold = 1.25;
+
+static int APXBenchmarkCompareSamples(const void *a, const void *b) {
+    double lhs = *(const double *)a, rhs = *(const double *)b;
+    
+    return lhs < rhs ? -1 : lhs > rhs ? 1 : 0;
+}
+
+// Nearest rank percentile of an ascending array.
+static double APXBenchmarkPercentile(const double *sortedSamples, NSUInteger count, double percentile) {
+    NSUInteger index = (NSUInteger)ceil(percentile * count);
+    
+    return sortedSamples[MIN(MAX(index, (NSUInteger)1), count) - 1];
+}
+
+@implementation APXBenchmark
+
+- (instancetype)initWithName:(NSString *)name {
+    self = [super init];
+    
+    if (self) {
+        
+        _name = [name copy];
+        _warmupIterations = 10;
+        _iterations = 200;
+    }
+    
+    return self;
+}
+
+#pragma mark - Measuring
+
+- (NSDictionary *)runBlock:(void (^)(void))block {
+    for (NSUInteger i = 0; i < self.warmupIterations; i++) {
+        @autoreleasepool {
+            block();
+        }
+    }
+    
+    NSUInteger count = MAX(self.iterations, (NSUInteger)1);
+    double *samples = malloc(sizeof(double) * count);
+    
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    
+    for (NSUInteger i = 0; i < count; i++) {
+        @autoreleasepool {
+            uint64_t start = mach_absolute_time();
+            block();
+            uint64_t end = mach_absolute_time();
+            
+            samples[i] = (double)(end - start) * timebase.numer / timebase.denom / 1000.0;
+        }
+    }
+    
+    qsort(samples, count, sizeof(double), APXBenchmarkCompareSamples);
+    
+    NSDictionary *result = @{APXBenchmarkNameKey : self.name,
+                             APXBenchmarkIterationsKey : @(count),
+                             APXBenchmarkMinKey : @(samples[0]),
+                             APXBenchmarkMedianKey : @(APXBenchmarkPercentile(samples, count, 0.5)),
+                             APXBenchmarkP90Key : @(APXBenchmarkPercentile(samples, count, 0.9)),
+                             APXBenchmarkP99Key : @(APXBenchmarkPercentile(samples, count, 0.99)),
+                             APXBenchmarkMaxKey : @(samples[count - 1])};
+    free(samples);
+    
+    [[self class] recordResult:result];
+    NSLog(@"%@: p50 %.2fus p90 %.2fus p99 %.2fus", self.name, [result[APXBenchmarkMedianKey] doubleValue], [result[APXBenchmarkP90Key] doubleValue], [result[APXBenchmarkP99Key] doubleValue]);
+    
+    return result;
+}
+
+#pragma mark - Baseline
+
+- (NSString *)regressionForResult:(NSDictionary *)result {
+    NSDictionary *baseline = [[self class] baseline];
+    NSString *device = [baseline[kAPXBenchmarkDeviceKey] isKindOfClass:[NSString class]] ? baseline[kAPXBenchmarkDeviceKey] : @"";
+    BOOL isRequired = [[[NSProcessInfo processInfo] environment][APXBenchmarkBaselineRequiredEnvironmentKey] boolValue];
+    
+    if (![device length]) {
+        return isRequired ? @"APXBenchmarkBaseline.json names no reference device, record the baseline on it" : nil;
+    }
+    
+    if (![device isEqualToString:[[self class] hardwareType]]) {
+        return isRequired ? [NSString stringWithFormat:@"The baseline was recorded on %@, not on this %@", device, [[self class] hardwareType]] : nil;
+    }
+    
+    NSDictionary *reference = baseline[kAPXBenchmarkBenchmarksKey][self.name];
+    
+    // On the reference device every benchmark has to be compared, a missing entry would let it regress unnoticed.
+    if (![reference[APXBenchmarkMedianKey] isKindOfClass:[NSNumber class]]) {
+        return [NSString stringWithFormat:@"%@ has no baseline for %@, record it", self.name, device];
+    }
+    
+    double threshold = reference[kAPXBenchmarkThresholdKey] ? [reference[kAPXBenchmarkThresholdKey] doubleValue] :
+                       baseline[kAPXBenchmarkThresholdKey] ? [baseline[kAPXBenchmarkThresholdKey] doubleValue] : kAPXBenchmarkDefaultThreshold;
+    double allowed = [reference[APXBenchmarkMedianKey] doubleValue] * threshold;
+    double median = [result[APXBenchmarkMedianKey] doubleValue];
+    
+    if (median <= allowed) return nil;
+    
+    return [NSString stringWithFormat:@"%@ regressed: p50 %.2fus, baseline allows %.2fus", self.name, median, allowed];
+}
+
++ (NSDictionary *)baseline {
+    static NSDictionary *baseline = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSURL *url = [[NSBundle bundleForClass:self] URLForResource:@"APXBenchmarkBaseline" withExtension:@"json"];
+        NSData *data = url ? [NSData dataWithContentsOfURL:url] : nil;
+        id json = data ? [NSJSONSerialization JSONObjectWithData:data options:0 error:nil] : nil;
+        
+        baseline = [json isKindOfClass:[NSDictionary class]] ? json : @{};
+    });
+    
+    return baseline;
+}
+
+#pragma mark - Results
+
++ (void)recordResult:(NSDictionary *)result {
+    static NSMutableDictionary *results = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        results = [[NSMutableDictionary alloc] init];
+    });
+    
+    @synchronized (results) {
+        results[result[APXBenchmarkNameKey]] = result;
+        
+        NSDictionary *report = @{kAPXBenchmarkDeviceKey : [self hardwareType], kAPXBenchmarkBenchmarksKey : results};
+        NSData *data = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:nil];
+        
+        [data writeToFile:[NSTemporaryDirectory() stringByAppendingPathComponent:@"APXBenchmarkResults.json"] atomically:YES];
+    }
+}
+
++ (NSString *)hardwareType {
+    size_t size = 0;
+    sysctlbyname("hw.machine", NULL, &size, NULL, 0);
+    
+    if (!size) return @"";
+    
+    char *machine = malloc(size);
+    sysctlbyname("hw.machine", machine, &size, NULL, 0);
+    NSString *hardwareType = [NSString stringWithUTF8String:machine];
+    free(machine);
+    
+    return hardwareType ?: @"";
+}
+
+@end
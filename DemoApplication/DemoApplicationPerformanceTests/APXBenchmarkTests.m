@@ -0,0 +1,145 @@
+//
+//  APXBenchmarkTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXBenchmark.h"
+#import "APXInboxChangeSet.h"
+#import "APXPushDeduplicator.h"
+#import "APXSharedStore.h"
+#import "APXTestDoubles.h"
+
+@interface APXBenchmarkTests : XCTestCase
+
+@end
+
+@implementation APXBenchmarkTests
+
+- (void)runBenchmark:(NSString *)name block:(void (^)(void))block {
+    APXBenchmark *benchmark = [[APXBenchmark alloc] initWithName:name];
+    NSString *regression = [benchmark regressionForResult:[benchmark runBlock:block]];
+    
+    if (regression) XCTFail(@"%@", regression);
+}
+
+- (NSDictionary *)pushPayload {
+    return @{@"aps" : @{@"alert" : @{@"title" : @"Weekend sale", @"body" : @"Up to 50% off, today only"}, @"badge" : @1, @"sound" : @"default"},
+             @"p" : @123456,
+             @"e" : @{@"deep_link" : @"apx://promo/weekend", @"campaign" : @"spring"}};
+}
+
+- (NSDictionary *)richMessagePayload {
+    return @{@"id" : @123456,
+             @"title" : @"Weekend sale",
+             @"content" : @"Up to 50% off, today only",
+             @"link" : @"https://example.com/promo/weekend",
+             @"post_date" : @"2026-10-18 10:00:00"};
+}
+
+- (NSArray *)inboxWithCount:(NSUInteger)count {
+    NSMutableArray *messages = [[NSMutableArray alloc] initWithCapacity:count];
+    
+    for (NSUInteger i = 0; i < count; i++) {
+        [messages addObject:[APXTestRichMessage messageWithID:i + 1 title:[NSString stringWithFormat:@"Message %lu", (unsigned long)i] isRead:NO]];
+    }
+    
+    return messages;
+}
+
+#pragma mark - Payloads
+
+- (void)testPushNotificationParsing {
+    NSDictionary *payload = [self pushPayload];
+    
+    [self runBenchmark:@"push_notification_parse" block:^{
+        [APXPushNotification notificationWithKeyedValues:payload];
+    }];
+}
+
+- (void)testRichMessageParsing {
+    NSDictionary *payload = [self richMessagePayload];
+    
+    [self runBenchmark:@"rich_message_parse" block:^{
+        (void)[[APXRichMessage alloc] initWithKeyedValues:payload];
+    }];
+}
+
+- (void)testRichMessageCodingRoundTrip {
+    NSMutableArray *messages = [[NSMutableArray alloc] init];
+    
+    for (NSUInteger i = 0; i < 100; i++) {
+        [messages addObject:[[APXRichMessage alloc] initWithKeyedValues:[self richMessagePayload]]];
+    }
+    
+    [self runBenchmark:@"rich_message_coding_100" block:^{
+        [NSKeyedUnarchiver unarchiveObjectWithData:[NSKeyedArchiver archivedDataWithRootObject:messages]];
+    }];
+}
+
+#pragma mark - Inbox
+
+- (void)testInboxMerge {
+    NSArray *oldMessages = [self inboxWithCount:500];
+    NSMutableArray *newMessages = [[oldMessages subarrayWithRange:NSMakeRange(10, 490)] mutableCopy];
+    
+    // A refresh bringing in 10 new messages, deleting 10, and moving one to the top.
+    [newMessages exchangeObjectAtIndex:0 withObjectAtIndex:250];
+    
+    for (NSUInteger i = 0; i < 10; i++) {
+        [newMessages insertObject:[APXTestRichMessage messageWithID:1000 + i title:@"New" isRead:NO] atIndex:0];
+    }
+    
+    [self runBenchmark:@"inbox_merge_500" block:^{
+        [APXInboxChangeSet changeSetFromMessages:oldMessages toMessages:newMessages];
+    }];
+}
+
+#pragma mark - Push Handling
+
+- (void)testPushDeduplication {
+    APXPushDeduplicator *deduplicator = [[APXPushDeduplicator alloc] initWithCapacity:256 fileURL:nil];
+    __block NSInteger uniqueID = 0;
+    
+    [self runBenchmark:@"push_deduplication" block:^{
+        [deduplicator shouldHandleNotification:[APXTestPushNotification notificationWithID:++uniqueID % 512 + 1] withIdentifier:nil];
+    }];
+}
+
+#pragma mark - Configuration
+
+- (void)testConfigExport {
+    // The app's launch path: AppoxeeConfig.plist read and its SDK section written to the shared store, unchanged on every launch but the first.
+    NSString *path = [[NSBundle mainBundle] pathForResource:@"AppoxeeConfig" ofType:@"plist"];
+    NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    APXSharedStore *store = [[APXSharedStore alloc] initWithFileURL:fileURL];
+    
+    XCTAssertNotNil(path);
+    
+    [self runBenchmark:@"config_export" block:^{
+        NSDictionary *config = [NSDictionary dictionaryWithContentsOfFile:path];
+        [store setObject:config[@"sdk"] forKey:APXSharedStoreConfigKey error:NULL];
+    }];
+    
+    XCTAssertNotNil([store objectForKey:APXSharedStoreConfigKey]);
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+- (void)testConfigReadByExtension {
+    // An extension launches with a fresh store and reads the configuration the app exported.
+    NSDictionary *config = [NSDictionary dictionaryWithContentsOfFile:[[NSBundle mainBundle] pathForResource:@"AppoxeeConfig" ofType:@"plist"]];
+    NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    
+    XCTAssertTrue([[[APXSharedStore alloc] initWithFileURL:fileURL] setObject:config[@"sdk"] forKey:APXSharedStoreConfigKey error:NULL]);
+    
+    [self runBenchmark:@"config_read_extension" block:^{
+        [[[APXSharedStore alloc] initWithFileURL:fileURL] objectForKey:APXSharedStoreConfigKey];
+    }];
+    
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+@end
@@ -0,0 +1,40 @@
+//
+//  APXLoadGenerator.h
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "APXLocalBackend.h"
+#import "APXTestDoubles.h"
+
+// Report keys.
+extern NSString * const APXLoadReportDevicesKey;
+extern NSString * const APXLoadReportRequestsKey;
+extern NSString * const APXLoadReportRequestsPerDeviceKey;
+extern NSString * const APXLoadReportRequestsByOperationKey;
+extern NSString * const APXLoadReportThrottledKey;
+extern NSString * const APXLoadReportFailedKey;
+extern NSString * const APXLoadReportMedianLatencyKey; // milliseconds
+extern NSString * const APXLoadReportP99LatencyKey; // milliseconds
+extern NSString * const APXLoadReportDurationKey; // seconds
+
+// Call done exactly once, when the device finished its scenario.
+typedef void(^APXLoadScenario)(APXFakeAppoxeeClient *client, dispatch_block_t done);
+
+// Simulates a fleet of devices against one APXLocalBackend. Every device starts its scenario at a random time within 'burstWindow',
+// the way a campaign send reaches a whole segment within seconds.
+@interface APXLoadGenerator : NSObject
+
+@property (nonatomic, strong, readonly) APXLocalBackend *backend;
+@property (nonatomic, readonly) NSUInteger deviceCount;
+@property (nonatomic) NSTimeInterval burstWindow; // default is 1 second
+
+- (instancetype)initWithBackend:(APXLocalBackend *)backend deviceCount:(NSUInteger)deviceCount;
+
+// completion is called on the main queue once every device is done.
+- (void)runScenario:(APXLoadScenario)scenario completion:(void (^)(NSDictionary *report))completion;
+
+@end
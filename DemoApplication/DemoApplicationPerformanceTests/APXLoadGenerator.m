@@ -0,0 +1,80 @@
+//
+//  APXLoadGenerator.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXLoadGenerator.h"
+
+NSString * const APXLoadReportDevicesKey = @"devices";
+NSString * const APXLoadReportRequestsKey = @"requests";
+NSString * const APXLoadReportRequestsPerDeviceKey = @"requests_per_device";
+NSString * const APXLoadReportRequestsByOperationKey = @"requests_by_operation";
+NSString * const APXLoadReportThrottledKey = @"throttled";
+NSString * const APXLoadReportFailedKey = @"failed";
+NSString * const APXLoadReportMedianLatencyKey = @"p50_latency_ms";
+NSString * const APXLoadReportP99LatencyKey = @"p99_latency_ms";
+NSString * const APXLoadReportDurationKey = @"duration_s";
+
+@implementation APXLoadGenerator
+
+- (instancetype)initWithBackend:(APXLocalBackend *)backend deviceCount:(NSUInteger)deviceCount {
+    self = [super init];
+    
+    if (self) {
+        
+        _backend = backend;
+        _deviceCount = deviceCount;
+        _burstWindow = 1.0;
+    }
+    
+    return self;
+}
+
+- (void)runScenario:(APXLoadScenario)scenario completion:(void (^)(NSDictionary *report))completion {
+    dispatch_group_t group = dispatch_group_create();
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    
+    [self.backend resetStatistics];
+    
+    for (NSUInteger i = 0; i < self.deviceCount; i++) {
+        APXFakeAppoxeeClient *client = [[APXFakeAppoxeeClient alloc] initWithBackend:self.backend deviceID:[NSString stringWithFormat:@"device-%lu", (unsigned long)i]];
+        NSTimeInterval offset = self.burstWindow * arc4random_uniform(1001) / 1000.0;
+        
+        dispatch_group_enter(group);
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(offset * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+            __block BOOL isDone = NO;
+            
+            scenario(client, ^{
+                @synchronized (client) {
+                    if (isDone) return;
+                    
+                    isDone = YES;
+                }
+                
+                dispatch_group_leave(group);
+            });
+        });
+    }
+    
+    dispatch_group_notify(group, dispatch_get_main_queue(), ^{
+        APXLocalBackend *backend = self.backend;
+        NSUInteger requests = backend.requestCount;
+        
+        NSDictionary *report = @{APXLoadReportDevicesKey : @(self.deviceCount),
+                                 APXLoadReportRequestsKey : @(requests),
+                                 APXLoadReportRequestsPerDeviceKey : @(self.deviceCount ? (double)requests / self.deviceCount : 0),
+                                 APXLoadReportRequestsByOperationKey : [backend requestCountsByOperation],
+                                 APXLoadReportThrottledKey : @(backend.throttledCount),
+                                 APXLoadReportFailedKey : @(backend.failedCount),
+                                 APXLoadReportMedianLatencyKey : @([backend latencyAtPercentile:0.5] * 1000),
+                                 APXLoadReportP99LatencyKey : @([backend latencyAtPercentile:0.99] * 1000),
+                                 APXLoadReportDurationKey : @(CFAbsoluteTimeGetCurrent() - start)};
+                                 
+        if (completion) completion(report);
+    });
+}
+
+@end
@@ -0,0 +1,123 @@
+//
+//  APXLoadTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXLoadGenerator.h"
+#import "APXRefreshCoalescer.h"
+#import "APXInboxStore.h"
+#import "APXRequestScheduler.h"
+
+static NSUInteger const kAPXLoadTestsDeviceCount = 5000;
+
+@interface APXLoadTests : XCTestCase
+
+@end
+
+@implementation APXLoadTests
+
+- (NSDictionary *)runScenario:(APXLoadScenario)scenario withBackend:(APXLocalBackend *)backend burstWindow:(NSTimeInterval)burstWindow {
+    APXLoadGenerator *generator = [[APXLoadGenerator alloc] initWithBackend:backend deviceCount:kAPXLoadTestsDeviceCount];
+    generator.burstWindow = burstWindow;
+    XCTestExpectation *finished = [self expectationWithDescription:@"load"];
+    __block NSDictionary *report = nil;
+    
+    [generator runScenario:scenario completion:^(NSDictionary *result) {
+        report = result;
+        [finished fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:60.0 handler:nil];
+    
+    return report;
+}
+
+- (void)testCampaignBurstOfTriggerUpdates {
+    APXLocalBackend *backend = [[APXLocalBackend alloc] init];
+    backend.latency = 0.02;
+    backend.latencyJitter = 0.08;
+    
+    NSCountedSet *syncsPerDevice = [[NSCountedSet alloc] init];
+    
+    // Every simulated device would schedule its Inbox refresh in its own process, they mustn't queue behind each other's.
+    [[APXRequestScheduler sharedScheduler] setMaximumConcurrentRequests:kAPXLoadTestsDeviceCount forLane:APXRequestLaneDefault];
+    
+    // Every device gets three silent 'trigger update' pushes within 200ms.
+    NSDictionary *report = [self runScenario:^(APXFakeAppoxeeClient *client, dispatch_block_t done) {
+        // The sync +sharedCoalescer runs, against this device's client and Inbox store.
+        APXRefreshCoalescerRefreshBlock syncBlock = [APXRefreshCoalescer syncBlockWithClient:client inboxStore:[[APXInboxStore alloc] initWithClient:client]];
+        __block NSUInteger syncs = 0;
+        APXRefreshCoalescer *coalescer = [[APXRefreshCoalescer alloc] initWithWindow:0.5 refreshBlock:^(APXRefreshCoalescerFetchHandler completion) {
+            syncs++;
+            syncBlock(completion);
+        }];
+        
+        __block NSUInteger pending = 3;
+        
+        for (NSUInteger push = 0; push < 3; push++) {
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(push * 0.1 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+                [coalescer requestRefreshWithFetchCompletionHandler:^(UIBackgroundFetchResult fetchResult) {
+                    if (--pending == 0) {
+                        @synchronized (syncsPerDevice) {
+                            [syncsPerDevice addObject:@(syncs)];
+                        }
+                        done();
+                    }
+                }];
+            });
+        }
+    } withBackend:backend burstWindow:2.0];
+    
+    [[APXRequestScheduler sharedScheduler] setMaximumConcurrentRequests:2 forLane:APXRequestLaneDefault];
+    
+    // The first push is synced for right away, the two which follow it share at most one more sync, never one each.
+    XCTAssertEqual([syncsPerDevice countForObject:@1] + [syncsPerDevice countForObject:@2], kAPXLoadTestsDeviceCount);
+    
+    NSUInteger fetches = [report[APXLoadReportRequestsByOperationKey][APXLocalBackendOperationFetch] unsignedIntegerValue];
+    XCTAssertEqual(fetches, [syncsPerDevice countForObject:@1] + 2 * [syncsPerDevice countForObject:@2]);
+    
+    NSUInteger inboxRefreshes = [report[APXLoadReportRequestsByOperationKey][APXLocalBackendOperationInbox] unsignedIntegerValue];
+    XCTAssertEqual(inboxRefreshes, fetches);
+}
+
+- (void)testThrottledBackendFailsFast {
+    APXLocalBackend *backend = [[APXLocalBackend alloc] init];
+    backend.latency = 0.05;
+    backend.maximumConcurrentRequests = kAPXLoadTestsDeviceCount / 10;
+    
+    NSDictionary *report = [self runScenario:^(APXFakeAppoxeeClient *client, dispatch_block_t done) {
+        [client refreshInboxWithCompletionHandler:^(NSError *appoxeeError, id data) {
+            done();
+        }];
+    } withBackend:backend burstWindow:0.05];
+    
+    XCTAssertEqualObjects(report[APXLoadReportRequestsKey], @(kAPXLoadTestsDeviceCount));
+    XCTAssertGreaterThan([report[APXLoadReportThrottledKey] unsignedIntegerValue], 0);
+}
+
+- (void)testPerDeviceRateLimit {
+    APXLocalBackend *backend = [[APXLocalBackend alloc] init];
+    backend.requestsPerSecondPerDevice = 1;
+    
+    APXFakeAppoxeeClient *client = [[APXFakeAppoxeeClient alloc] initWithBackend:backend deviceID:@"device"];
+    XCTestExpectation *first = [self expectationWithDescription:@"first"];
+    XCTestExpectation *second = [self expectationWithDescription:@"second"];
+    
+    [client getDeviceAliasWithCompletionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertNil(appoxeeError);
+        [first fulfill];
+    }];
+    
+    [client getDeviceAliasWithCompletionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertEqual(appoxeeError.code, APXLocalBackendErrorThrottled);
+        [second fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+@end
@@ -0,0 +1,157 @@
+//
+//  APXContentPrefetcherTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXContentPrefetcher.h"
+#import "APXTestDoubles.h"
+
+static NSMutableDictionary *APXContentTestPages; // URL string -> NSData
+static NSMutableArray *APXContentTestRequests; // of Type NSURLRequest
+
+// Serves APXContentTestPages, 404 for anything else.
+@interface APXContentTestURLProtocol : NSURLProtocol
+
+@end
+
+@implementation APXContentTestURLProtocol
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request {
+    return YES;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request {
+    return request;
+}
+
+- (void)startLoading {
+    NSData *page = nil;
+    
+    @synchronized (APXContentTestPages) {
+        [APXContentTestRequests addObject:self.request];
+        page = APXContentTestPages[[self.request.URL absoluteString]];
+    }
+    
+    [self.client URLProtocol:self didReceiveResponse:[[NSHTTPURLResponse alloc] initWithURL:self.request.URL statusCode:page ? 200 : 404 HTTPVersion:@"HTTP/1.1" headerFields:@{}] cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [self.client URLProtocol:self didLoadData:page ?: [NSData data]];
+    [self.client URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading {
+}
+
+@end
+
+@interface APXContentPrefetcherTests : XCTestCase
+
+@property (nonatomic, strong) APXContentPrefetcher *prefetcher;
+
+@end
+
+@implementation APXContentPrefetcherTests
+
+- (void)setUp {
+    [super setUp];
+    
+    APXContentTestPages = [[NSMutableDictionary alloc] init];
+    APXContentTestRequests = [[NSMutableArray alloc] init];
+    
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[[APXContentTestURLProtocol class]];
+    
+    NSURL *directory = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]] isDirectory:YES];
+    self.prefetcher = [[APXContentPrefetcher alloc] initWithCacheDirectoryURL:directory configuration:configuration];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:self.prefetcher.cacheDirectoryURL error:nil];
+    
+    [super tearDown];
+}
+
+- (APXTestRichMessage *)messageWithID:(NSInteger)uniqueID link:(NSString *)link {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:uniqueID title:@"Title" isRead:YES];
+    message.testMessageLink = link;
+    
+    return message;
+}
+
+- (void)waitForPagesCount:(NSUInteger)count {
+    __block NSUInteger cached = 0;
+    
+    [self expectationForNotification:APXContentPrefetcherDidCacheContentNotification object:self.prefetcher handler:^BOOL(NSNotification *notification) {
+        XCTAssertNotNil(notification.userInfo[APXContentPrefetcherURLKey]);
+        return ++cached == count;
+    }];
+}
+
+- (void)testPagesAreStoredAsTheyFinish {
+    APXContentTestPages[@"https://example.com/1"] = [@"<p>one</p>" dataUsingEncoding:NSUTF8StringEncoding];
+    APXContentTestPages[@"https://example.com/2"] = [@"<p>two</p>" dataUsingEncoding:NSUTF8StringEncoding];
+    
+    NSArray *messages = @[[self messageWithID:1 link:@"https://example.com/1"], [self messageWithID:2 link:@"https://example.com/2"], [self messageWithID:3 link:nil]];
+    
+    [self waitForPagesCount:2];
+    [self.prefetcher prefetchContentForMessages:messages];
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    
+    NSURL *cachedURL = [self.prefetcher cachedContentURLForURL:[NSURL URLWithString:@"https://example.com/2"]];
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:cachedURL], APXContentTestPages[@"https://example.com/2"]);
+    
+    // Stored pages aren't downloaded again.
+    [APXContentTestRequests removeAllObjects];
+    [self.prefetcher prefetchContentForMessages:messages];
+    [NSThread sleepForTimeInterval:0.2];
+    XCTAssertEqual([APXContentTestRequests count], 0);
+}
+
+- (void)testErrorPageIsNotStored {
+    NSURL *URL = [NSURL URLWithString:@"https://example.com/missing"];
+    
+    [self.prefetcher prefetchContentForMessages:@[[self messageWithID:1 link:[URL absoluteString]]]];
+    [NSThread sleepForTimeInterval:0.3];
+    
+    XCTAssertEqual([APXContentTestRequests count], 1);
+    XCTAssertNil([self.prefetcher cachedContentURLForURL:URL]);
+}
+
+- (void)testPagesOfRemovedMessagesAreRemoved {
+    APXContentTestPages[@"https://example.com/1"] = [@"<p>one</p>" dataUsingEncoding:NSUTF8StringEncoding];
+    
+    [self waitForPagesCount:1];
+    [self.prefetcher prefetchContentForMessages:@[[self messageWithID:1 link:@"https://example.com/1"]]];
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    
+    [self.prefetcher prefetchContentForMessages:@[]];
+    [NSThread sleepForTimeInterval:0.2];
+    
+    XCTAssertNil([self.prefetcher cachedContentURLForURL:[NSURL URLWithString:@"https://example.com/1"]]);
+}
+
+- (void)testUnreadMessagesStayUnread {
+    APXContentTestPages[@"https://example.com/1"] = [@"<p>one</p>" dataUsingEncoding:NSUTF8StringEncoding];
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:1 title:@"Title" isRead:NO];
+    message.testMessageLink = @"https://example.com/1";
+    
+    [self.prefetcher prefetchContentForMessages:@[message]];
+    [NSThread sleepForTimeInterval:0.2];
+    
+    XCTAssertEqual(message.messageLinkReadCount, 0);
+    XCTAssertFalse(message.isRead);
+    XCTAssertEqual([APXContentTestRequests count], 0);
+}
+
+- (void)testOtherSessionsEventsAreNotHandled {
+    __block BOOL called = NO;
+    
+    XCTAssertFalse([self.prefetcher handleEventsForBackgroundURLSession:@"com.example.other" completionHandler:^{
+        called = YES;
+    }]);
+    XCTAssertFalse(called);
+}
+
+@end
@@ -0,0 +1,173 @@
+//
+//  APXCustomFieldsStoreTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXCustomFieldsStore.h"
+#import "APXTestDoubles.h"
+
+@interface APXCustomFieldsStoreTests : XCTestCase
+
+@property (nonatomic, strong) APXFakeAppoxeeClient *client;
+@property (nonatomic, strong) APXCustomFieldsStore *store;
+
+@end
+
+@implementation APXCustomFieldsStoreTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.client = [[APXFakeAppoxeeClient alloc] init];
+    self.store = [[APXCustomFieldsStore alloc] initWithClient:self.client];
+}
+
+- (NSDictionary *)setFields:(NSDictionary *)fields error:(NSError **)error {
+    XCTestExpectation *finished = [self expectationWithDescription:@"set"];
+    __block NSDictionary *result = nil;
+    __block NSError *resultError = nil;
+    
+    [self.store setCustomFields:fields completionHandler:^(NSError *appoxeeError, id data) {
+        result = data;
+        resultError = appoxeeError;
+        [finished fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    
+    if (error) *error = resultError;
+    
+    return result;
+}
+
+- (void)testTwelveKeysCostOneRoundTrip {
+    NSMutableDictionary *fields = [[NSMutableDictionary alloc] init];
+    
+    for (NSUInteger i = 0; i < 12; i++) {
+        fields[[NSString stringWithFormat:@"field%lu", (unsigned long)i]] = @(i);
+    }
+    
+    [self setFields:fields error:NULL];
+    self.client.backend.latency = 0.1;
+    
+    // A store which doesn't know the fields yet has to read all of them.
+    APXCustomFieldsStore *store = [[APXCustomFieldsStore alloc] initWithClient:self.client];
+    XCTestExpectation *fetched = [self expectationWithDescription:@"fetch"];
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    
+    [store fetchCustomFieldsForKeys:[fields allKeys] completionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertNil(appoxeeError);
+        XCTAssertEqualObjects(data, fields);
+        XCTAssertTrue([NSThread isMainThread]);
+        [fetched fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertLessThan(CFAbsoluteTimeGetCurrent() - start, 12 * 0.1 / 2);
+}
+
+- (void)testSetUpdatesTheCacheInOneStep {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:0];
+    NSDictionary *fields = @{@"name" : @"Ada", @"age" : @36, @"since" : date};
+    
+    XCTAssertEqualObjects([self setFields:fields error:NULL], fields);
+    XCTAssertEqualObjects(self.store.cachedFields, fields);
+}
+
+- (void)testInvalidValueFailsTheWholeBatch {
+    NSError *error = nil;
+    
+    [self setFields:@{@"name" : @"Ada", @"tags" : @[@"a"]} error:&error];
+    
+    XCTAssertEqual(error.code, APXCustomFieldsErrorInvalidValue);
+    XCTAssertEqual([self.client.calls count], 0);
+    XCTAssertEqualObjects(self.store.cachedFields, @{});
+}
+
+- (void)testFailedKeysAreReported {
+    self.client.error = [NSError errorWithDomain:@"APXTest" code:1 userInfo:nil];
+    
+    NSError *error = nil;
+    NSDictionary *result = [self setFields:@{@"name" : @"Ada"} error:&error];
+    
+    XCTAssertEqual(error.code, APXCustomFieldsErrorPartialFailure);
+    XCTAssertNotNil(error.userInfo[APXCustomFieldsErrorsKey][@"name"]);
+    XCTAssertEqualObjects(result, @{});
+    XCTAssertEqualObjects(self.store.cachedFields, @{});
+}
+
+- (void)testFetchReadsItsOwnWriteWithoutARequest {
+    self.client.backend.latency = 0.5;
+    
+    [self.store setCustomFields:@{@"name" : @"Ada"} completionHandler:nil];
+    
+    XCTestExpectation *fetched = [self expectationWithDescription:@"fetch"];
+    
+    [self.store fetchCustomFieldsForKeys:@[@"name"] completionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertNil(appoxeeError);
+        XCTAssertEqualObjects(data, @{@"name" : @"Ada"});
+        [fetched fulfill];
+    }];
+    
+    // Well before the write reached the backend.
+    [self waitForExpectationsWithTimeout:0.25 handler:nil];
+    XCTAssertFalse([self.client.calls containsObject:@"fetchCustomFieldByKey:withCompletionHandler:"]);
+}
+
+- (void)testWriteDuringFetchWinsOverTheServerAnswer {
+    [self setFields:@{@"name" : @"Ada"} error:NULL];
+    [self.store clearCache];
+    self.client.backend.latency = 0.2;
+    
+    XCTestExpectation *fetched = [self expectationWithDescription:@"fetch"];
+    
+    [self.store fetchCustomFieldsForKeys:@[@"name"] completionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertEqualObjects(data, @{@"name" : @"Grace"});
+        [fetched fulfill];
+    }];
+    
+    [self.store setCustomFields:@{@"name" : @"Grace"} completionHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertEqualObjects(self.store.cachedFields, @{@"name" : @"Grace"});
+}
+
+- (void)testIncrementOfAKnownFieldIsAppliedLocally {
+    [self setFields:@{@"visits" : @2} error:NULL];
+    
+    XCTestExpectation *incremented = [self expectationWithDescription:@"increment"];
+    
+    [self.store incrementCustomFieldForKey:@"visits" byValue:@3 completionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertNil(appoxeeError);
+        [incremented fulfill];
+    }];
+    
+    XCTAssertEqualObjects(self.store.cachedFields[@"visits"], @5);
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertEqualObjects(self.store.cachedFields[@"visits"], @5);
+}
+
+- (void)testIncrementOfALargeCounterStaysExact {
+    [self setFields:@{@"points" : @9007199254740993LL} error:NULL];
+    
+    XCTestExpectation *incremented = [self expectationWithDescription:@"increment"];
+    
+    [self.store incrementCustomFieldForKey:@"points" byValue:@1 completionHandler:^(NSError *appoxeeError, id data) {
+        [incremented fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertEqual([self.store.cachedFields[@"points"] longLongValue], 9007199254740994LL);
+    XCTAssertFalse(CFNumberIsFloatType((__bridge CFNumberRef)self.store.cachedFields[@"points"]));
+}
+
+- (void)testSumIsADoubleOnlyIfAnOperandIs {
+    XCTAssertFalse(CFNumberIsFloatType((__bridge CFNumberRef)[APXCustomFieldsStore sumOfNumber:@2 andNumber:@3]));
+    XCTAssertEqualObjects([APXCustomFieldsStore sumOfNumber:@2 andNumber:@0.5], @2.5);
+}
+
+@end
@@ -0,0 +1,119 @@
+//
+//  APXDeepLinkRouterTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXDeepLinkRouter.h"
+
+@interface APXDeepLinkRouterTests : XCTestCase
+
+@property (nonatomic, strong) APXDeepLinkRouter *router;
+@property (nonatomic, strong) NSMutableArray *routed; // of Type APXDeepLinkMatch
+@property (nonatomic) NSUInteger createdCount;
+
+@end
+
+@implementation APXDeepLinkRouterTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.router = [[APXDeepLinkRouter alloc] init];
+    self.routed = [[NSMutableArray alloc] init];
+    self.createdCount = 0;
+}
+
+- (void)registerPattern:(NSString *)pattern {
+    [self.router registerPattern:pattern viewControllerFactory:^UIViewController *(APXDeepLinkMatch *match) {
+        self.createdCount++;
+        UIViewController *viewController = [[UIViewController alloc] init];
+        viewController.title = match.pattern;
+        return viewController;
+    } handler:^(APXDeepLinkMatch *match) {
+        [self.routed addObject:match];
+    }];
+}
+
+- (NSString *)patternMatching:(NSString *)link {
+    return [self.router matchURL:[NSURL URLWithString:link]].pattern;
+}
+
+- (void)testLiteralSegmentsWinOverParameters {
+    [self registerPattern:@"apx://inbox/:messageID"];
+    [self registerPattern:@"apx://inbox/latest"];
+    [self registerPattern:@"apx://inbox/*"];
+    
+    XCTAssertEqualObjects([self patternMatching:@"apx://inbox/latest"], @"apx://inbox/latest");
+    XCTAssertEqualObjects([self patternMatching:@"apx://INBOX/Latest"], @"apx://inbox/latest");
+    XCTAssertEqualObjects([self patternMatching:@"apx://inbox/42"], @"apx://inbox/:messageID");
+    XCTAssertEqualObjects([self patternMatching:@"apx://inbox/42/share"], @"apx://inbox/*");
+}
+
+- (void)testParametersAreExtracted {
+    [self registerPattern:@"apx://inbox/:messageID/:section"];
+    
+    APXDeepLinkMatch *match = [self.router matchURL:[NSURL URLWithString:@"apx://inbox/42/comments?highlight=7&section=ignored"]];
+    
+    XCTAssertEqualObjects(match.parameters, (@{@"messageID": @"42", @"section": @"comments", @"highlight": @"7"}));
+    XCTAssertNil(match.viewController);
+    XCTAssertEqual(self.createdCount, 0);
+}
+
+- (void)testSchemeSpecificPatternsWinOverAnyScheme {
+    [self registerPattern:@"inbox/:messageID"];
+    [self registerPattern:@"apx://inbox/:messageID"];
+    
+    XCTAssertEqualObjects([self patternMatching:@"apx://inbox/42"], @"apx://inbox/:messageID");
+    XCTAssertEqualObjects([self patternMatching:@"other://inbox/42"], @"inbox/:messageID");
+    XCTAssertTrue([self.router routeValue:@"inbox/42"]);
+    XCTAssertEqualObjects([[self.routed firstObject] parameters][@"messageID"], @"42");
+}
+
+- (void)testUnmatchedLinkIsNotRouted {
+    [self registerPattern:@"apx://inbox/:messageID"];
+    
+    XCTAssertNil([self patternMatching:@"apx://settings"]);
+    XCTAssertNil([self patternMatching:@"apx://inbox/42/share"]);
+    XCTAssertFalse([self.router routeURL:[NSURL URLWithString:@"apx://settings"]]);
+    XCTAssertFalse([self.router routeValue:nil]);
+    XCTAssertEqual([self.routed count], 0);
+}
+
+- (void)testSchemeFallbackCatchesUnmatchedLinks {
+    [self registerPattern:@"APXTagsViewController"];
+    [self registerPattern:@"apx://APXTagsViewController"];
+    [self registerPattern:@"apx://*"];
+    
+    XCTAssertEqualObjects([self patternMatching:@"apx://APXTagsViewController"], @"apx://APXTagsViewController");
+    XCTAssertEqualObjects([self patternMatching:@"apx://APXUnknownViewController"], @"apx://*");
+    XCTAssertEqualObjects([self patternMatching:@"apx://scheme/anything"], @"apx://*");
+    XCTAssertTrue([self.router routeURL:[NSURL URLWithString:@"apx://settings"]]);
+    XCTAssertEqualObjects([[self.routed firstObject] pattern], @"apx://*");
+    
+    // Scheme-less OpenViewController values are left alone by the apx:// fallback.
+    XCTAssertFalse([self.router routeValue:@"APXUnknownViewController"]);
+    XCTAssertEqual([self.routed count], 1);
+}
+
+- (void)testPreparedViewControllerIsRouted {
+    [self registerPattern:@"*"];
+    NSURL *URL = [NSURL URLWithString:@"apx://scheme/anything"];
+    
+    UIViewController *prepared = [self.router prepareURL:URL].viewController;
+    XCTAssertNotNil(prepared);
+    
+    XCTAssertTrue([self.router routeURL:URL]);
+    XCTAssertEqual([[self.routed firstObject] viewController], prepared);
+    XCTAssertEqual(self.createdCount, 1);
+    
+    // A prepared screen is used once.
+    XCTAssertTrue([self.router routeURL:URL]);
+    XCTAssertNotEqual([[self.routed lastObject] viewController], prepared);
+    XCTAssertEqual(self.createdCount, 2);
+}
+
+@end
@@ -0,0 +1,87 @@
+//
+//  APXDeviceRegistrationFilterTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <sys/sysctl.h>
+#import "APXDeviceRegistrationFilter.h"
+#import "APXTestDoubles.h"
+
+@interface APXDeviceRegistrationFilterTests : XCTestCase
+
+@property (nonatomic, strong) APXFakeAppoxeeClient *client;
+@property (nonatomic, strong) APXDeviceRegistrationFilter *filter;
+@property (nonatomic, strong) NSData *token;
+
+@end
+
+@implementation APXDeviceRegistrationFilterTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.client = [[APXFakeAppoxeeClient alloc] init];
+    self.filter = [[APXDeviceRegistrationFilter alloc] initWithClient:self.client];
+    self.filter.debounceInterval = 0.0;
+    [self.filter reset];
+    
+    unsigned char bytes[] = {0xab, 0xcd, 0x01, 0x23};
+    self.token = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+}
+
+- (void)tearDown {
+    [self.filter reset];
+    
+    [super tearDown];
+}
+
+- (APXClientDevice *)deviceShowingCurrentState {
+    size_t size = 0;
+    sysctlbyname("hw.machine", NULL, &size, NULL, 0);
+    char machine[size + 1];
+    sysctlbyname("hw.machine", machine, &size, NULL, 0);
+    
+    APXClientDevice *device = [[APXClientDevice alloc] init];
+    device.pushToken = @"<abcd0123>";
+    device.locale = [[[NSLocale preferredLanguages] firstObject] stringByReplacingOccurrencesOfString:@"-" withString:@"_"];
+    device.timeZone = [[NSTimeZone localTimeZone] name];
+    device.osVersion = [[UIDevice currentDevice] systemVersion];
+    device.hardwearType = size ? [NSString stringWithUTF8String:machine] : @"";
+    device.sdkVersion = [Appoxee sdkVersion];
+    
+    return device;
+}
+
+- (void)registerAndWaitForDeviceInformation {
+    [self.filter didRegisterForRemoteNotificationsWithDeviceToken:self.token];
+    
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:1.0];
+    
+    while (![self.client.calls containsObject:@"deviceInformationwithCompletionHandler:"] && [deadline timeIntervalSinceNow] > 0) {
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+    
+    // The acknowledgement is written once the device information arrived.
+    [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
+}
+
+- (void)testFieldsAppoxeeDoesNotShowAreSentAgain {
+    [self registerAndWaitForDeviceInformation];
+    
+    XCTAssertTrue([self.filter.changedFields containsObject:APXDeviceFieldPushToken]);
+    XCTAssertTrue([self.filter.changedFields containsObject:APXDeviceFieldTimeZone]);
+}
+
+- (void)testFieldsAppoxeeShowsAreAcknowledged {
+    self.client.device = [self deviceShowingCurrentState];
+    
+    [self registerAndWaitForDeviceInformation];
+    
+    XCTAssertEqual([self.filter.changedFields count], 0);
+}
+
+@end
@@ -0,0 +1,68 @@
+//
+//  APXInboxChangeSetTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXInboxChangeSet.h"
+#import "APXTestDoubles.h"
+
+@interface APXInboxChangeSetTests : XCTestCase
+
+@end
+
+@implementation APXInboxChangeSetTests
+
+- (NSArray *)messagesWithIDs:(NSArray *)uniqueIDs {
+    NSMutableArray *messages = [[NSMutableArray alloc] init];
+    
+    for (NSNumber *uniqueID in uniqueIDs) {
+        [messages addObject:[APXTestRichMessage messageWithID:[uniqueID integerValue] title:[uniqueID description] isRead:NO]];
+    }
+    
+    return messages;
+}
+
+- (void)testIdenticalSnapshotsAreEmpty {
+    NSArray *messages = [self messagesWithIDs:@[@1, @2, @3]];
+    APXInboxChangeSet *changes = [APXInboxChangeSet changeSetFromMessages:messages toMessages:[self messagesWithIDs:@[@1, @2, @3]]];
+    
+    XCTAssertTrue(changes.isEmpty);
+}
+
+- (void)testInsertsAndDeletes {
+    APXInboxChangeSet *changes = [APXInboxChangeSet changeSetFromMessages:[self messagesWithIDs:@[@1, @2, @3]] toMessages:[self messagesWithIDs:@[@4, @1, @3]]];
+    
+    XCTAssertEqualObjects(changes.deletedIndexes, [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqualObjects(changes.insertedIndexes, [NSIndexSet indexSetWithIndex:0]);
+    XCTAssertEqual([changes.updatedIndexes count], 0);
+    XCTAssertEqual([changes.moves count], 0);
+}
+
+- (void)testReadStateChangeIsAnUpdate {
+    NSArray *oldMessages = @[[APXTestRichMessage messageWithID:1 title:@"a" isRead:NO], [APXTestRichMessage messageWithID:2 title:@"b" isRead:NO]];
+    NSArray *newMessages = @[[APXTestRichMessage messageWithID:1 title:@"a" isRead:NO], [APXTestRichMessage messageWithID:2 title:@"b" isRead:YES]];
+    APXInboxChangeSet *changes = [APXInboxChangeSet changeSetFromMessages:oldMessages toMessages:newMessages];
+    
+    XCTAssertEqualObjects(changes.updatedIndexes, [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqual([changes.insertedIndexes count], 0);
+}
+
+- (void)testOnlyRowsOutOfOrderMove {
+    APXInboxChangeSet *changes = [APXInboxChangeSet changeSetFromMessages:[self messagesWithIDs:@[@1, @2, @3, @4]] toMessages:[self messagesWithIDs:@[@4, @1, @2, @3]]];
+    
+    XCTAssertEqual([changes.moves count], 1);
+    XCTAssertEqual([changes.moves.firstObject fromIndex], 3);
+    XCTAssertEqual([changes.moves.firstObject toIndex], 0);
+}
+
+- (void)testDuplicateIDsDoNotCrash {
+    APXInboxChangeSet *changes = [APXInboxChangeSet changeSetFromMessages:[self messagesWithIDs:@[@1, @1]] toMessages:[self messagesWithIDs:@[@1]]];
+    
+    XCTAssertEqualObjects(changes.deletedIndexes, [NSIndexSet indexSetWithIndex:1]);
+}
+
+@end
@@ -0,0 +1,68 @@
+//
+//  APXInboxRetentionPolicyTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXInboxRetentionPolicy.h"
+#import "APXTestDoubles.h"
+
+@interface APXInboxRetentionPolicyTests : XCTestCase
+
+@property (nonatomic, strong) NSDate *now;
+
+@end
+
+@implementation APXInboxRetentionPolicyTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.now = [NSDate dateWithTimeIntervalSince1970:1500000000];
+}
+
+- (APXRichMessage *)messageWithID:(NSInteger)uniqueID age:(NSTimeInterval)age {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:uniqueID title:@"title" isRead:NO];
+    message.testPostDate = age >= 0 ? [self.now dateByAddingTimeInterval:-age] : nil;
+    
+    return message;
+}
+
+- (void)testDictionaryWithoutLimitsHasNoPolicy {
+    XCTAssertNil([APXInboxRetentionPolicy policyWithDictionary:nil]);
+    XCTAssertNil([APXInboxRetentionPolicy policyWithDictionary:@{APXInboxRetentionMaximumAgeKey : @0}]);
+    XCTAssertNil([APXInboxRetentionPolicy policyWithDictionary:(NSDictionary *)@"inbox_max_age"]);
+    
+    APXInboxRetentionPolicy *policy = [APXInboxRetentionPolicy policyWithDictionary:@{APXInboxRetentionMaximumAgeKey : @3600, APXInboxRetentionMaximumCountKey : @"many"}];
+    XCTAssertEqual(policy.maximumAge, 3600.0);
+    XCTAssertEqual(policy.maximumCount, 0);
+}
+
+- (void)testOldMessagesExpire {
+    APXInboxRetentionPolicy *policy = [[APXInboxRetentionPolicy alloc] initWithMaximumAge:100.0 maximumCount:0];
+    NSArray *messages = @[[self messageWithID:1 age:10], [self messageWithID:2 age:500], [self messageWithID:3 age:-1]];
+    
+    XCTAssertEqualObjects([policy expiredIndexesOfMessages:messages atDate:self.now], [NSIndexSet indexSetWithIndex:1]);
+}
+
+- (void)testOldestMessagesBeyondTheCountExpire {
+    APXInboxRetentionPolicy *policy = [[APXInboxRetentionPolicy alloc] initWithMaximumAge:0.0 maximumCount:2];
+    NSArray *messages = @[[self messageWithID:1 age:30], [self messageWithID:2 age:10], [self messageWithID:3 age:-1], [self messageWithID:4 age:20]];
+    
+    NSMutableIndexSet *expected = [NSMutableIndexSet indexSetWithIndex:0];
+    [expected addIndex:2];
+    
+    XCTAssertEqualObjects([policy expiredIndexesOfMessages:messages atDate:self.now], expected);
+}
+
+- (void)testCountAppliesToMessagesTheAgeKept {
+    APXInboxRetentionPolicy *policy = [[APXInboxRetentionPolicy alloc] initWithMaximumAge:100.0 maximumCount:2];
+    NSArray *messages = @[[self messageWithID:1 age:500], [self messageWithID:2 age:10], [self messageWithID:3 age:20]];
+    
+    XCTAssertEqualObjects([policy expiredIndexesOfMessages:messages atDate:self.now], [NSIndexSet indexSetWithIndex:0]);
+}
+
+@end
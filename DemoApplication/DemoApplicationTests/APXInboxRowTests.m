@@ -0,0 +1,66 @@
+//
+//  APXInboxRowTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXInboxRow.h"
+#import "APXTestDoubles.h"
+
+@interface APXInboxRowTests : XCTestCase
+
+@end
+
+@implementation APXInboxRowTests
+
+- (APXInboxRow *)rowForContent:(NSString *)content {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:1 title:@"Title" isRead:NO];
+    message.testContent = content;
+    
+    return [APXInboxRow rowForMessage:message];
+}
+
+- (void)testRowCopiesWhatTheListShows {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:7 title:@"Sale" isRead:YES];
+    message.testContent = @"50% off";
+    message.testPostDate = [NSDate dateWithTimeIntervalSince1970:1500000000];
+    
+    APXInboxRow *row = [APXInboxRow rowForMessage:message];
+    
+    XCTAssertEqual(row.uniqueID, 7);
+    XCTAssertEqualObjects(row.title, @"Sale");
+    XCTAssertEqualObjects(row.snippet, @"50% off");
+    XCTAssertEqualObjects(row.postDate, message.testPostDate);
+    XCTAssertTrue([row.postDateString length] > 0);
+    XCTAssertTrue(row.isRead);
+}
+
+- (void)testSnippetDropsMarkupAndWhitespace {
+    XCTAssertEqualObjects([self rowForContent:@"<h1>Hello</h1>\n\n  <p>big   <b>world</b></p>"].snippet, @"Hello big world");
+    XCTAssertEqualObjects([self rowForContent:nil].snippet, @"");
+    XCTAssertEqualObjects([self rowForContent:@"<br/>"].snippet, @"");
+}
+
+- (void)testLongContentIsTruncated {
+    NSMutableString *content = [[NSMutableString alloc] init];
+    
+    for (NSUInteger i = 0; i < 10000; i++) {
+        [content appendString:@"word "];
+    }
+    
+    [content appendString:@"<a href=\"https://example.com\">link</a>"];
+    
+    NSString *snippet = [self rowForContent:content].snippet;
+    
+    XCTAssertEqual([snippet length], [APXInboxRow snippetLength]);
+    XCTAssertTrue([snippet hasSuffix:@"…"]);
+}
+
+- (void)testMissingPostDateHasAnEmptyString {
+    XCTAssertEqualObjects([self rowForContent:@"text"].postDateString, @"");
+}
+
+@end
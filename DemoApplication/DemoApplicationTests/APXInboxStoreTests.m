@@ -0,0 +1,293 @@
+//
+//  APXInboxStoreTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXInboxStore.h"
+#import "APXTestDoubles.h"
+
+@interface APXInboxStoreTests : XCTestCase
+
+@property (nonatomic, strong) APXFakeAppoxeeClient *client;
+@property (nonatomic, strong) APXInboxStore *store;
+
+@end
+
+@implementation APXInboxStoreTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.client = [[APXFakeAppoxeeClient alloc] init];
+    self.client.messages = @[[APXTestRichMessage messageWithID:1 title:@"a" isRead:NO], [APXTestRichMessage messageWithID:2 title:@"b" isRead:NO]];
+    self.store = [[APXInboxStore alloc] initWithClient:self.client];
+}
+
+- (void)testRefreshDeliversInserts {
+    XCTestExpectation *delivered = [self expectationWithDescription:@"change set"];
+    
+    [self.store addObserverWithBlock:^(APXInboxChangeSet *changes) {
+        XCTAssertEqualObjects(changes.insertedIndexes, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 2)]);
+        [delivered fulfill];
+    }];
+    
+    [self.store refreshWithCompletionHandler:nil];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual([self.store.messages count], 2);
+}
+
+- (void)testRowsAreFormattedAgainWhenTheDayChanges {
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:2];
+    
+    NSArray *rows = self.store.rows;
+    XCTestExpectation *delivered = [self expectationWithDescription:@"change set"];
+    
+    [self.store addObserverWithBlock:^(APXInboxChangeSet *changes) {
+        XCTAssertEqualObjects(changes.updatedIndexes, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 2)]);
+        XCTAssertEqual([changes.insertedIndexes count] + [changes.deletedIndexes count] + [changes.moves count], 0);
+        [delivered fulfill];
+    }];
+    
+    [[NSNotificationCenter defaultCenter] postNotificationName:NSCalendarDayChangedNotification object:nil];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertFalse(self.store.rows[0] == rows[0]);
+    XCTAssertEqual([self.store.rows[1] uniqueID], [rows[1] uniqueID]);
+}
+
+- (void)testMutationsInOneRunLoopTurnAreCoalesced {
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:2];
+    
+    __block NSUInteger deliveries = 0;
+    
+    [self.store addObserverWithBlock:^(APXInboxChangeSet *changes) {
+        deliveries++;
+        XCTAssertEqualObjects(changes.deletedIndexes, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 2)]);
+    }];
+    
+    [self.store deleteMessages:@[self.store.messages[0]]];
+    [self.store deleteMessages:@[self.store.messages[1]]];
+    
+    [self waitUntilMessagesCount:0];
+    XCTAssertEqual(deliveries, 1);
+    XCTAssertEqual([[self.client.calls filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"SELF BEGINSWITH 'deleteRichMessage'"]] count], 2);
+}
+
+- (void)testSyncDoesNotBringBackPendingDeletions {
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:2];
+    
+    // The deletion is still on its way when the SDK's cache is read again.
+    self.client.backend.latency = 0.5;
+    [self.store deleteMessages:@[self.store.messages[0]]];
+    [self waitUntilMessagesCount:1];
+    
+    XCTestExpectation *reloaded = [self expectationWithDescription:@"reload"];
+    
+    [self.store reloadFromCacheWithCompletionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertEqual([data count], 2);
+        [reloaded fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    [self waitUntilMessagesCount:1];
+    XCTAssertEqual([self.store.messages[0] uniqueID], 2);
+}
+
+- (void)testMarkingAsReadGoesThroughTheSDK {
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:2];
+    
+    APXTestRichMessage *message = self.store.messages[0];
+    [self.store markMessageAsRead:message];
+    [self.store markMessageAsRead:message];
+    
+    XCTAssertTrue(message.isRead);
+    XCTAssertEqual(message.messageLinkReadCount, 1);
+    XCTAssertEqual([[self.client.calls filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"SELF BEGINSWITH 'getRichMessages'"]] count], 1);
+}
+
+- (void)testRemovedObserverIsNotCalled {
+    id token = [self.store addObserverWithBlock:^(APXInboxChangeSet *changes) {
+        XCTFail(@"observer was removed");
+    }];
+    
+    [self.store removeObserver:token];
+    [self.store refreshWithCompletionHandler:nil];
+    
+    [self waitUntilMessagesCount:2];
+}
+
+- (void)testRowsOfUnchangedMessagesAreReused {
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:2];
+    
+    NSArray *rows = self.store.rows;
+    XCTAssertEqual([rows count], 2);
+    XCTAssertEqualObjects([rows[1] title], @"b");
+    XCTAssertTrue([self.store messageWithID:2] == self.store.messages[1]);
+    XCTAssertNil([self.store messageWithID:3]);
+    
+    self.client.messages = @[[APXTestRichMessage messageWithID:1 title:@"a" isRead:NO], [APXTestRichMessage messageWithID:2 title:@"b" isRead:YES]];
+    [self.store refreshWithCompletionHandler:nil];
+    
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:1.0];
+    
+    while (![self.store.rows[1] isRead] && [deadline timeIntervalSinceNow] > 0) {
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+    
+    XCTAssertTrue([self.store.rows[1] isRead]);
+    XCTAssertTrue(self.store.rows[0] == rows[0]);
+    XCTAssertTrue([self.store messageWithID:2] == self.store.messages[1]);
+}
+
+- (void)testSnapshotCanBeReadFromAnyThread {
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:2];
+    
+    NSArray *twoMessages = self.client.messages;
+    NSArray *threeMessages = [twoMessages arrayByAddingObject:[APXTestRichMessage messageWithID:3 title:@"c" isRead:NO]];
+    APXInboxStore *store = self.store;
+    __block NSUInteger inconsistentReads = 0;
+    
+    dispatch_group_t readers = dispatch_group_create();
+    
+    for (NSUInteger reader = 0; reader < 4; reader++) {
+        dispatch_group_async(readers, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            for (NSUInteger i = 0; i < 5000; i++) {
+                NSUInteger rowCount = [store.rows count];
+                APXRichMessage *message = [store messageWithID:3];
+                
+                if ((rowCount != 2 && rowCount != 3) || (message && message.uniqueID != 3)) {
+                    @synchronized (store) {
+                        inconsistentReads++;
+                    }
+                }
+            }
+        });
+    }
+    
+    // The main queue keeps publishing snapshots with and without the third message while the readers run.
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:10.0];
+    NSUInteger refreshes = 0;
+    
+    while (dispatch_group_wait(readers, DISPATCH_TIME_NOW) && [deadline timeIntervalSinceNow] > 0) {
+        self.client.messages = refreshes++ % 2 ? twoMessages : threeMessages;
+        [self.store refreshWithCompletionHandler:nil];
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.001]];
+    }
+    
+    XCTAssertEqual(dispatch_group_wait(readers, DISPATCH_TIME_NOW), 0);
+    XCTAssertEqual(inconsistentReads, 0);
+}
+
+- (void)testExpiredMessagesAreLeftOutAndCollected {
+    NSMutableArray *messages = [[NSMutableArray alloc] init];
+    
+    for (NSInteger uniqueID = 1; uniqueID <= 25; uniqueID++) {
+        APXTestRichMessage *message = [APXTestRichMessage messageWithID:uniqueID title:@"title" isRead:NO];
+        message.testPostDate = [NSDate dateWithTimeIntervalSinceNow:-uniqueID * 60.0];
+        [messages addObject:message];
+    }
+    
+    self.client.messages = messages;
+    self.store.retentionPolicy = [[APXInboxRetentionPolicy alloc] initWithMaximumAge:0.0 maximumCount:3];
+    
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:3];
+    
+    XCTAssertEqualObjects([self.store.messages valueForKey:@"uniqueID"], (@[@1, @2, @3]));
+    XCTAssertEqual(self.store.expiredMessageCount, 22);
+    
+    XCTestExpectation *collected = [self expectationWithDescription:@"collect"];
+    
+    [self.store collectExpiredMessagesWithTimeBudget:5.0 completionHandler:^(NSUInteger collectedCount, BOOL finished) {
+        XCTAssertEqual(collectedCount, 22);
+        XCTAssertTrue(finished);
+        [collected fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    
+    XCTAssertEqual([self.client.messages count], 3);
+    XCTAssertEqual(self.store.expiredMessageCount, 0);
+}
+
+- (void)testCollectionStopsWhenTheBudgetRunsOut {
+    NSMutableArray *messages = [[NSMutableArray alloc] init];
+    
+    for (NSInteger uniqueID = 1; uniqueID <= 25; uniqueID++) {
+        [messages addObject:[APXTestRichMessage messageWithID:uniqueID title:@"title" isRead:NO]];
+    }
+    
+    self.client.messages = messages;
+    self.store.retentionPolicy = [[APXInboxRetentionPolicy alloc] initWithMaximumAge:0.0 maximumCount:1];
+    
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:1];
+    
+    XCTestExpectation *collected = [self expectationWithDescription:@"collect"];
+    
+    // No batch starts once the budget has run out.
+    [self.store collectExpiredMessagesWithTimeBudget:0.0 completionHandler:^(NSUInteger collectedCount, BOOL finished) {
+        XCTAssertEqual(collectedCount, 0);
+        XCTAssertFalse(finished);
+        [collected fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    
+    XCTAssertEqual(self.store.expiredMessageCount, 24);
+}
+
+- (void)testFailedCollectionIsRetried {
+    self.client.messages = @[[APXTestRichMessage messageWithID:1 title:@"a" isRead:NO], [APXTestRichMessage messageWithID:2 title:@"b" isRead:NO]];
+    self.store.retentionPolicy = [[APXInboxRetentionPolicy alloc] initWithMaximumAge:0.0 maximumCount:1];
+    
+    [self.store refreshWithCompletionHandler:nil];
+    [self waitUntilMessagesCount:1];
+    
+    self.client.error = [NSError errorWithDomain:@"test" code:1 userInfo:nil];
+    XCTestExpectation *failed = [self expectationWithDescription:@"failed"];
+    
+    [self.store collectExpiredMessagesWithTimeBudget:5.0 completionHandler:^(NSUInteger collectedCount, BOOL finished) {
+        XCTAssertEqual(collectedCount, 0);
+        XCTAssertFalse(finished);
+        [failed fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertEqual(self.store.expiredMessageCount, 1);
+    
+    self.client.error = nil;
+    XCTestExpectation *collected = [self expectationWithDescription:@"collected"];
+    
+    [self.store collectExpiredMessagesWithTimeBudget:5.0 completionHandler:^(NSUInteger collectedCount, BOOL finished) {
+        XCTAssertEqual(collectedCount, 1);
+        XCTAssertTrue(finished);
+        [collected fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertEqual([self.client.messages count], 1);
+}
+
+- (void)waitUntilMessagesCount:(NSUInteger)count {
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:1.0];
+    
+    while ([self.store.messages count] != count && [deadline timeIntervalSinceNow] > 0) {
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+    
+    XCTAssertEqual([self.store.messages count], count);
+}
+
+@end
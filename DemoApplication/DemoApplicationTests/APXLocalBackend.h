@@ -0,0 +1,61 @@
+//
+//  APXLocalBackend.h
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+
+extern NSString * const APXLocalBackendErrorDomain;
+
+typedef NS_ENUM(NSInteger, APXLocalBackendError) {
+    APXLocalBackendErrorUnavailable = 503, // injected by 'failureRate'
+    APXLocalBackendErrorThrottled = 429 // over 'requestsPerSecondPerDevice' or 'maximumConcurrentRequests'
+};
+
+// Operation names, used for the request counts.
+extern NSString * const APXLocalBackendOperationRegistration;
+extern NSString * const APXLocalBackendOperationDeviceInfo;
+extern NSString * const APXLocalBackendOperationFetch;
+extern NSString * const APXLocalBackendOperationInbox;
+extern NSString * const APXLocalBackendOperationAlias;
+extern NSString * const APXLocalBackendOperationTags;
+extern NSString * const APXLocalBackendOperationCustomFields;
+
+typedef id(^APXLocalBackendHandler)(NSMutableDictionary *deviceState);
+
+// An in-process stand-in for the Appoxee servers, shared by any number of simulated devices.
+// Every request waits 'latency' plus up to 'latencyJitter', may fail or be throttled as configured, and then runs its handler
+// against the device's state on the backend's serial queue, the way a single server instance would serialize them.
+@interface APXLocalBackend : NSObject
+
+@property (atomic) NSTimeInterval latency;
+@property (atomic) NSTimeInterval latencyJitter;
+@property (atomic) double failureRate; // 0...1
+@property (atomic) NSUInteger requestsPerSecondPerDevice; // 0 is unlimited
+@property (atomic) NSUInteger maximumConcurrentRequests; // 0 is unlimited
+
+- (void)performOperation:(NSString *)operation forDevice:(NSString *)deviceID handler:(APXLocalBackendHandler)handler completion:(AppoxeeCompletionHandler)completion;
+
+// Synchronous access to a device's state, for setting up and checking tests.
+- (id)objectForKey:(NSString *)key inDevice:(NSString *)deviceID;
+- (void)setObject:(id)object forKey:(NSString *)key inDevice:(NSString *)deviceID;
+
+#pragma mark - Statistics
+
+@property (atomic, readonly) NSUInteger requestCount;
+@property (atomic, readonly) NSUInteger throttledCount;
+@property (atomic, readonly) NSUInteger failedCount;
+@property (nonatomic, readonly) NSUInteger deviceCount;
+
+- (NSDictionary *)requestCountsByOperation; // operation -> NSNumber
+
+// Latency as seen by the caller, from the request to its completion, in seconds. percentile is 0...1.
+- (NSTimeInterval)latencyAtPercentile:(double)percentile;
+
+- (void)resetStatistics;
+
+@end
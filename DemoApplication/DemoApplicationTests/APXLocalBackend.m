@@ -0,0 +1,220 @@
+//
+//  APXLocalBackend.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXLocalBackend.h"
+
+NSString * const APXLocalBackendErrorDomain = @"APXLocalBackendErrorDomain";
+
+NSString * const APXLocalBackendOperationRegistration = @"registration";
+NSString * const APXLocalBackendOperationDeviceInfo = @"device_info";
+NSString * const APXLocalBackendOperationFetch = @"fetch";
+NSString * const APXLocalBackendOperationInbox = @"inbox";
+NSString * const APXLocalBackendOperationAlias = @"alias";
+NSString * const APXLocalBackendOperationTags = @"tags";
+NSString * const APXLocalBackendOperationCustomFields = @"custom_fields";
+
+@interface APXLocalBackend ()
+
+@property (nonatomic, strong) dispatch_queue_t queue; // guards everything below
+@property (nonatomic, strong) NSMutableDictionary *devices; // device ID -> NSMutableDictionary
+@property (nonatomic, strong) NSMutableDictionary *recentRequests; // device ID -> NSMutableArray of NSDate, within the last second
+@property (nonatomic, strong) NSMutableDictionary *operationCounts;
+@property (nonatomic, strong) NSMutableArray *latencies;
+@property (nonatomic) NSUInteger concurrentRequests;
+@property (atomic, readwrite) NSUInteger requestCount;
+@property (atomic, readwrite) NSUInteger throttledCount;
+@property (atomic, readwrite) NSUInteger failedCount;
+
+@end
+
+@implementation APXLocalBackend
+
+- (instancetype)init {
+    self = [super init];
+    
+    if (self) {
+        
+        _queue = dispatch_queue_create("com.appoxee.demo.local-backend", DISPATCH_QUEUE_SERIAL);
+        _devices = [[NSMutableDictionary alloc] init];
+        _recentRequests = [[NSMutableDictionary alloc] init];
+        _operationCounts = [[NSMutableDictionary alloc] init];
+        _latencies = [[NSMutableArray alloc] init];
+    }
+    
+    return self;
+}
+
+#pragma mark - Requests
+
+- (void)performOperation:(NSString *)operation forDevice:(NSString *)deviceID handler:(APXLocalBackendHandler)handler completion:(AppoxeeCompletionHandler)completion {
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    __block BOOL isThrottled = NO;
+    
+    dispatch_sync(self.queue, ^{
+        self.requestCount++;
+        self.operationCounts[operation] = @([self.operationCounts[operation] unsignedIntegerValue] + 1);
+        
+        isThrottled = [self shouldThrottleDevice:deviceID];
+        
+        if (isThrottled) {
+            
+            self.throttledCount++;
+            
+        } else {
+            
+            self.concurrentRequests++;
+        }
+    });
+    
+    if (isThrottled) {
+        
+        [self completeRequestStartedAt:start error:[NSError errorWithDomain:APXLocalBackendErrorDomain code:APXLocalBackendErrorThrottled userInfo:nil] data:nil completion:completion];
+        return;
+    }
+    
+    NSTimeInterval delay = self.latency + self.latencyJitter * arc4random_uniform(1001) / 1000.0;
+    BOOL shouldFail = self.failureRate > 0 && arc4random_uniform(10000) < self.failureRate * 10000;
+    
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        __block id data = nil;
+        
+        dispatch_sync(self.queue, ^{
+            self.concurrentRequests--;
+            
+            if (shouldFail) {
+                
+                self.failedCount++;
+                
+            } else if (handler) {
+                
+                data = handler([self stateForDevice:deviceID]);
+            }
+        });
+        
+        NSError *error = shouldFail ? [NSError errorWithDomain:APXLocalBackendErrorDomain code:APXLocalBackendErrorUnavailable userInfo:nil] : nil;
+        [self completeRequestStartedAt:start error:error data:data completion:completion];
+    });
+}
+
+- (void)completeRequestStartedAt:(CFAbsoluteTime)start error:(NSError *)error data:(id)data completion:(AppoxeeCompletionHandler)completion {
+    NSTimeInterval latency = CFAbsoluteTimeGetCurrent() - start;
+    
+    dispatch_async(self.queue, ^{
+        [self.latencies addObject:@(latency)];
+    });
+    
+    if (completion) completion(error, data);
+}
+
+- (BOOL)shouldThrottleDevice:(NSString *)deviceID
+/*
+  Called on 'queue'.
+*/
+{
+    if (self.maximumConcurrentRequests && self.concurrentRequests >= self.maximumConcurrentRequests) return YES;
+    
+    if (!self.requestsPerSecondPerDevice) return NO;
+    
+    NSMutableArray *recent = self.recentRequests[deviceID];
+    
+    if (!recent) {
+        
+        recent = [[NSMutableArray alloc] init];
+        self.recentRequests[deviceID] = recent;
+    }
+    
+    NSDate *now = [NSDate date];
+    
+    while ([recent count] && [now timeIntervalSinceDate:recent[0]] > 1.0) {
+        [recent removeObjectAtIndex:0];
+    }
+    
+    if ([recent count] >= self.requestsPerSecondPerDevice) return YES;
+    
+    [recent addObject:now];
+    
+    return NO;
+}
+
+#pragma mark - State
+
+- (NSMutableDictionary *)stateForDevice:(NSString *)deviceID {
+    NSMutableDictionary *state = self.devices[deviceID];
+    
+    if (!state) {
+        
+        state = [[NSMutableDictionary alloc] init];
+        self.devices[deviceID] = state;
+    }
+    
+    return state;
+}
+
+- (id)objectForKey:(NSString *)key inDevice:(NSString *)deviceID {
+    __block id object = nil;
+    
+    dispatch_sync(self.queue, ^{
+        object = [self stateForDevice:deviceID][key];
+    });
+    
+    return object;
+}
+
+- (void)setObject:(id)object forKey:(NSString *)key inDevice:(NSString *)deviceID {
+    dispatch_sync(self.queue, ^{
+        [self stateForDevice:deviceID][key] = object;
+    });
+}
+
+#pragma mark - Statistics
+
+- (NSUInteger)deviceCount {
+    __block NSUInteger count = 0;
+    
+    dispatch_sync(self.queue, ^{
+        count = [self.devices count];
+    });
+    
+    return count;
+}
+
+- (NSDictionary *)requestCountsByOperation {
+    __block NSDictionary *counts = nil;
+    
+    dispatch_sync(self.queue, ^{
+        counts = [self.operationCounts copy];
+    });
+    
+    return counts;
+}
+
+- (NSTimeInterval)latencyAtPercentile:(double)percentile {
+    __block NSArray *latencies = nil;
+    
+    dispatch_sync(self.queue, ^{
+        latencies = [self.latencies sortedArrayUsingSelector:@selector(compare:)];
+    });
+    
+    if (![latencies count]) return 0;
+    
+    NSUInteger index = MIN((NSUInteger)ceil(percentile * [latencies count]), [latencies count]);
+    
+    return [latencies[MAX(index, (NSUInteger)1) - 1] doubleValue];
+}
+
+- (void)resetStatistics {
+    dispatch_sync(self.queue, ^{
+        self.requestCount = 0;
+        self.throttledCount = 0;
+        self.failedCount = 0;
+        [self.operationCounts removeAllObjects];
+        [self.latencies removeAllObjects];
+    });
+}
+
+@end
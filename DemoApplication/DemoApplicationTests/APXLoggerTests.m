@@ -0,0 +1,66 @@
+//
+//  APXLoggerTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXLogger.h"
+
+@interface APXLoggerTests : XCTestCase
+
+@end
+
+@implementation APXLoggerTests
+
+- (NSArray *)messagesContaining:(NSString *)marker {
+    NSMutableArray *messages = [[NSMutableArray alloc] init];
+    
+    [[APXLogger sharedLogger] flush];
+    
+    for (NSURL *url in [[APXLogger sharedLogger] logFileURLs]) {
+        for (NSDictionary *record in [APXLogger recordsInLogFileAtURL:url]) {
+            if ([record[APXLogRecordMessageKey] containsString:marker]) [messages addObject:record[APXLogRecordMessageKey]];
+        }
+    }
+    
+    return messages;
+}
+
+- (void)testRecordsRoundTripThroughTheLogFile {
+    NSString *marker = [[NSUUID UUID] UUIDString];
+    
+    APXLogError(APXLogSubsystemInbox, @"%@ error", marker);
+    APXLogInfo(APXLogSubsystemInbox, @"%@ info", marker);
+    
+    XCTAssertEqualObjects([self messagesContaining:marker], (@[[marker stringByAppendingString:@" error"], [marker stringByAppendingString:@" info"]]));
+}
+
+- (void)testSubsystemLevelFiltersRecords {
+    NSString *marker = [[NSUUID UUID] UUIDString];
+    APXLogger *logger = [APXLogger sharedLogger];
+    APXLogLevel level = [logger levelForSubsystem:APXLogSubsystemPush];
+    
+    [logger setLevel:APXLogLevelWarning forSubsystem:APXLogSubsystemPush];
+    APXLogInfo(APXLogSubsystemPush, @"%@ filtered", marker);
+    APXLogInfo(APXLogSubsystemNetwork, @"%@ kept", marker);
+    [logger setLevel:level forSubsystem:APXLogSubsystemPush];
+    
+    XCTAssertEqualObjects([self messagesContaining:marker], @[[marker stringByAppendingString:@" kept"]]);
+}
+
+- (void)testRecordsFromManyThreadsAreKept {
+    NSString *marker = [[NSUUID UUID] UUIDString];
+    
+    dispatch_apply(8, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        for (NSUInteger i = 0; i < 16; i++) {
+            APXLogInfo(APXLogSubsystemStorage, @"%@ %zu-%lu", marker, iteration, (unsigned long)i);
+        }
+    });
+    
+    XCTAssertEqual([[self messagesContaining:marker] count], 8 * 16);
+}
+
+@end
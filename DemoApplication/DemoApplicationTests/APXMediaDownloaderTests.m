@@ -0,0 +1,245 @@
+//
+//  APXMediaDownloaderTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXMediaDownloader.h"
+
+static NSMutableDictionary *APXMediaTestResources; // URL string -> NSData
+static NSMutableArray *APXMediaTestRequests; // of Type NSURLRequest
+static NSUInteger APXMediaTestStallAfterBytes; // 0 serves everything
+
+// Serves APXMediaTestResources with an ETag, and honours Range / If-Range.
+@interface APXMediaTestURLProtocol : NSURLProtocol
+
+@end
+
+@implementation APXMediaTestURLProtocol
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request {
+    return YES;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request {
+    return request;
+}
+
+- (void)startLoading {
+    NSData *data = nil;
+    NSUInteger stallAfterBytes = 0;
+    
+    @synchronized (APXMediaTestResources) {
+        [APXMediaTestRequests addObject:self.request];
+        data = APXMediaTestResources[[self.request.URL absoluteString]];
+        stallAfterBytes = APXMediaTestStallAfterBytes;
+    }
+    
+    if (!data) {
+        [self.client URLProtocol:self didReceiveResponse:[[NSHTTPURLResponse alloc] initWithURL:self.request.URL statusCode:404 HTTPVersion:@"HTTP/1.1" headerFields:@{}] cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+        [self.client URLProtocolDidFinishLoading:self];
+        return;
+    }
+    
+    NSString *etag = [NSString stringWithFormat:@"\"%lu\"", (unsigned long)[data hash]];
+    NSString *range = [self.request valueForHTTPHeaderField:@"Range"];
+    NSUInteger offset = 0;
+    NSInteger statusCode = 200;
+    NSMutableDictionary *headers = [@{@"ETag" : etag} mutableCopy];
+    
+    if (range && [[self.request valueForHTTPHeaderField:@"If-Range"] isEqualToString:etag]) {
+        offset = (NSUInteger)[[[range stringByReplacingOccurrencesOfString:@"bytes=" withString:@""] stringByReplacingOccurrencesOfString:@"-" withString:@""] integerValue];
+        statusCode = 206;
+        headers[@"Content-Range"] = [NSString stringWithFormat:@"bytes %lu-%lu/%lu", (unsigned long)offset, (unsigned long)[data length] - 1, (unsigned long)[data length]];
+    }
+    
+    NSData *body = [data subdataWithRange:NSMakeRange(offset, [data length] - offset)];
+    headers[@"Content-Length"] = [NSString stringWithFormat:@"%lu", (unsigned long)[body length]];
+    
+    [self.client URLProtocol:self didReceiveResponse:[[NSHTTPURLResponse alloc] initWithURL:self.request.URL statusCode:statusCode HTTPVersion:@"HTTP/1.1" headerFields:headers] cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    
+    if (stallAfterBytes && stallAfterBytes < [body length]) {
+        // Never finishes, like a connection which dropped to a crawl.
+        [self.client URLProtocol:self didLoadData:[body subdataWithRange:NSMakeRange(0, stallAfterBytes)]];
+        return;
+    }
+    
+    [self.client URLProtocol:self didLoadData:body];
+    [self.client URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading {
+}
+
+@end
+
+@interface APXMediaDownloaderTests : XCTestCase
+
+@property (nonatomic, strong) NSURL *cacheDirectoryURL;
+@property (nonatomic, strong) APXMediaDownloader *downloader;
+
+@end
+
+@implementation APXMediaDownloaderTests
+
+- (void)setUp {
+    [super setUp];
+    
+    APXMediaTestResources = [[NSMutableDictionary alloc] init];
+    APXMediaTestRequests = [[NSMutableArray alloc] init];
+    APXMediaTestStallAfterBytes = 0;
+    
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[[APXMediaTestURLProtocol class]];
+    
+    self.cacheDirectoryURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    self.downloader = [[APXMediaDownloader alloc] initWithCacheDirectoryURL:self.cacheDirectoryURL configuration:configuration];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:self.cacheDirectoryURL error:nil];
+    
+    [super tearDown];
+}
+
+- (NSData *)dataOfLength:(NSUInteger)length seed:(uint8_t)seed {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    uint8_t *bytes = data.mutableBytes;
+    
+    for (NSUInteger i = 0; i < length; i++) {
+        bytes[i] = (uint8_t)(i * 31 + seed);
+    }
+    
+    return data;
+}
+
+- (NSURL *)downloadURL:(NSString *)string timeout:(NSTimeInterval)timeout error:(NSError **)error {
+    XCTestExpectation *finished = [self expectationWithDescription:string];
+    __block NSURL *result = nil;
+    __block NSError *resultError = nil;
+    
+    [self.downloader downloadMediaAtURL:[NSURL URLWithString:string] deadline:[NSDate dateWithTimeIntervalSinceNow:timeout] completionHandler:^(NSURL *fileURL, NSError *downloadError) {
+        XCTAssertTrue([NSThread isMainThread]);
+        result = fileURL;
+        resultError = downloadError;
+        [finished fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:timeout + 2.0 handler:nil];
+    
+    if (error) *error = resultError;
+    
+    return result;
+}
+
+- (NSArray *)cachedFiles {
+    NSArray *contents = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:[self.cacheDirectoryURL path] error:NULL];
+    
+    return [contents filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"NOT (SELF ENDSWITH '.plist') AND NOT (SELF ENDSWITH '.part')"]];
+}
+
+- (void)testSecondDownloadIsServedFromTheCache {
+    NSData *data = [self dataOfLength:100000 seed:1];
+    APXMediaTestResources[@"https://cdn.example.com/a.jpg"] = data;
+    
+    NSURL *first = [self downloadURL:@"https://cdn.example.com/a.jpg" timeout:2.0 error:NULL];
+    NSURL *second = [self downloadURL:@"https://cdn.example.com/a.jpg" timeout:2.0 error:NULL];
+    
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:first], data);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:second], data);
+    XCTAssertNotEqualObjects(first, second);
+    XCTAssertEqual([APXMediaTestRequests count], 1);
+}
+
+- (void)testFileOverTheCapIsRejected {
+    self.downloader.maximumBytesPerFile = 1000;
+    APXMediaTestResources[@"https://cdn.example.com/large.jpg"] = [self dataOfLength:5000 seed:2];
+    
+    NSError *error = nil;
+    NSURL *fileURL = [self downloadURL:@"https://cdn.example.com/large.jpg" timeout:2.0 error:&error];
+    
+    XCTAssertNil(fileURL);
+    XCTAssertEqual(error.code, APXMediaDownloaderErrorTooLarge);
+    XCTAssertEqual([[self cachedFiles] count], 0);
+}
+
+- (void)testSameContentUnderTwoURLsIsStoredOnce {
+    NSData *data = [self dataOfLength:20000 seed:3];
+    APXMediaTestResources[@"https://cdn.example.com/campaign1/banner.png"] = data;
+    APXMediaTestResources[@"https://cdn.example.com/campaign2/banner.png"] = data;
+    
+    [self downloadURL:@"https://cdn.example.com/campaign1/banner.png" timeout:2.0 error:NULL];
+    [self downloadURL:@"https://cdn.example.com/campaign2/banner.png" timeout:2.0 error:NULL];
+    
+    XCTAssertEqual([[self cachedFiles] count], 1);
+}
+
+- (void)testDeadlineKeepsThePartialFileForAResume {
+    NSData *data = [self dataOfLength:50000 seed:4];
+    APXMediaTestResources[@"https://cdn.example.com/video.mp4"] = data;
+    APXMediaTestStallAfterBytes = 20000;
+    
+    NSError *error = nil;
+    XCTAssertNil([self downloadURL:@"https://cdn.example.com/video.mp4" timeout:0.3 error:&error]);
+    XCTAssertEqual(error.code, APXMediaDownloaderErrorDeadlineExceeded);
+    
+    APXMediaTestStallAfterBytes = 0;
+    NSURL *fileURL = [self downloadURL:@"https://cdn.example.com/video.mp4" timeout:2.0 error:&error];
+    
+    XCTAssertNil(error);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:fileURL], data);
+    XCTAssertEqualObjects([[APXMediaTestRequests lastObject] valueForHTTPHeaderField:@"Range"], @"bytes=20000-");
+}
+
+- (void)testDownloadersSharingTheCacheKeepEachOthersEntries {
+    APXMediaTestResources[@"https://cdn.example.com/app.jpg"] = [self dataOfLength:10000 seed:5];
+    APXMediaTestResources[@"https://cdn.example.com/extension.jpg"] = [self dataOfLength:10000 seed:6];
+    
+    // Like the app and its notification service extension, both read the index before either downloaded anything.
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[[APXMediaTestURLProtocol class]];
+    
+    APXMediaDownloader *app = self.downloader;
+    APXMediaDownloader *extension = [[APXMediaDownloader alloc] initWithCacheDirectoryURL:self.cacheDirectoryURL configuration:configuration];
+    
+    [self downloadURL:@"https://cdn.example.com/app.jpg" timeout:2.0 error:NULL];
+    
+    self.downloader = extension;
+    [self downloadURL:@"https://cdn.example.com/extension.jpg" timeout:2.0 error:NULL];
+    XCTAssertNotNil([self downloadURL:@"https://cdn.example.com/app.jpg" timeout:2.0 error:NULL]);
+    
+    self.downloader = app;
+    XCTAssertNotNil([self downloadURL:@"https://cdn.example.com/extension.jpg" timeout:2.0 error:NULL]);
+    
+    XCTAssertEqual([APXMediaTestRequests count], 2);
+}
+
+- (void)testStalePartialFilesAreRemoved {
+    APXMediaTestResources[@"https://cdn.example.com/a.jpg"] = [self dataOfLength:1000 seed:7];
+    NSURL *partialURL = [self.cacheDirectoryURL URLByAppendingPathComponent:@"orphan-1234.part"];
+    [[NSData dataWithBytes:"partial" length:7] writeToURL:partialURL atomically:NO];
+    
+    [self downloadURL:@"https://cdn.example.com/a.jpg" timeout:2.0 error:NULL];
+    
+    // The cache is trimmed after the waiters were answered, a cache hit is queued behind it.
+    [self downloadURL:@"https://cdn.example.com/a.jpg" timeout:2.0 error:NULL];
+    
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:[partialURL path]]);
+}
+
+- (void)testNotificationWithoutMedia {
+    XCTestExpectation *finished = [self expectationWithDescription:@"download"];
+    
+    [self.downloader downloadMediaForNotification:nil deadline:[NSDate dateWithTimeIntervalSinceNow:1.0] completionHandler:^(NSArray *fileURLs, NSError *error) {
+        XCTAssertEqual([fileURLs count], 0);
+        XCTAssertEqual(error.code, APXMediaDownloaderErrorNoMedia);
+        [finished fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+@end
@@ -0,0 +1,69 @@
+//
+//  APXMetricsTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXMetrics.h"
+
+@interface APXMetricsTests : XCTestCase
+
+@property (nonatomic, strong) APXMetrics *metrics;
+
+@end
+
+@implementation APXMetricsTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.metrics = [[APXMetrics alloc] init];
+}
+
+- (void)testCountersAddUpAcrossThreads {
+    APXCounter *counter = [self.metrics counterNamed:@"requests"];
+    
+    dispatch_apply(8, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        for (NSUInteger i = 0; i < 1000; i++) {
+            [counter increment];
+        }
+    });
+    
+    XCTAssertEqual(counter.value, 8000);
+    XCTAssertEqual([self.metrics counterNamed:@"requests"], counter);
+    XCTAssertEqualObjects([self.metrics snapshot][APXMetricsCountersKey][@"requests"], @8000);
+}
+
+- (void)testHistogramPercentilesAreWithinBucketPrecision {
+    APXHistogram *histogram = [self.metrics histogramNamed:@"latency"];
+    
+    for (uint64_t value = 1; value <= 10000; value++) {
+        [histogram recordValue:value];
+    }
+    
+    NSDictionary *snapshot = [histogram snapshot];
+    
+    XCTAssertEqualObjects(snapshot[APXMetricsCountKey], @10000);
+    XCTAssertEqualObjects(snapshot[APXMetricsMinKey], @1);
+    XCTAssertEqualWithAccuracy([snapshot[APXMetricsP50Key] doubleValue], 5000, 5000 * 0.07);
+    XCTAssertEqualWithAccuracy([snapshot[APXMetricsP99Key] doubleValue], 9900, 9900 * 0.07);
+    XCTAssertGreaterThanOrEqual([snapshot[APXMetricsMaxKey] doubleValue], 10000);
+    XCTAssertEqualWithAccuracy([snapshot[APXMetricsMeanKey] doubleValue], 5000.5, 0.001);
+}
+
+- (void)testResetZeroesEveryMetric {
+    [[self.metrics counterNamed:@"requests"] add:5];
+    [[self.metrics histogramNamed:@"latency"] recordValue:42];
+    
+    [self.metrics reset];
+    
+    NSDictionary *snapshot = [self.metrics snapshot];
+    
+    XCTAssertEqualObjects(snapshot[APXMetricsCountersKey][@"requests"], @0);
+    XCTAssertEqualObjects(snapshot[APXMetricsHistogramsKey][@"latency"][APXMetricsCountKey], @0);
+}
+
+@end
@@ -0,0 +1,146 @@
+//
+//  APXPushActionExecutorTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXPushActionExecutor.h"
+#import "APXTestDoubles.h"
+
+@interface APXPushActionExecutorTests : XCTestCase
+
+@property (nonatomic, strong) APXFakeAppoxeeClient *client;
+@property (nonatomic, strong) NSURL *fileURL;
+@property (nonatomic, strong) APXPushActionExecutor *executor;
+
+@end
+
+@implementation APXPushActionExecutorTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.client = [[APXFakeAppoxeeClient alloc] init];
+    self.fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    self.executor = [self executorReadingJournal];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:self.fileURL error:nil];
+    
+    [super tearDown];
+}
+
+- (APXPushActionExecutor *)executorReadingJournal {
+    APXCustomFieldsStore *store = [[APXCustomFieldsStore alloc] initWithClient:self.client];
+    
+    return [[APXPushActionExecutor alloc] initWithClient:self.client customFieldsStore:store fileURL:self.fileURL];
+}
+
+- (APXPushNotificationActionButtonAction *)actionWithType:(APXPushNotificationActionButtonType)type todo:(APXPushNotificationActionButtonTodo)todo name:(NSString *)name value:(NSString *)value {
+    APXPushNotificationActionButtonAction *action = [[APXPushNotificationActionButtonAction alloc] init];
+    action.type = type;
+    action.todo = todo;
+    action.name = name;
+    action.value = value;
+    
+    return action;
+}
+
+- (void)execute:(NSArray *)actions {
+    XCTestExpectation *completed = [self expectationWithDescription:@"completion"];
+    
+    XCTAssertTrue([self.executor executeActions:actions completionHandler:^{
+        XCTAssertTrue([NSThread isMainThread]);
+        [completed fulfill];
+    }]);
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+}
+
+- (NSUInteger)callCountOf:(NSString *)selector {
+    return [[self.client.calls filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"SELF == %@", selector]] count];
+}
+
+- (void)testActionsAreCompiledIntoOneBatch {
+    [self execute:@[[self actionWithType:kAPXPushNotificationActionButtonActionTypeTag todo:kAPXPushNotificationActionButtonActionTodoSet name:@"news" value:nil],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeTag todo:kAPXPushNotificationActionButtonActionTodoSet name:@"sports" value:nil],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeTag todo:kAPXPushNotificationActionButtonActionTodoRemove name:@"news" value:nil],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoSet name:@"level" value:@"3"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoIncrement name:@"level" value:@"2"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoSet name:@"plan" value:@"gold"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoIncrement name:@"score" value:@"1"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoIncrement name:@"score" value:@"1"]]];
+    
+    XCTAssertEqual([self callCountOf:@"addTagsToDevice:andRemove:withCompletionHandler:"], 1);
+    XCTAssertEqual([self callCountOf:@"setNumberValue:forKey:withCompletionHandler:"], 1);
+    XCTAssertEqual([self callCountOf:@"setStringValue:forKey:withCompletionHandler:"], 1);
+    XCTAssertEqual([self callCountOf:@"incrementNumericKey:byNumericValue:withCompletionHandler:"], 1);
+    
+    XCTAssertEqualObjects([self.client.backend objectForKey:@"tags" inDevice:self.client.deviceID], [NSSet setWithObject:@"sports"]);
+    XCTAssertEqualObjects([self.client.backend objectForKey:@"custom_fields" inDevice:self.client.deviceID][@"level"], @5);
+    XCTAssertEqualObjects(self.executor.customFieldsStore.cachedFields[@"plan"], @"gold");
+    XCTAssertEqual(self.executor.pendingOperationCount, 0);
+}
+
+- (void)testUnconfirmedWorkIsJournaledAndResumed {
+    self.client.error = [NSError errorWithDomain:@"APXTest" code:1 userInfo:nil];
+    
+    [self execute:@[[self actionWithType:kAPXPushNotificationActionButtonActionTypeTag todo:kAPXPushNotificationActionButtonActionTodoSet name:@"news" value:nil]]];
+    XCTAssertEqual(self.executor.pendingOperationCount, 1);
+    
+    // As if the app was terminated and launched again.
+    self.client.error = nil;
+    self.executor = [self executorReadingJournal];
+    XCTAssertEqual(self.executor.pendingOperationCount, 1);
+    
+    [self expectationForPredicate:[NSPredicate predicateWithFormat:@"pendingOperationCount == 0"] evaluatedWithObject:self.executor handler:nil];
+    [self.executor resumePendingOperations];
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    
+    XCTAssertEqualObjects([self.client.backend objectForKey:@"tags" inDevice:self.client.deviceID], [NSSet setWithObject:@"news"]);
+}
+
+- (void)testSetValuesAreSentAsText {
+    [self execute:@[[self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoSet name:@"zip" value:@"01234"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoSet name:@"code" value:@"1e3"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoSet name:@"name" value:@"nan"]]];
+    
+    XCTAssertEqual([self callCountOf:@"setStringValue:forKey:withCompletionHandler:"], 3);
+    XCTAssertEqual([self callCountOf:@"setNumberValue:forKey:withCompletionHandler:"], 0);
+    XCTAssertEqualObjects([self.client.backend objectForKey:@"custom_fields" inDevice:self.client.deviceID][@"zip"], @"01234");
+}
+
+- (void)testFoldedIncrementsStayIntegral {
+    [self execute:@[[self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoIncrement name:@"points" value:@"9007199254740993"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoIncrement name:@"points" value:@"1"],
+                    [self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoIncrement name:@"score" value:@"nan"]]];
+    
+    XCTAssertEqual([self callCountOf:@"incrementNumericKey:byNumericValue:withCompletionHandler:"], 1);
+    XCTAssertEqual([[self.client.backend objectForKey:@"custom_fields" inDevice:self.client.deviceID][@"points"] longLongValue], 9007199254740994LL);
+}
+
+- (void)testCompletionHandlerIsCalledByTheDeadline {
+    self.client.backend.latency = 1.0;
+    self.executor.deadline = 0.1;
+    
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    [self execute:@[[self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoIncrement name:@"score" value:@"1"]]];
+    
+    XCTAssertLessThan(CFAbsoluteTimeGetCurrent() - start, 0.5);
+    XCTAssertEqual(self.executor.pendingOperationCount, 1);
+}
+
+- (void)testButtonsWithoutBackgroundWorkAreLeftToTheSDK {
+    NSArray *actions = @[[self actionWithType:kAPXPushNotificationActionButtonActionTypeCustom todo:kAPXPushNotificationActionButtonActionTodoOpenURLScheme name:@"open" value:@"demo://inbox"]];
+    
+    XCTAssertFalse([self.executor executeActions:actions completionHandler:^{
+        XCTFail(@"not handled");
+    }]);
+    XCTAssertFalse([self.executor executeActions:nil completionHandler:nil]);
+}
+
+@end
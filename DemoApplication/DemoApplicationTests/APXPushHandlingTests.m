@@ -0,0 +1,221 @@
+//
+//  APXPushHandlingTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXPushDeduplicator.h"
+#import "APXPushEventQueue.h"
+#import "APXRefreshCoalescer.h"
+#import "APXTestDoubles.h"
+
+static NSInteger APXPushEventsTestStatusCode;
+static NSURLRequest *APXPushEventsTestRequest;
+
+// Answers every request with APXPushEventsTestStatusCode.
+@interface APXPushEventsTestURLProtocol : NSURLProtocol
+
+@end
+
+@implementation APXPushEventsTestURLProtocol
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request {
+    return YES;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request {
+    return request;
+}
+
+- (void)startLoading {
+    APXPushEventsTestRequest = self.request;
+    
+    [self.client URLProtocol:self didReceiveResponse:[[NSHTTPURLResponse alloc] initWithURL:self.request.URL statusCode:APXPushEventsTestStatusCode HTTPVersion:@"HTTP/1.1" headerFields:@{}] cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [self.client URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading {
+}
+
+@end
+
+@interface APXPushHandlingTests : XCTestCase
+
+@end
+
+@implementation APXPushHandlingTests
+
+- (void)testDuplicateDeliveryIsDropped {
+    APXPushDeduplicator *deduplicator = [[APXPushDeduplicator alloc] initWithCapacity:8 fileURL:nil];
+    APXPushNotification *notification = [APXTestPushNotification notificationWithID:42];
+    
+    XCTAssertTrue([deduplicator shouldHandleNotification:notification withIdentifier:@""]);
+    XCTAssertFalse([deduplicator shouldHandleNotification:notification withIdentifier:@""]);
+    XCTAssertTrue([deduplicator shouldHandleNotification:notification withIdentifier:@"action"]);
+}
+
+- (void)testPlainOpenIsDroppedAcrossDeliveryPaths {
+    APXPushDeduplicator *deduplicator = [[APXPushDeduplicator alloc] initWithCapacity:8 fileURL:nil];
+    APXPushNotification *notification = [APXTestPushNotification notificationWithID:42];
+    
+    XCTAssertTrue([deduplicator shouldHandleNotification:notification withIdentifier:nil]);
+    XCTAssertFalse([deduplicator shouldHandleNotification:notification withIdentifier:@"com.apple.UNNotificationDefaultActionIdentifier"]);
+    XCTAssertFalse([deduplicator shouldHandleNotification:notification withIdentifier:@""]);
+}
+
+- (void)testOldestDeliveryIsEvicted {
+    APXPushDeduplicator *deduplicator = [[APXPushDeduplicator alloc] initWithCapacity:2 fileURL:nil];
+    
+    for (NSInteger uniqueID = 1; uniqueID <= 3; uniqueID++) {
+        [deduplicator shouldHandleNotification:[APXTestPushNotification notificationWithID:uniqueID] withIdentifier:nil];
+    }
+    
+    XCTAssertFalse([deduplicator containsNotification:[APXTestPushNotification notificationWithID:1] withIdentifier:nil]);
+    XCTAssertTrue([deduplicator containsNotification:[APXTestPushNotification notificationWithID:3] withIdentifier:nil]);
+}
+
+- (void)testNotificationWithoutUniqueIDIsAlwaysHandled {
+    APXPushDeduplicator *deduplicator = [[APXPushDeduplicator alloc] initWithCapacity:8 fileURL:nil];
+    APXPushNotification *notification = [APXTestPushNotification notificationWithID:0];
+    
+    XCTAssertTrue([deduplicator shouldHandleNotification:notification withIdentifier:nil]);
+    XCTAssertTrue([deduplicator shouldHandleNotification:notification withIdentifier:nil]);
+}
+
+- (void)testFailedBatchIsKeptForTheNextFlush {
+    APXPushEventQueue *queue = [[APXPushEventQueue alloc] initWithFileURL:nil];
+    __block BOOL shouldFail = YES;
+    
+    queue.transport = ^(NSArray *events, void (^completion)(NSError *error)) {
+        completion(shouldFail ? [NSError errorWithDomain:@"APXTest" code:1 userInfo:nil] : nil);
+    };
+    
+    [queue recordEventOfType:APXPushEventTypeReceived forNotification:[APXTestPushNotification notificationWithID:7] withIdentifier:nil];
+    [queue recordEventOfType:APXPushEventTypeReceived forNotification:[APXTestPushNotification notificationWithID:7] withIdentifier:nil];
+    
+    XCTestExpectation *failed = [self expectationWithDescription:@"failed flush"];
+    
+    [queue flushWithCompletionHandler:^(NSUInteger sentCount, NSError *error) {
+        XCTAssertNotNil(error);
+        XCTAssertEqual(sentCount, 0);
+        [failed fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual(queue.pendingCount, 1);
+    
+    shouldFail = NO;
+    XCTestExpectation *sent = [self expectationWithDescription:@"flush"];
+    
+    [queue flushWithCompletionHandler:^(NSUInteger sentCount, NSError *error) {
+        XCTAssertNil(error);
+        XCTAssertEqual(sentCount, 1);
+        [sent fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual(queue.pendingCount, 0);
+}
+
+- (void)testTapsOnDifferentButtonsAreSeparateEvents {
+    APXPushEventQueue *queue = [[APXPushEventQueue alloc] initWithFileURL:nil];
+    __block NSArray *sentEvents = nil;
+    
+    queue.transport = ^(NSArray *events, void (^completion)(NSError *error)) {
+        sentEvents = events;
+        completion(nil);
+    };
+    
+    APXPushNotification *notification = [APXTestPushNotification notificationWithID:7];
+    [queue recordEventOfType:APXPushEventTypeOpened forNotification:notification withIdentifier:@"share"];
+    [queue recordEventOfType:APXPushEventTypeOpened forNotification:notification withIdentifier:@"like"];
+    [queue recordEventOfType:APXPushEventTypeOpened forNotification:notification withIdentifier:@"like"];
+    
+    XCTestExpectation *sent = [self expectationWithDescription:@"flush"];
+    
+    [queue flushWithCompletionHandler:^(NSUInteger sentCount, NSError *error) {
+        XCTAssertEqual(sentCount, 2);
+        [sent fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual([[NSSet setWithArray:[sentEvents valueForKey:APXPushEventIDKey]] count], 2);
+}
+
+- (void)testHTTPTransportAcceptsOnlySuccessfulBatches {
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[[APXPushEventsTestURLProtocol class]];
+    
+    NSURL *URL = [NSURL URLWithString:@"https://example.com/push-events"];
+    APXPushEventTransportBlock transport = [APXPushEventQueue transportWithURL:URL session:[NSURLSession sessionWithConfiguration:configuration]];
+    NSArray *events = @[@{APXPushEventIDKey : @"7-1", APXPushEventUniqueIDKey : @7}];
+    
+    APXPushEventsTestStatusCode = 500;
+    XCTestExpectation *rejected = [self expectationWithDescription:@"rejected"];
+    
+    transport(events, ^(NSError *error) {
+        XCTAssertNotNil(error);
+        [rejected fulfill];
+    });
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqualObjects(APXPushEventsTestRequest.HTTPMethod, @"POST");
+    XCTAssertEqualObjects(APXPushEventsTestRequest.URL, URL);
+    
+    APXPushEventsTestStatusCode = 202;
+    XCTestExpectation *accepted = [self expectationWithDescription:@"accepted"];
+    
+    transport(events, ^(NSError *error) {
+        XCTAssertNil(error);
+        [accepted fulfill];
+    });
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testEventsAreNotRecordedWithoutTransport {
+    APXPushEventQueue *queue = [[APXPushEventQueue alloc] initWithFileURL:nil];
+    
+    [queue recordEventOfType:APXPushEventTypeReceived forNotification:[APXTestPushNotification notificationWithID:7] withIdentifier:nil];
+    
+    XCTAssertEqual(queue.pendingCount, 0);
+}
+
+- (void)testFirstTriggerIsRefreshedRightAwayAndFollowersShareOneRefresh {
+    __block NSUInteger refreshes = 0;
+    APXRefreshCoalescer *coalescer = [[APXRefreshCoalescer alloc] initWithWindow:0.3 refreshBlock:^(APXRefreshCoalescerFetchHandler completion) {
+        refreshes++;
+        completion(UIBackgroundFetchResultNewData);
+    }];
+    
+    XCTestExpectation *first = [self expectationWithDescription:@"first"];
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    
+    [coalescer requestRefreshWithFetchCompletionHandler:^(UIBackgroundFetchResult fetchResult) {
+        XCTAssertLessThan(CFAbsoluteTimeGetCurrent() - start, 0.1);
+        [first fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual(refreshes, 1);
+    
+    XCTestExpectation *second = [self expectationWithDescription:@"second"];
+    XCTestExpectation *third = [self expectationWithDescription:@"third"];
+    
+    [coalescer requestRefreshWithFetchCompletionHandler:^(UIBackgroundFetchResult fetchResult) {
+        [second fulfill];
+    }];
+    [coalescer requestRefreshWithFetchCompletionHandler:^(UIBackgroundFetchResult fetchResult) {
+        XCTAssertEqual(fetchResult, UIBackgroundFetchResultNewData);
+        [third fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual(refreshes, 2);
+    XCTAssertGreaterThanOrEqual(CFAbsoluteTimeGetCurrent() - start, 0.3);
+}
+
+@end
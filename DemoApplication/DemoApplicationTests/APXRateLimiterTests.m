@@ -0,0 +1,159 @@
+//
+//  APXRateLimiterTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXRateLimiter.h"
+#import "APXRateLimitedClient.h"
+#import "APXTestDoubles.h"
+
+@interface APXRateLimiterTests : XCTestCase
+
+@property (nonatomic, strong) APXRateLimiter *limiter;
+@property (nonatomic, strong) APXFakeAppoxeeClient *fakeClient;
+@property (nonatomic, strong) APXRateLimitedClient *client;
+
+@end
+
+@implementation APXRateLimiterTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.limiter = [[APXRateLimiter alloc] init];
+    self.fakeClient = [[APXFakeAppoxeeClient alloc] init];
+    self.client = [[APXRateLimitedClient alloc] initWithClient:self.fakeClient limiter:self.limiter];
+}
+
+- (NSUInteger)callCountOf:(NSString *)selector {
+    return [[self.fakeClient.calls filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"SELF == %@", selector]] count];
+}
+
+- (id)customFieldForKey:(NSString *)key {
+    return [self.fakeClient.backend objectForKey:@"custom_fields" inDevice:self.fakeClient.deviceID][key];
+}
+
+// Performs calls, each of which passes the handler it's given to one client call, and waits for every handler.
+- (void)performCalls:(NSUInteger)count withBlock:(void (^)(NSUInteger index, AppoxeeCompletionHandler handler))block {
+    XCTestExpectation *answered = [self expectationWithDescription:@"answers"];
+    __block NSUInteger answers = 0;
+    
+    for (NSUInteger i = 0; i < count; i++) {
+        block(i, ^(NSError *appoxeeError, id data) {
+            XCTAssertNil(appoxeeError);
+            
+            @synchronized (self) {
+                if (++answers == count) [answered fulfill];
+            }
+        });
+    }
+    
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+}
+
+#pragma mark - APXRateLimiter
+
+- (void)testBurstUpToTheLimitIsAllowed {
+    [self.limiter setLimit:3 perInterval:60.0 forClass:APXRateLimitClassTags];
+    
+    XCTAssertTrue([self.limiter consumeTokenForClass:APXRateLimitClassTags]);
+    XCTAssertTrue([self.limiter consumeTokenForClass:APXRateLimitClassTags]);
+    XCTAssertTrue([self.limiter consumeTokenForClass:APXRateLimitClassTags]);
+    XCTAssertFalse([self.limiter consumeTokenForClass:APXRateLimitClassTags]);
+    
+    NSTimeInterval delay = [self.limiter delayUntilTokenForClass:APXRateLimitClassTags];
+    XCTAssertGreaterThan(delay, 19.0);
+    XCTAssertLessThanOrEqual(delay, 20.0);
+    
+    // Other classes have buckets of their own.
+    XCTAssertTrue([self.limiter consumeTokenForClass:APXRateLimitClassAlias]);
+}
+
+- (void)testBucketRefillsAtTheRate {
+    [self.limiter setLimit:10 perInterval:0.5 forClass:APXRateLimitClassCustomFields];
+    
+    while ([self.limiter consumeTokenForClass:APXRateLimitClassCustomFields]) {
+    }
+    
+    [NSThread sleepForTimeInterval:0.1];
+    
+    XCTAssertTrue([self.limiter consumeTokenForClass:APXRateLimitClassCustomFields]);
+}
+
+- (void)testHeaderUpdatesTheClassesItLists {
+    XCTAssertTrue([self.limiter updateLimitsWithHeaderValue:@"tags=2/10, future_class=1/1"]);
+    XCTAssertEqual([self.limiter limitForClass:APXRateLimitClassTags], 2);
+    XCTAssertEqual([self.limiter intervalForClass:APXRateLimitClassTags], 10.0);
+    XCTAssertEqual([self.limiter limitForClass:APXRateLimitClassCustomFields], 30);
+    
+    XCTAssertFalse([self.limiter updateLimitsWithHeaderValue:@"alias=1/60, tags=5"]);
+    XCTAssertEqual([self.limiter limitForClass:APXRateLimitClassAlias], 5);
+    
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://api.example.com"] statusCode:200 HTTPVersion:@"HTTP/1.1" headerFields:@{@"x-appoxee-rate-limit" : @"inbox_refresh=1/30"}];
+    
+    XCTAssertTrue([self.limiter updateLimitsWithResponse:response]);
+    XCTAssertEqual([self.limiter limitForClass:APXRateLimitClassInboxRefresh], 1);
+}
+
+#pragma mark - APXRateLimitedClient
+
+- (void)testIncrementsOverTheLimitAreMerged {
+    [self.limiter setLimit:1 perInterval:0.3 forClass:APXRateLimitClassCustomFields];
+    
+    [self performCalls:50 withBlock:^(NSUInteger index, AppoxeeCompletionHandler handler) {
+        [self.client incrementNumericKey:@"score" byNumericValue:@1 withCompletionHandler:handler];
+    }];
+    
+    XCTAssertEqual([self callCountOf:@"incrementNumericKey:byNumericValue:withCompletionHandler:"], 2);
+    XCTAssertEqualObjects([self customFieldForKey:@"score"], @50);
+}
+
+- (void)testPendingValueTakesLaterWritesOfTheField {
+    [self.limiter setLimit:1 perInterval:0.3 forClass:APXRateLimitClassCustomFields];
+    
+    [self performCalls:4 withBlock:^(NSUInteger index, AppoxeeCompletionHandler handler) {
+        switch (index) {
+            case 0: [self.client setNumberValue:@1 forKey:@"level" withCompletionHandler:handler]; break;
+            case 1: [self.client incrementNumericKey:@"level" byNumericValue:@5 withCompletionHandler:handler]; break;
+            case 2: [self.client setNumberValue:@10 forKey:@"level" withCompletionHandler:handler]; break;
+            default: [self.client incrementNumericKey:@"level" byNumericValue:@2 withCompletionHandler:handler]; break;
+        }
+    }];
+    
+    XCTAssertEqual([self callCountOf:@"setNumberValue:forKey:withCompletionHandler:"], 2);
+    XCTAssertEqual([self callCountOf:@"incrementNumericKey:byNumericValue:withCompletionHandler:"], 0);
+    XCTAssertEqualObjects([self customFieldForKey:@"level"], @12);
+}
+
+- (void)testTagChangesAreMergedIntoOneNetChange {
+    [self.limiter setLimit:1 perInterval:0.3 forClass:APXRateLimitClassTags];
+    
+    [self performCalls:4 withBlock:^(NSUInteger index, AppoxeeCompletionHandler handler) {
+        switch (index) {
+            case 0: [self.client addTagsToDevice:@[@"news"] andRemove:nil withCompletionHandler:handler]; break;
+            case 1: [self.client addTagsToDevice:@[@"sports"] andRemove:nil withCompletionHandler:handler]; break;
+            case 2: [self.client addTagsToDevice:nil andRemove:@[@"news", @"sports"] withCompletionHandler:handler]; break;
+            default: [self.client addTagsToDevice:@[@"sports"] andRemove:nil withCompletionHandler:handler]; break;
+        }
+    }];
+    
+    XCTAssertEqual([self callCountOf:@"addTagsToDevice:andRemove:withCompletionHandler:"], 2);
+    XCTAssertEqualObjects([self.fakeClient.backend objectForKey:@"tags" inDevice:self.fakeClient.deviceID], [NSSet setWithObject:@"sports"]);
+}
+
+- (void)testUnlimitedClassIsPassedThrough {
+    [self.limiter setLimit:0 perInterval:60.0 forClass:APXRateLimitClassCustomFields];
+    
+    [self performCalls:20 withBlock:^(NSUInteger index, AppoxeeCompletionHandler handler) {
+        [self.client incrementNumericKey:@"score" byNumericValue:@1 withCompletionHandler:handler];
+    }];
+    
+    XCTAssertEqual([self callCountOf:@"incrementNumericKey:byNumericValue:withCompletionHandler:"], 20);
+    XCTAssertEqual([self.client deferredCallCountForClass:APXRateLimitClassCustomFields], 0);
+}
+
+@end
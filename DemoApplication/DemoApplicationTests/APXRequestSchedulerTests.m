@@ -0,0 +1,104 @@
+//
+//  APXRequestSchedulerTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXRequestScheduler.h"
+
+@interface APXRequestSchedulerTests : XCTestCase
+
+@property (nonatomic, strong) APXRequestScheduler *scheduler;
+
+@end
+
+@implementation APXRequestSchedulerTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.scheduler = [[APXRequestScheduler alloc] init];
+}
+
+- (void)testCancelledRequestNeverRuns {
+    XCTestExpectation *blockerDone = [self expectationWithDescription:@"blocker"];
+    __block BOOL didRun = NO;
+    
+    [self.scheduler setMaximumConcurrentRequests:1 forLane:APXRequestLaneBackground];
+    
+    [self.scheduler scheduleRequest:^(AppoxeeCompletionHandler done) {
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.1 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+            done(nil, nil);
+        });
+    } inLane:APXRequestLaneBackground completion:^(NSError *appoxeeError, id data) {
+        [blockerDone fulfill];
+    }];
+    
+    APXRequestHandle *handle = [self.scheduler scheduleRequest:^(AppoxeeCompletionHandler done) {
+        didRun = YES;
+        done(nil, nil);
+    } inLane:APXRequestLaneBackground completion:^(NSError *appoxeeError, id data) {
+        XCTFail(@"cancelled request completed");
+    }];
+    
+    [handle cancel];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    
+    XCTAssertTrue(handle.isCancelled);
+    XCTAssertFalse(didRun);
+}
+
+- (void)testUserInteractiveLaneDoesNotWaitBehindBackgroundWork {
+    XCTestExpectation *interactiveDone = [self expectationWithDescription:@"interactive"];
+    __block BOOL isBackgroundDone = NO;
+    
+    [self.scheduler scheduleRequest:^(AppoxeeCompletionHandler done) {
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.5 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+            isBackgroundDone = YES;
+            done(nil, nil);
+        });
+    } inLane:APXRequestLaneBackground completion:nil];
+    
+    [self.scheduler scheduleRequest:^(AppoxeeCompletionHandler done) {
+        done(nil, @"alias");
+    } inLane:APXRequestLaneUserInteractive completion:^(NSError *appoxeeError, id data) {
+        XCTAssertEqualObjects(data, @"alias");
+        XCTAssertFalse(isBackgroundDone);
+        [interactiveDone fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testLaneConcurrencyIsBounded {
+    XCTestExpectation *allDone = [self expectationWithDescription:@"all"];
+    __block NSInteger running = 0;
+    __block NSInteger peak = 0;
+    __block NSInteger remaining = 6;
+    
+    [self.scheduler setMaximumConcurrentRequests:2 forLane:APXRequestLaneDefault];
+    
+    for (NSUInteger i = 0; i < 6; i++) {
+        [self.scheduler scheduleRequest:^(AppoxeeCompletionHandler done) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                peak = MAX(peak, ++running);
+                
+                dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.02 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+                    running--;
+                    done(nil, nil);
+                });
+            });
+        } inLane:APXRequestLaneDefault completion:^(NSError *appoxeeError, id data) {
+            if (--remaining == 0) [allDone fulfill];
+        }];
+    }
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertLessThanOrEqual(peak, 2);
+}
+
+@end
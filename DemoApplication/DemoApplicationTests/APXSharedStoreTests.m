@@ -0,0 +1,141 @@
+//
+//  APXSharedStoreTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXSharedStore.h"
+#import "APXInboxStore.h"
+#import "APXTestDoubles.h"
+
+@interface APXSharedStoreTests : XCTestCase
+
+@property (nonatomic, strong) NSURL *directoryURL;
+@property (nonatomic, strong) NSURL *fileURL;
+@property (nonatomic, strong) APXSharedStore *store;
+
+@end
+
+@implementation APXSharedStoreTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.directoryURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    [[NSFileManager defaultManager] createDirectoryAtURL:self.directoryURL withIntermediateDirectories:YES attributes:nil error:nil];
+    
+    self.fileURL = [self.directoryURL URLByAppendingPathComponent:@"APXSharedStore.plist"];
+    self.store = [[APXSharedStore alloc] initWithFileURL:self.fileURL];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:self.directoryURL error:nil];
+    
+    [super tearDown];
+}
+
+- (void)testSectionsRoundTrip {
+    NSError *error = nil;
+    
+    XCTAssertEqualObjects([self.store snapshot], @{});
+    XCTAssertTrue([self.store setObject:@{@"app_id" : @"123"} forKey:APXSharedStoreConfigKey error:&error]);
+    XCTAssertNil(error);
+    XCTAssertTrue([self.store setObject:@{@"udid" : @"abc"} forKey:APXSharedStoreDeviceKey error:NULL]);
+    
+    XCTAssertEqualObjects([self.store objectForKey:APXSharedStoreConfigKey], @{@"app_id" : @"123"});
+    XCTAssertEqualObjects([self.store objectForKey:APXSharedStoreDeviceKey], @{@"udid" : @"abc"});
+    
+    [self.store setObject:nil forKey:APXSharedStoreDeviceKey error:NULL];
+    XCTAssertNil([self.store objectForKey:APXSharedStoreDeviceKey]);
+}
+
+- (void)testUnchangedFileIsNotParsedAgain {
+    [self.store setObject:@{@"app_id" : @"123"} forKey:APXSharedStoreConfigKey error:NULL];
+    
+    XCTAssertTrue([self.store snapshot] == [self.store snapshot]);
+}
+
+- (void)testUnchangedSectionIsNotWrittenAgain {
+    [self.store setObject:@{@"app_id" : @"123"} forKey:APXSharedStoreConfigKey error:NULL];
+    NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:[self.fileURL path] error:NULL];
+    
+    [self.store setObject:@{@"app_id" : @"123"} forKey:APXSharedStoreConfigKey error:NULL];
+    
+    XCTAssertEqualObjects([[NSFileManager defaultManager] attributesOfItemAtPath:[self.fileURL path] error:NULL][NSFileSystemFileNumber], attributes[NSFileSystemFileNumber]);
+}
+
+- (void)testWriterSeesSectionsOfOtherWriters {
+    // Each store stands in for a process, the app and its extensions each have their own.
+    APXSharedStore *extensionStore = [[APXSharedStore alloc] initWithFileURL:self.fileURL];
+    
+    XCTAssertEqualObjects([extensionStore snapshot], @{});
+    
+    [self.store setObject:@{@"app_id" : @"123"} forKey:APXSharedStoreConfigKey error:NULL];
+    [extensionStore setObject:@{@"udid" : @"abc"} forKey:APXSharedStoreDeviceKey error:NULL];
+    
+    NSDictionary *expected = @{APXSharedStoreConfigKey : @{@"app_id" : @"123"}, APXSharedStoreDeviceKey : @{@"udid" : @"abc"}};
+    XCTAssertEqualObjects([self.store snapshot], expected);
+    XCTAssertEqualObjects([extensionStore snapshot], expected);
+}
+
+- (void)testConcurrentWritersDontLoseUpdates {
+    NSUInteger writers = 8;
+    
+    dispatch_apply(writers, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+        APXSharedStore *store = [[APXSharedStore alloc] initWithFileURL:self.fileURL];
+        
+        for (NSUInteger i = 0; i < 20; i++) {
+            [store setObject:@(i) forKey:[NSString stringWithFormat:@"writer%zu", index] error:NULL];
+        }
+    });
+    
+    NSDictionary *snapshot = [self.store snapshot];
+    
+    for (NSUInteger index = 0; index < writers; index++) {
+        XCTAssertEqualObjects(snapshot[[NSString stringWithFormat:@"writer%lu", (unsigned long)index]], @19);
+    }
+}
+
+- (void)testInboxStoreMirrorsItsSnapshot {
+    APXFakeAppoxeeClient *client = [[APXFakeAppoxeeClient alloc] init];
+    client.messages = @[[APXTestRichMessage messageWithID:1 title:@"One" isRead:NO], [APXTestRichMessage messageWithID:2 title:@"Two" isRead:YES]];
+    
+    APXInboxStore *inboxStore = [[APXInboxStore alloc] initWithClient:client];
+    inboxStore.sharedStore = self.store;
+    
+    XCTestExpectation *refreshed = [self expectationWithDescription:@"refresh"];
+    
+    [inboxStore refreshWithCompletionHandler:^(NSError *appoxeeError, id data) {
+        [refreshed fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:2.0];
+    
+    while (![[self.store objectForKey:APXSharedStoreInboxKey] count] && [deadline timeIntervalSinceNow] > 0) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+    
+    NSArray *entries = [self.store objectForKey:APXSharedStoreInboxKey];
+    XCTAssertEqual([entries count], 2);
+    XCTAssertEqualObjects(entries[0][APXSharedInboxEntryIDKey], @1);
+    XCTAssertEqualObjects(entries[1][APXSharedInboxEntryTitleKey], @"Two");
+    XCTAssertEqualObjects(entries[1][APXSharedInboxEntryIsReadKey], @YES);
+}
+
+- (void)testExportingMessagesLeavesThemUnread {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:1 title:@"One" isRead:NO];
+    message.testMessageLink = @"https://example.com/one";
+    
+    NSDictionary *entry = [[APXSharedStore entriesForMessages:@[message]] firstObject];
+    
+    XCTAssertEqualObjects(entry[APXSharedInboxEntryIsReadKey], @NO);
+    XCTAssertEqual(message.messageLinkReadCount, 0);
+    XCTAssertFalse(message.isRead);
+}
+
+@end
@@ -0,0 +1,49 @@
+//
+//  APXTestDoubles.h
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <AppoxeeSDK/AppoxeeSDK.h>
+#import "APXAppoxeeClient.h"
+#import "APXLocalBackend.h"
+
+// SDK models only have readonly properties and an undocumented keyed values format, these subclasses let tests set them.
+@interface APXTestRichMessage : APXRichMessage
+
+@property (nonatomic, copy) NSString *testContent; // returned as content, nil by default
+@property (nonatomic, strong) NSDate *testPostDate; // returned as postDate, nil by default
+@property (nonatomic, copy) NSString *testMessageLink; // returned as messageLink, nil by default
+
+// Like the SDK's, reading messageLink marks the message as read.
+@property (nonatomic, readonly) NSUInteger messageLinkReadCount;
+
++ (instancetype)messageWithID:(NSInteger)uniqueID title:(NSString *)title isRead:(BOOL)isRead;
+
+@end
+
+@interface APXTestPushNotification : APXPushNotification
+
++ (instancetype)notificationWithID:(NSInteger)uniqueID;
+
+@end
+
+// A simulated device talking to an APXLocalBackend, and recording every call it receives.
+@interface APXFakeAppoxeeClient : NSObject <APXAppoxeeClient>
+
+@property (nonatomic, strong, readonly) APXLocalBackend *backend;
+@property (nonatomic, copy, readonly) NSString *deviceID;
+@property (atomic, copy) NSArray *messages; // of Type APXRichMessage, the device's Inbox at the backend
+@property (atomic, strong) NSError *error; // when set, every call fails with it without reaching the backend
+@property (atomic, strong, readonly) NSArray *calls; // of Type NSString, the selectors called, in order
+@property (atomic, strong) APXClientDevice *device; // returned by deviceInformationwithCompletionHandler:, an empty device by default
+
+// A device of its own backend, which answers without latency.
+- (instancetype)init;
+
+- (instancetype)initWithBackend:(APXLocalBackend *)backend deviceID:(NSString *)deviceID;
+
+@end
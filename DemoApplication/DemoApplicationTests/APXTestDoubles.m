@@ -0,0 +1,305 @@
+//
+//  APXTestDoubles.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import "APXTestDoubles.h"
+#import "APXCustomFieldsStore.h"
+
+@implementation APXTestRichMessage {
+    NSInteger _testUniqueID;
+    NSString *_testTitle;
+    BOOL _testIsRead;
+}
+
++ (instancetype)messageWithID:(NSInteger)uniqueID title:(NSString *)title isRead:(BOOL)isRead {
+    APXTestRichMessage *message = [[self alloc] init];
+    message->_testUniqueID = uniqueID;
+    message->_testTitle = [title copy];
+    message->_testIsRead = isRead;
+    
+    return message;
+}
+
+- (NSInteger)uniqueID {
+    return _testUniqueID;
+}
+
+- (NSString *)title {
+    return _testTitle;
+}
+
+- (BOOL)isRead {
+    @synchronized (self) {
+        return _testIsRead;
+    }
+}
+
+- (NSString *)content {
+    return self.testContent;
+}
+
+- (NSDate *)postDate {
+    return self.testPostDate;
+}
+
+- (NSString *)messageLink {
+    @synchronized (self) {
+        _messageLinkReadCount++;
+        _testIsRead = YES;
+    }
+    
+    return self.testMessageLink;
+}
+
+@end
+
+@implementation APXTestPushNotification {
+    NSInteger _testUniqueID;
+}
+
++ (instancetype)notificationWithID:(NSInteger)uniqueID {
+    APXTestPushNotification *notification = [[self alloc] init];
+    notification->_testUniqueID = uniqueID;
+    
+    return notification;
+}
+
+- (NSInteger)uniqueID {
+    return _testUniqueID;
+}
+
+@end
+
+static NSString * const kAPXFakeInboxKey = @"inbox";
+static NSString * const kAPXFakeAliasKey = @"alias";
+static NSString * const kAPXFakeTagsKey = @"tags";
+static NSString * const kAPXFakeCustomFieldsKey = @"custom_fields";
+
+@interface APXFakeAppoxeeClient ()
+
+@property (nonatomic, strong, readwrite) APXLocalBackend *backend;
+@property (nonatomic, copy, readwrite) NSString *deviceID;
+@property (atomic, strong) NSMutableArray *recordedCalls;
+
+@end
+
+@implementation APXFakeAppoxeeClient
+
+- (instancetype)init {
+    return [self initWithBackend:[[APXLocalBackend alloc] init] deviceID:[[NSUUID UUID] UUIDString]];
+}
+
+- (instancetype)initWithBackend:(APXLocalBackend *)backend deviceID:(NSString *)deviceID {
+    self = [super init];
+    
+    if (self) {
+        
+        _backend = backend;
+        _deviceID = [deviceID copy];
+        _recordedCalls = [[NSMutableArray alloc] init];
+    }
+    
+    return self;
+}
+
+- (NSArray *)messages {
+    return [self.backend objectForKey:kAPXFakeInboxKey inDevice:self.deviceID] ?: @[];
+}
+
+- (void)setMessages:(NSArray *)messages {
+    [self.backend setObject:[messages copy] forKey:kAPXFakeInboxKey inDevice:self.deviceID];
+}
+
+- (NSArray *)calls {
+    @synchronized (self.recordedCalls) {
+        return [self.recordedCalls copy];
+    }
+}
+
+- (void)recordCall:(SEL)selector {
+    @synchronized (self.recordedCalls) {
+        [self.recordedCalls addObject:NSStringFromSelector(selector)];
+    }
+}
+
+- (void)perform:(NSString *)operation handler:(APXLocalBackendHandler)handler completion:(AppoxeeCompletionHandler)completion {
+    NSError *error = self.error;
+    
+    if (error) {
+        
+        if (completion) {
+            dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+                completion(error, nil);
+            });
+        }
+        
+        return;
+    }
+    
+    [self.backend performOperation:operation forDevice:self.deviceID handler:handler completion:completion];
+}
+
+- (void)setCustomField:(id)value forKey:(NSString *)key completion:(AppoxeeCompletionHandler)completion {
+    [self perform:APXLocalBackendOperationCustomFields handler:^id(NSMutableDictionary *deviceState) {
+        NSMutableDictionary *fields = [deviceState[kAPXFakeCustomFieldsKey] mutableCopy] ?: [[NSMutableDictionary alloc] init];
+        fields[key] = value;
+        deviceState[kAPXFakeCustomFieldsKey] = fields;
+        
+        return nil;
+    } completion:completion];
+}
+
+#pragma mark - APXAppoxeeClient
+
+- (void)didRegisterForRemoteNotificationsWithDeviceToken:(NSData *)token {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationRegistration handler:nil completion:nil];
+}
+
+- (void)didRegisterUserNotificationSettings:(NSObject *)notificationSettings {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationRegistration handler:nil completion:nil];
+}
+
+- (void)deviceInformationwithCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationDeviceInfo handler:^id(NSMutableDictionary *deviceState) {
+        return self.device ?: [[APXClientDevice alloc] init];
+    } completion:handler];
+}
+
+- (void)performFetchWithCompletionHandler:(void (^)(UIBackgroundFetchResult))fetchHandler andNotifyCompletionWithBlock:(AppoxeeCompletionHandler)completionBlock {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationFetch handler:^id(NSMutableDictionary *deviceState) {
+        return @(UIBackgroundFetchResultNoData);
+    } completion:^(NSError *appoxeeError, id data) {
+        if (fetchHandler) fetchHandler(appoxeeError ? UIBackgroundFetchResultFailed : UIBackgroundFetchResultNoData);
+        if (completionBlock) completionBlock(appoxeeError, data);
+    }];
+}
+
+- (void)getRichMessagesWithHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    
+    // The SDK answers from its local cache, without a request.
+    NSArray *messages = self.messages;
+    
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        if (handler) handler(self.error, self.error ? nil : messages);
+    });
+}
+
+- (void)deleteRichMessage:(APXRichMessage *)richMessage withHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationInbox handler:^id(NSMutableDictionary *deviceState) {
+        NSIndexSet *remaining = [deviceState[kAPXFakeInboxKey] indexesOfObjectsPassingTest:^BOOL(APXRichMessage *message, NSUInteger idx, BOOL *stop) {
+            return message.uniqueID != richMessage.uniqueID;
+        }];
+        
+        deviceState[kAPXFakeInboxKey] = [deviceState[kAPXFakeInboxKey] objectsAtIndexes:remaining];
+        
+        return nil;
+    } completion:handler];
+}
+
+- (void)refreshInboxWithCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationInbox handler:^id(NSMutableDictionary *deviceState) {
+        return deviceState[kAPXFakeInboxKey] ?: @[];
+    } completion:handler];
+}
+
+- (void)setDeviceAlias:(NSString *)alias withCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationAlias handler:^id(NSMutableDictionary *deviceState) {
+        deviceState[kAPXFakeAliasKey] = alias;
+        
+        return nil;
+    } completion:handler];
+}
+
+- (void)removeDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationAlias handler:^id(NSMutableDictionary *deviceState) {
+        [deviceState removeObjectForKey:kAPXFakeAliasKey];
+        
+        return nil;
+    } completion:handler];
+}
+
+- (void)getDeviceAliasWithCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationAlias handler:^id(NSMutableDictionary *deviceState) {
+        return deviceState[kAPXFakeAliasKey];
+    } completion:handler];
+}
+
+- (void)clearAliasCacheWithCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    
+    // The SDK only drops its local copy, without a request.
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        if (handler) handler(self.error, nil);
+    });
+}
+
+- (void)fetchDeviceTags:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationTags handler:^id(NSMutableDictionary *deviceState) {
+        return [deviceState[kAPXFakeTagsKey] allObjects] ?: @[];
+    } completion:handler];
+}
+
+- (void)addTagsToDevice:(NSArray *)tagsToAdd andRemove:(NSArray *)tagsToRemove withCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationTags handler:^id(NSMutableDictionary *deviceState) {
+        NSMutableSet *tags = [deviceState[kAPXFakeTagsKey] mutableCopy] ?: [[NSMutableSet alloc] init];
+        [tags addObjectsFromArray:tagsToAdd ?: @[]];
+        [tags minusSet:[NSSet setWithArray:tagsToRemove ?: @[]]];
+        deviceState[kAPXFakeTagsKey] = tags;
+        
+        return nil;
+    } completion:handler];
+}
+
+- (void)setDateValue:(NSDate *)date forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self setCustomField:date forKey:key completion:handler];
+}
+
+- (void)setNumberValue:(NSNumber *)number forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self setCustomField:number forKey:key completion:handler];
+}
+
+- (void)incrementNumericKey:(NSString *)key byNumericValue:(NSNumber *)number withCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationCustomFields handler:^id(NSMutableDictionary *deviceState) {
+        NSMutableDictionary *fields = [deviceState[kAPXFakeCustomFieldsKey] mutableCopy] ?: [[NSMutableDictionary alloc] init];
+        NSNumber *current = [fields[key] isKindOfClass:[NSNumber class]] ? fields[key] : @0;
+        fields[key] = [APXCustomFieldsStore sumOfNumber:current andNumber:number];
+        deviceState[kAPXFakeCustomFieldsKey] = fields;
+        
+        return nil;
+    } completion:handler];
+}
+
+- (void)setStringValue:(NSString *)string forKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self setCustomField:string forKey:key completion:handler];
+}
+
+- (void)fetchCustomFieldByKey:(NSString *)key withCompletionHandler:(AppoxeeCompletionHandler)handler {
+    [self recordCall:_cmd];
+    [self perform:APXLocalBackendOperationCustomFields handler:^id(NSMutableDictionary *deviceState) {
+        id value = deviceState[kAPXFakeCustomFieldsKey][key];
+        
+        return value ? @{key : value} : @{};
+    } completion:handler];
+}
+
+@end
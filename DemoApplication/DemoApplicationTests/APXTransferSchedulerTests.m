@@ -0,0 +1,128 @@
+//
+//  APXTransferSchedulerTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXTransferScheduler.h"
+#import "APXPushEventQueue.h"
+#import "APXTestDoubles.h"
+
+@interface APXTransferSchedulerTests : XCTestCase
+
+@property (nonatomic, strong) APXTransferScheduler *scheduler;
+
+@end
+
+@implementation APXTransferSchedulerTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.scheduler = [[APXTransferScheduler alloc] init];
+}
+
+- (void)testTransferWaitsForTheRadio {
+    __block BOOL ran = NO;
+    
+    [self.scheduler scheduleTransferWithIdentifier:@"acks" maximumDelay:60.0 block:^{
+        ran = YES;
+    }];
+    
+    [NSThread sleepForTimeInterval:0.1];
+    XCTAssertFalse(ran);
+    XCTAssertEqual(self.scheduler.pendingTransferCount, 1);
+    
+    XCTestExpectation *sent = [self expectationWithDescription:@"transfer"];
+    
+    [self.scheduler scheduleTransferWithIdentifier:@"acks" maximumDelay:60.0 block:^{
+        [sent fulfill];
+    }];
+    
+    [self.scheduler noteNetworkActivity];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual(self.scheduler.pendingTransferCount, 0);
+}
+
+- (void)testTransferRunsRightAwayWhileTheRadioIsActive {
+    [self.scheduler noteNetworkActivity];
+    XCTAssertTrue(self.scheduler.isRadioActive);
+    
+    XCTestExpectation *sent = [self expectationWithDescription:@"transfer"];
+    
+    [self.scheduler scheduleTransferWithIdentifier:@"acks" maximumDelay:60.0 block:^{
+        [sent fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testRadioGoesIdleAfterTheActiveWindow {
+    self.scheduler.activeWindow = 0.05;
+    [self.scheduler noteNetworkActivity];
+    
+    [NSThread sleepForTimeInterval:0.1];
+    
+    XCTAssertFalse(self.scheduler.isRadioActive);
+    
+    [self.scheduler scheduleTransferWithIdentifier:@"acks" maximumDelay:60.0 block:^{
+    }];
+    
+    XCTAssertEqual(self.scheduler.pendingTransferCount, 1);
+}
+
+- (void)testDeadlineSendsEveryPendingTransfer {
+    XCTestExpectation *urgent = [self expectationWithDescription:@"urgent"];
+    XCTestExpectation *relaxed = [self expectationWithDescription:@"relaxed"];
+    
+    [self.scheduler scheduleTransferWithIdentifier:@"relaxed" maximumDelay:60.0 block:^{
+        [relaxed fulfill];
+    }];
+    [self.scheduler scheduleTransferWithIdentifier:@"urgent" maximumDelay:0.2 block:^{
+        [urgent fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testRescheduledTransferKeepsTheEarlierDeadline {
+    XCTestExpectation *sent = [self expectationWithDescription:@"transfer"];
+    
+    [self.scheduler scheduleTransferWithIdentifier:@"acks" maximumDelay:0.2 block:^{
+        XCTFail(@"the block was replaced");
+    }];
+    [self.scheduler scheduleTransferWithIdentifier:@"acks" maximumDelay:60.0 block:^{
+        [sent fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testPushEventsGoAlongWithTheNextRequest {
+    APXPushEventQueue *queue = [[APXPushEventQueue alloc] initWithFileURL:nil];
+    queue.transferScheduler = self.scheduler;
+    
+    XCTestExpectation *sent = [self expectationWithDescription:@"transport"];
+    
+    queue.transport = ^(NSArray *events, void (^completion)(NSError *error)) {
+        XCTAssertEqual([events count], 2);
+        completion(nil);
+        [sent fulfill];
+    };
+    
+    [queue recordEventOfType:APXPushEventTypeReceived forNotification:[APXTestPushNotification notificationWithID:1] withIdentifier:nil];
+    [queue recordEventOfType:APXPushEventTypeOpened forNotification:[APXTestPushNotification notificationWithID:1] withIdentifier:nil];
+    
+    [NSThread sleepForTimeInterval:0.1];
+    XCTAssertEqual(queue.pendingCount, 2);
+    
+    [self.scheduler noteNetworkActivity];
+    
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+@end
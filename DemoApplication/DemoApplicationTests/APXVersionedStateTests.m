@@ -0,0 +1,206 @@
+//
+//  APXVersionedStateTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXVersionedState.h"
+#import "APXAliasStore.h"
+#import "APXTestDoubles.h"
+
+@interface APXVersionedStateTests : XCTestCase
+
+@property (nonatomic, strong) APXVersionedState *state;
+
+@end
+
+@implementation APXVersionedStateTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.state = [[APXVersionedState alloc] initWithFileURL:nil];
+}
+
+- (void)testServerReadIssuedBeforeALocalWriteIsDropped {
+    NSDictionary *versions = [self.state versionsForKeys:@[@"alias"]];
+    
+    [self.state applyLocalValues:@{@"alias" : @"local"}];
+    
+    XCTAssertEqualObjects([self.state applyServerValues:@{@"alias" : @"server"} readVersions:versions], @[]);
+    XCTAssertEqualObjects([self.state objectForKey:@"alias"], @"local");
+}
+
+- (void)testServerReadIsAppliedWhenNothingWasWritten {
+    NSDictionary *versions = [self.state versionsForKeys:@[@"alias", @"missing"]];
+    
+    [self.state applyServerValues:@{@"alias" : @"server"} readVersions:versions];
+    
+    XCTAssertEqualObjects([self.state objectForKey:@"alias"], @"server");
+    XCTAssertEqualObjects([self.state objectForKey:@"missing"], [NSNull null]);
+    XCTAssertEqualObjects([self.state dictionaryRepresentation], @{@"alias" : @"server"});
+}
+
+- (void)testFailedWriteRollsBackToTheConfirmedValue {
+    uint64_t first = [self.state applyLocalValues:@{@"alias" : @"first"}];
+    [self.state confirmValue:@"first" forKey:@"alias" version:first];
+    
+    uint64_t second = [self.state applyLocalValues:@{@"alias" : @"second"}];
+    
+    XCTAssertTrue([self.state rejectValueForKey:@"alias" version:second]);
+    XCTAssertEqualObjects([self.state objectForKey:@"alias"], @"first");
+}
+
+- (void)testFailedWriteKeepsANewerWrite {
+    uint64_t first = [self.state applyLocalValues:@{@"alias" : @"first"}];
+    [self.state applyLocalValues:@{@"alias" : @"second"}];
+    
+    XCTAssertFalse([self.state rejectValueForKey:@"alias" version:first]);
+    XCTAssertEqualObjects([self.state objectForKey:@"alias"], @"second");
+}
+
+- (void)testInvalidationDropsReadsInFlight {
+    NSDictionary *versions = [self.state versionsForKeys:@[@"alias"]];
+    
+    [self.state invalidateAllValues];
+    [self.state applyServerValues:@{@"alias" : @"server"} readVersions:versions];
+    
+    XCTAssertNil([self.state objectForKey:@"alias"]);
+}
+
+- (void)testOnlyConfirmedValuesArePersisted {
+    NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    APXVersionedState *state = [[APXVersionedState alloc] initWithFileURL:fileURL];
+    
+    uint64_t version = [state applyLocalValues:@{@"name" : @"Ada", @"age" : @36}];
+    [state confirmValue:@"Ada" forKey:@"name" version:version];
+    
+    // The file is written in the background.
+    [NSThread sleepForTimeInterval:0.1];
+    
+    APXVersionedState *reloaded = [[APXVersionedState alloc] initWithFileURL:fileURL];
+    XCTAssertEqualObjects([reloaded dictionaryRepresentation], @{@"name" : @"Ada"});
+    
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+- (void)testRollbackIsPersisted {
+    NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    APXVersionedState *state = [[APXVersionedState alloc] initWithFileURL:fileURL];
+    
+    uint64_t first = [state applyLocalValues:@{@"name" : @"Ada"}];
+    [state confirmValue:@"Ada" forKey:@"name" version:first];
+    
+    // While the second write is pending, saving another key leaves the name out of the file.
+    uint64_t second = [state applyLocalValues:@{@"name" : @"Grace"}];
+    uint64_t other = [state applyLocalValues:@{@"age" : @36}];
+    [state confirmValue:@36 forKey:@"age" version:other];
+    [state rejectValueForKey:@"name" version:second];
+    
+    // The file is written in the background.
+    [NSThread sleepForTimeInterval:0.1];
+    
+    APXVersionedState *reloaded = [[APXVersionedState alloc] initWithFileURL:fileURL];
+    XCTAssertEqualObjects([reloaded objectForKey:@"name"], @"Ada");
+    
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+- (void)testConfirmedValuesExpire {
+    self.state.maximumAge = 0.05;
+    
+    uint64_t version = [self.state applyLocalValues:@{@"name" : @"Ada", @"age" : @36}];
+    [self.state confirmValue:@"Ada" forKey:@"name" version:version];
+    
+    XCTAssertEqualObjects([self.state objectForKey:@"name"], @"Ada");
+    
+    [NSThread sleepForTimeInterval:0.1];
+    
+    // The pending write of age is what the app last wrote, it doesn't expire.
+    XCTAssertNil([self.state objectForKey:@"name"]);
+    XCTAssertEqualObjects([self.state dictionaryRepresentation], @{@"age" : @36});
+    
+    NSDictionary *versions = [self.state versionsForKeys:@[@"name"]];
+    XCTAssertEqualObjects([self.state applyServerValues:@{@"name" : @"Grace"} readVersions:versions], @[@"name"]);
+    XCTAssertEqualObjects([self.state objectForKey:@"name"], @"Grace");
+}
+
+- (void)testConcurrentReadersNeverSeeAPartialWrite {
+    NSUInteger writers = 4;
+    NSUInteger iterations = 2000;
+    __block NSUInteger partialReads = 0;
+    __block NSUInteger versionRegressions = 0;
+    
+    dispatch_apply(writers * 2, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+        if (index < writers) {
+            for (NSUInteger i = 0; i < iterations; i++) {
+                [self.state applyLocalValues:@{@"first" : @(i), @"second" : @(i)}];
+            }
+            
+            return;
+        }
+        
+        uint64_t lastVersion = 0;
+        
+        for (NSUInteger i = 0; i < iterations; i++) {
+            NSDictionary *values = [self.state objectsForKeys:@[@"first", @"second"]];
+            uint64_t version = [self.state versionForKey:@"first"];
+            
+            @synchronized (self) {
+                if (values[@"first"] != values[@"second"] && ![values[@"first"] isEqual:values[@"second"]]) partialReads++;
+                if (version < lastVersion) versionRegressions++;
+            }
+            
+            lastVersion = version;
+        }
+    });
+    
+    XCTAssertEqual(partialReads, 0);
+    XCTAssertEqual(versionRegressions, 0);
+    XCTAssertEqual([self.state versionForKey:@"second"], writers * iterations);
+    XCTAssertEqualObjects([self.state objectForKey:@"first"], [self.state objectForKey:@"second"]);
+}
+
+#pragma mark - APXAliasStore
+
+- (void)testAliasIsReadBackWithoutARequest {
+    APXFakeAppoxeeClient *client = [[APXFakeAppoxeeClient alloc] init];
+    client.backend.latency = 0.5;
+    APXAliasStore *store = [[APXAliasStore alloc] initWithClient:client];
+    
+    [store setDeviceAlias:@"ada" withCompletionHandler:nil];
+    
+    XCTestExpectation *read = [self expectationWithDescription:@"get"];
+    
+    APXRequestHandle *handle = [store getDeviceAliasWithCompletionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertNil(appoxeeError);
+        XCTAssertEqualObjects(data, @"ada");
+        XCTAssertTrue([NSThread isMainThread]);
+        [read fulfill];
+    }];
+    
+    XCTAssertNil(handle);
+    [self waitForExpectationsWithTimeout:0.25 handler:nil];
+    XCTAssertFalse([client.calls containsObject:@"getDeviceAliasWithCompletionHandler:"]);
+}
+
+- (void)testFailedAliasWriteRollsBack {
+    APXFakeAppoxeeClient *client = [[APXFakeAppoxeeClient alloc] init];
+    APXAliasStore *store = [[APXAliasStore alloc] initWithClient:client];
+    client.error = [NSError errorWithDomain:@"APXTest" code:1 userInfo:nil];
+    
+    XCTestExpectation *written = [self expectationWithDescription:@"set"];
+    
+    [store setDeviceAlias:@"ada" withCompletionHandler:^(NSError *appoxeeError, id data) {
+        XCTAssertNotNil(appoxeeError);
+        [written fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    XCTAssertNil(store.alias);
+}
+
+@end
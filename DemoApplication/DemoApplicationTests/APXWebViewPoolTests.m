@@ -0,0 +1,143 @@
+//
+//  APXWebViewPoolTests.m
+//  DemoApplicationTests
+//
+//  Created by Appoxee on 10/18/26.
+//  Copyright (c) 2026 Teradata. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "APXWebViewPool.h"
+#import "APXTestDoubles.h"
+
+@interface APXWebViewPoolTests : XCTestCase <UIWebViewDelegate>
+
+@property (nonatomic, strong) APXWebViewPool *pool;
+@property (nonatomic) NSUInteger startedLoads;
+
+@end
+
+@implementation APXWebViewPoolTests
+
+- (void)setUp {
+    [super setUp];
+    
+    self.pool = [[APXWebViewPool alloc] initWithCapacity:1 shellTemplate:nil];
+    self.startedLoads = 0;
+}
+
+- (void)webViewDidStartLoad:(UIWebView *)webView {
+    self.startedLoads++;
+}
+
+- (UIWebView *)loadedWebViewForMessage:(APXRichMessage *)message {
+    XCTestExpectation *loaded = [self expectationWithDescription:@"load"];
+    
+    UIWebView *webView = [self.pool webViewForMessage:message delegate:self completionHandler:^(UIWebView *loadedWebView, NSError *error) {
+        XCTAssertNil(error);
+        [loaded fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+    
+    return webView;
+}
+
+- (UIWebView *)loadedWebViewForHTML:(NSString *)html {
+    XCTestExpectation *loaded = [self expectationWithDescription:@"load"];
+    
+    UIWebView *webView = [self.pool webViewForHTML:html delegate:self completionHandler:^(UIWebView *loadedWebView, NSError *error) {
+        XCTAssertNil(error);
+        [loaded fulfill];
+    }];
+    
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+    
+    return webView;
+}
+
+- (APXRichMessage *)messageWithID:(NSInteger)uniqueID text:(NSString *)text {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:uniqueID title:text isRead:NO];
+    message.testContent = [NSString stringWithFormat:@"<p>%@</p>", text];
+    
+    return message;
+}
+
+- (NSString *)contentOfWebView:(UIWebView *)webView {
+    return [webView stringByEvaluatingJavaScriptFromString:@"document.getElementById('apx-content').innerHTML"];
+}
+
+- (void)testShellTemplateIsFilledIn {
+    APXWebViewPool *pool = [[APXWebViewPool alloc] initWithCapacity:1 shellTemplate:@"<div id=\"apx-content\">{{content}}</div>"];
+    
+    XCTAssertEqualObjects([pool HTMLForContent:@"<b>Hi</b>"], @"<div id=\"apx-content\"><b>Hi</b></div>");
+    XCTAssertEqualObjects([pool HTMLForContent:nil], @"<div id=\"apx-content\"></div>");
+}
+
+- (void)testNextHTMLIsInjectedWithoutLoadingAPage {
+    UIWebView *first = [self loadedWebViewForHTML:@"<p>One</p>"];
+    XCTAssertEqualObjects([self contentOfWebView:first], @"<p>One</p>");
+    
+    [self.pool recycleWebView:first];
+    self.startedLoads = 0;
+    
+    UIWebView *second = [self loadedWebViewForHTML:@"<p>Two   \"quoted\"</p>"];
+    
+    XCTAssertTrue(first == second);
+    XCTAssertEqual(self.startedLoads, 0);
+    XCTAssertEqualObjects([self contentOfWebView:second], @"<p>Two   \"quoted\"</p>");
+}
+
+- (void)testScriptsOfAMessageRun {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:1 title:@"Script" isRead:NO];
+    message.testContent = @"<p id=\"text\"></p><script>document.getElementById('text').innerHTML = 'ran';</script>";
+    
+    UIWebView *webView = [self loadedWebViewForMessage:message];
+    
+    XCTAssertEqualObjects([webView stringByEvaluatingJavaScriptFromString:@"document.getElementById('text').innerHTML"], @"ran");
+}
+
+- (void)testPreparedMessagesStayUnread {
+    APXTestRichMessage *message = [APXTestRichMessage messageWithID:1 title:@"Link" isRead:NO];
+    message.testContent = @"<p>Link</p>";
+    message.testMessageLink = @"https://example.com/message";
+    
+    [self.pool prepareMessages:@[message]];
+    
+    XCTAssertEqual(message.messageLinkReadCount, 0);
+    XCTAssertFalse(message.isRead);
+}
+
+- (void)testRecycledMessageIsReturnedLoaded {
+    APXRichMessage *message = [self messageWithID:1 text:@"One"];
+    UIWebView *first = [self loadedWebViewForMessage:message];
+    
+    [self.pool recycleWebView:first];
+    self.startedLoads = 0;
+    
+    UIWebView *second = [self loadedWebViewForMessage:message];
+    
+    XCTAssertTrue(first == second);
+    XCTAssertEqual(self.startedLoads, 0);
+}
+
+- (void)testWebViewsBeyondCapacityAreNotKept {
+    APXRichMessage *one = [self messageWithID:1 text:@"One"];
+    APXRichMessage *two = [self messageWithID:2 text:@"Two"];
+    
+    UIWebView *first = [self loadedWebViewForMessage:one];
+    UIWebView *second = [self loadedWebViewForMessage:two];
+    
+    XCTAssertTrue(first != second);
+    
+    [self.pool recycleWebView:first];
+    [self.pool recycleWebView:second];
+    self.startedLoads = 0;
+    
+    // The pool only kept the web view recycled last.
+    XCTAssertTrue([self loadedWebViewForMessage:two] == second);
+    XCTAssertEqual(self.startedLoads, 0);
+    XCTAssertTrue([self loadedWebViewForMessage:one] != first);
+}
+
+@end